@@ -0,0 +1,35 @@
+#include "AllocationCounter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace Odyssey
+{
+	inline static std::atomic<uint64_t> s_Allocations = 0;
+
+	uint64_t AllocationCounter::GetCount()
+	{
+		return s_Allocations.load(std::memory_order_relaxed);
+	}
+}
+
+// The array and nothrow forms forward to these by default, so they are counted as well
+void* operator new(size_t size)
+{
+	Odyssey::s_Allocations.fetch_add(1, std::memory_order_relaxed);
+
+	if (void* pointer = std::malloc(size > 0 ? size : 1))
+		return pointer;
+
+	throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept
+{
+	std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept
+{
+	std::free(pointer);
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+namespace Odyssey
+{
+	// Counts every call to the global operator new, the bench replaces it to check code that should stay off the heap
+	// Allocations that bypass operator new, like Jolt's own allocator, are not counted
+	class AllocationCounter
+	{
+	public:
+		static uint64_t GetCount();
+	};
+
+	// Heap allocations made on any thread since the scope was created
+	class AllocationScope
+	{
+	public:
+		AllocationScope() : m_Start(AllocationCounter::GetCount()) { }
+
+	public:
+		uint64_t GetCount() const { return AllocationCounter::GetCount() - m_Start; }
+
+	private:
+		uint64_t m_Start = 0;
+	};
+}
@@ -0,0 +1,506 @@
+#include "Bench.h"
+#include "JsonWriter.h"
+#include "AllocationCounter.h"
+#include "MicroBenchmarks.h"
+#include "AssetManager.h"
+#include "BinaryScene.h"
+#include "EventSystem.h"
+#include "FileManager.h"
+#include "FrameAllocator.h"
+#include "Log.h"
+#include "OdysseyTime.h"
+#include "PhysicsSystem.h"
+#include "Preferences.h"
+#include "Project.h"
+#include "Random.h"
+#include "RigidBody.h"
+#include "Scene.h"
+#include "SceneManager.h"
+#include "Shader.h"
+#include "ShaderCache.h"
+#include "SourceShader.h"
+#include "Transform.h"
+#include "ScriptCompiler.h"
+#include "ScriptingManager.h"
+
+namespace Odyssey
+{
+	Bench::Bench(const Settings& settings)
+		: m_Settings(settings)
+	{
+		Random::Initialize();
+
+		if (!m_Settings.ProjectDirectory.empty())
+			LoadProject();
+
+		PhysicsSystem::Init();
+	}
+
+	Bench::~Bench()
+	{
+		StopActiveScene();
+		PhysicsSystem::Destroy();
+
+		if (m_ScriptingInitialized)
+		{
+			m_ScriptCompiler.reset();
+			ScriptingManager::Destroy();
+			FileManager::Destroy();
+		}
+	}
+
+	bool Bench::Run()
+	{
+		if (!m_Settings.ScenePath.empty() && !m_ScriptingInitialized)
+		{
+			Log::Error("[Bench] Loading a scene requires a project.");
+			return false;
+		}
+
+		if (m_Settings.CompileShaders && !m_ScriptingInitialized)
+		{
+			Log::Error("[Bench] Compiling shaders requires a project.");
+			return false;
+		}
+
+		JsonWriter writer;
+		writer.BeginObject();
+		WriteSettings(writer);
+
+		Scene* scene = nullptr;
+
+		if (!m_Settings.ScenePath.empty())
+		{
+			SceneManager::LoadScene(m_Settings.ScenePath);
+			scene = SceneManager::GetActiveScene();
+			scene->OnStartRuntime();
+		}
+		else
+		{
+			scene = SceneManager::CreateScene();
+		}
+
+		// Synthetic content is added on top of a loaded scene
+		SceneGenerator generator(m_Settings.Generator);
+		generator.Generate(scene);
+
+		scene->Awake();
+		EventSystem::Flush();
+
+		TickFrames(generator);
+		WriteTimings(writer);
+
+		bool passed = true;
+
+		if (m_Settings.RefIterations > 0 || m_Settings.CullBoxes > 0 || m_Settings.FrameAllocatorFrames > 0)
+		{
+			writer.BeginObject("micro");
+
+			if (m_Settings.RefIterations > 0)
+				MicroBenchmarks::RunRefBenchmarks(writer, m_Settings.RefIterations);
+
+			if (m_Settings.CullBoxes > 0)
+			{
+				MicroBenchmarks::RunCullingBenchmarks(writer, m_Settings.CullBoxes, m_Settings.Generator.Seed);
+				MicroBenchmarks::RunTreeBenchmarks(writer, m_Settings.CullBoxes, m_Settings.Generator.Seed);
+			}
+
+			if (m_Settings.FrameAllocatorFrames > 0)
+				passed &= MicroBenchmarks::RunFrameAllocatorBenchmarks(writer, m_Settings.FrameAllocatorFrames);
+
+			writer.EndObject();
+		}
+
+		if (m_Settings.SceneGraphEntities > 0)
+			RunSceneGraphBenchmarks(writer);
+
+		if (m_Settings.CompileShaders)
+			passed &= RunShaderCacheBenchmark(writer);
+
+		if (m_Settings.DeterminismSteps > 0)
+			CheckDeterminism(writer);
+
+		writer.EndObject();
+
+		if (m_Settings.OutputPath.empty())
+		{
+			std::cout << writer.GetString() << std::endl;
+			return passed;
+		}
+
+		std::ofstream output(m_Settings.OutputPath);
+		if (!output.is_open())
+		{
+			Log::Error("[Bench] Could not open " + m_Settings.OutputPath.string());
+			return false;
+		}
+
+		output << writer.GetString() << std::endl;
+		return passed;
+	}
+
+	void Bench::LoadProject()
+	{
+		if (!std::filesystem::exists(m_Settings.PreferencesPath))
+		{
+			Log::Error("[Bench] Missing preferences file " + m_Settings.PreferencesPath.string());
+			return;
+		}
+
+		ScriptingManager::Initialize();
+		FileManager::Init();
+
+		Preferences::LoadPreferences(m_Settings.PreferencesPath);
+		Project::LoadProject(m_Settings.ProjectDirectory);
+
+		{
+			// Create the asset database
+			AssetManager::Settings settings;
+			settings.AssetsDirectory = Project::GetActiveAssetsDirectory();
+			settings.AdditionalRegistries = { Preferences::GetEditorRegistry() };
+			settings.AssetExtensions = Preferences::GetAssetExtensions();
+			settings.SourceAssetExtensionMap = Preferences::GetSourceExtensionsMap();
+			AssetManager::CreateDatabase(settings);
+		}
+
+		{
+			// Use the user assembly the editor last built, the bench never compiles scripts
+			ScriptCompiler::Settings settings;
+			settings.ApplicationPath = Globals::GetApplicationPath();
+			settings.CacheDirectory = Project::GetActiveCacheDirectory();
+			settings.UserScriptsDirectory = Project::GetActiveUserScriptsDirectory();
+			settings.UserScriptsProject = Project::GetActiveUserScriptsProject();
+			m_ScriptCompiler = std::make_unique<ScriptCompiler>(settings);
+		}
+
+		if (std::filesystem::exists(m_ScriptCompiler->GetUserAssemblyPath()))
+		{
+			ScriptingManager::SetUserAssembliesPath(m_ScriptCompiler->GetUserAssemblyPath());
+			ScriptingManager::LoadUserAssemblies();
+		}
+		else
+		{
+			Log::Warning("[Bench] No user assembly found, build the project's scripts in the editor first.");
+		}
+
+		m_ScriptingInitialized = true;
+	}
+
+	void Bench::StopActiveScene()
+	{
+		// Mirrors leaving playmode, which is what releases the scene's physics bodies
+		Scene* scene = SceneManager::GetActiveScene();
+
+		if (scene && scene->IsRunning())
+		{
+			scene->OnStopRuntime();
+			scene->OnDestroy();
+		}
+	}
+
+	void Bench::TickFrames(SceneGenerator& generator)
+	{
+		m_Timings.clear();
+		m_Timings.push_back({ "FrameAllocator.Reset" });
+		m_Timings.push_back({ "Scene.Update" });
+		m_Timings.push_back({ "Physics.Update" });
+		m_Timings.push_back({ "EventSystem.Flush" });
+		m_Timings.push_back({ "Frame" });
+
+		for (SystemTimings& timings : m_Timings)
+			timings.Samples.reserve(m_Settings.Frames);
+
+		const uint32_t totalFrames = m_Settings.WarmupFrames + m_Settings.Frames;
+
+		for (uint32_t frame = 0; frame < totalFrames; frame++)
+		{
+			bool record = frame >= m_Settings.WarmupFrames;
+
+			// Drive the clock ourselves so every run sees the same frame times
+			Time::s_DeltaTime = m_Settings.FrameTime;
+			Time::s_Elapsed = (float)frame * m_Settings.FrameTime;
+
+			// Not part of any system, the generator just keeps the rigs moving
+			generator.Animate(Time::s_Elapsed);
+
+			auto frameStart = std::chrono::steady_clock::now();
+
+			auto measure = [&](size_t index, auto&& func)
+				{
+					AllocationScope allocations;
+					auto start = std::chrono::steady_clock::now();
+					func();
+
+					if (record)
+					{
+						m_Timings[index].Samples.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+						m_Timings[index].HeapAllocations += allocations.GetCount();
+						m_Timings[4].HeapAllocations += allocations.GetCount();
+					}
+				};
+
+			// Same order as the editor's frame
+			measure(0, []() { FrameAllocator::Reset(); });
+			measure(1, []() { SceneManager::Update(); });
+			measure(2, [this]() { PhysicsSystem::Update(m_Settings.FrameTime); });
+			measure(3, []() { EventSystem::Flush(); });
+
+			if (record)
+				m_Timings[4].Samples.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frameStart).count());
+		}
+	}
+
+	void Bench::CheckDeterminism(JsonWriter& writer)
+	{
+		// The same number of fixed steps, delivered one per frame and then spread over uneven frames
+		std::vector<float3> expected = SimulateBodies({ 1 });
+		std::vector<float3> actual = SimulateBodies({ 2, 0, 1, 4, 1 });
+
+		float maxDelta = 0.0f;
+		for (size_t i = 0; i < std::min(expected.size(), actual.size()); i++)
+			maxDelta = std::max(maxDelta, glm::length(expected[i] - actual[i]));
+
+		bool deterministic = expected.size() == actual.size() && maxDelta == 0.0f;
+
+		writer.BeginObject("determinism");
+		writer.Write("bodies", Determinism_Bodies);
+		writer.Write("steps", m_Settings.DeterminismSteps);
+		writer.Write("max_position_delta", maxDelta);
+		writer.Write("deterministic", deterministic);
+		writer.EndObject();
+
+		if (!deterministic)
+			Log::Error("[Bench] Physics diverged when the frame rate changed.");
+	}
+
+	void Bench::RunSceneGraphBenchmarks(JsonWriter& writer)
+	{
+		writer.BeginObject("scene_graph");
+
+		// A twentieth, half and all of the requested entities, so any non-linear growth shows up in the per entity cost
+		const uint32_t largest = std::max(m_Settings.SceneGraphEntities, Scene_Graph_Groups + 1);
+		for (uint32_t entityCount : { std::max(largest / 20, Scene_Graph_Groups + 1), largest / 2, largest })
+			MeasureSceneGraph(writer, entityCount);
+
+		writer.EndObject();
+	}
+
+	void Bench::MeasureSceneGraph(JsonWriter& writer, uint32_t entityCount)
+	{
+		auto measure = [](auto&& func)
+			{
+				auto start = std::chrono::steady_clock::now();
+				func();
+				return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+			};
+
+		// Flat source scene, every entity a root with a transform
+		Path scenePath = std::filesystem::temp_directory_path() / ("Odyssey.Bench." + std::to_string(entityCount) + BinaryScene::Extension);
+		{
+			Scene source;
+			for (uint32_t i = 0; i < entityCount; i++)
+			{
+				GameObject gameObject = source.CreateGameObject();
+				gameObject.AddComponent<Transform>().SetPosition((float)i, 0.0f, 0.0f);
+			}
+
+			BinaryScene::Save(&source, scenePath);
+			EventSystem::Flush();
+		}
+
+		std::unique_ptr<Scene> scene = std::make_unique<Scene>();
+		bool loaded = false;
+		double loadTime = measure([&]() { loaded = BinaryScene::Load(scene.get(), scenePath); });
+
+		if (!loaded)
+		{
+			Log::Error("[Bench] Could not load the scene graph benchmark scene " + scenePath.string());
+			std::filesystem::remove(scenePath);
+			return;
+		}
+
+		std::vector<GameObject> gameObjects;
+		gameObjects.reserve(entityCount);
+
+		for (auto entity : scene->GetAllEntitiesWith<Transform>())
+			gameObjects.push_back(GameObject(scene.get(), entity));
+
+		// Moves every entity past the groups off the flat root and under one of them
+		double reparentTime = measure([&]()
+			{
+				for (size_t i = Scene_Graph_Groups; i < gameObjects.size(); i++)
+					gameObjects[i].SetParent(gameObjects[i % Scene_Graph_Groups]);
+			});
+
+		// Children first so each destroy only removes a single node
+		double destroyTime = measure([&]()
+			{
+				for (size_t i = gameObjects.size(); i > 0; i--)
+					scene->DestroyGameObject(gameObjects[i - 1]);
+			});
+
+		EventSystem::Flush();
+		scene.reset();
+		std::filesystem::remove(scenePath);
+
+		auto nanosecondsPerEntity = [&](double milliseconds) { return milliseconds * 1000000.0 / (double)gameObjects.size(); };
+
+		writer.BeginObject(std::to_string(entityCount));
+		writer.Write("entities", (uint32_t)gameObjects.size());
+		writer.Write("load_ms", loadTime);
+		writer.Write("load_ns_per_entity", nanosecondsPerEntity(loadTime));
+		writer.Write("reparent_ms", reparentTime);
+		writer.Write("reparent_ns_per_entity", nanosecondsPerEntity(reparentTime));
+		writer.Write("destroy_ms", destroyTime);
+		writer.Write("destroy_ns_per_entity", nanosecondsPerEntity(destroyTime));
+		writer.EndObject();
+	}
+
+	bool Bench::RunShaderCacheBenchmark(JsonWriter& writer)
+	{
+		// Parse the sources up front so only the compiles are timed
+		std::vector<Ref<SourceShader>> sources;
+		for (GUID guid : AssetManager::GetAssetsOfType(Shader::Type))
+		{
+			GUID sourceGUID = Asset::ReadSourceAsset(AssetManager::GUIDToPath(guid));
+			if (Ref<SourceShader> source = AssetManager::LoadSourceAsset<SourceShader>(sourceGUID))
+				sources.push_back(source);
+		}
+
+		std::vector<SourceShader*> shaders;
+		for (Ref<SourceShader>& source : sources)
+			shaders.push_back(source.Get());
+
+		auto measure = [&](uint32_t& stages, uint32_t& hits)
+			{
+				auto start = std::chrono::steady_clock::now();
+				hits = Shader::Precompile(shaders, stages);
+				return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+			};
+
+		ShaderCache::Clear();
+
+		uint32_t coldStages = 0, coldHits = 0;
+		double coldTime = measure(coldStages, coldHits);
+
+		uint32_t warmStages = 0, warmHits = 0;
+		double warmTime = measure(warmStages, warmHits);
+
+		writer.BeginObject("shader_cache");
+		writer.Write("shaders", (uint32_t)shaders.size());
+		writer.Write("stages", coldStages);
+		writer.Write("cold_ms", coldTime);
+		writer.Write("cold_hits", coldHits);
+		writer.Write("warm_ms", warmTime);
+		writer.Write("warm_hits", warmHits);
+		writer.EndObject();
+
+		// Every stage the cold pass compiled should have been served from the cache
+		bool passed = warmHits == warmStages;
+		if (!passed)
+			Log::Error("[Bench] The warm shader compile missed the cache on " + std::to_string(warmStages - warmHits) + " stages.");
+
+		return passed;
+	}
+
+	std::vector<float3> Bench::SimulateBodies(const std::vector<uint32_t>& stepsPerFrame)
+	{
+		// Start from a fresh physics world so both runs hand out the same body IDs in the same order
+		StopActiveScene();
+		Scene* scene = SceneManager::CreateScene();
+		PhysicsSystem::Destroy();
+		PhysicsSystem::Init();
+
+		SceneGenerator::Settings settings;
+		settings.Bodies = Determinism_Bodies;
+
+		SceneGenerator generator(settings);
+		generator.Generate(scene);
+
+		scene->Awake();
+		EventSystem::Flush();
+
+		// Frame lengths are whole steps and only scaled by powers of two so the accumulator stays exact
+		const float fixedDeltaTime = PhysicsSystem::GetFixedDeltaTime();
+		uint32_t stepsTaken = 0;
+
+		for (size_t frame = 0; stepsTaken < m_Settings.DeterminismSteps; frame++)
+		{
+			uint32_t steps = stepsPerFrame[frame % stepsPerFrame.size()];
+			if (stepsTaken + steps > m_Settings.DeterminismSteps)
+				steps = 1;
+
+			FrameAllocator::Reset();
+			PhysicsSystem::Update((float)steps * fixedDeltaTime);
+			EventSystem::Flush();
+
+			stepsTaken += steps;
+		}
+
+		// Compare the simulated positions rather than the interpolated transforms
+		std::vector<float3> positions;
+		BodyInterface& bodyInterface = PhysicsSystem::Instance().GetBodyInterface();
+
+		for (auto entity : scene->GetAllEntitiesWith<RigidBody>())
+		{
+			GameObject gameObject = GameObject(scene, entity);
+			RigidBody& rigidBody = gameObject.GetComponent<RigidBody>();
+			positions.push_back(ToFloat3(bodyInterface.GetPosition(rigidBody.GetBodyID())));
+		}
+
+		return positions;
+	}
+
+	void Bench::WriteSettings(JsonWriter& writer)
+	{
+		writer.BeginObject("settings");
+		writer.Write("project", m_Settings.ProjectDirectory.string());
+		writer.Write("scene", m_Settings.ScenePath.string());
+		writer.Write("frames", m_Settings.Frames);
+		writer.Write("warmup_frames", m_Settings.WarmupFrames);
+		writer.Write("frame_time", m_Settings.FrameTime);
+		writer.Write("fixed_delta_time", PhysicsSystem::GetFixedDeltaTime());
+		writer.Write("seed", m_Settings.Generator.Seed);
+		writer.Write("entities", m_Settings.Generator.Entities);
+		writer.Write("rigs", m_Settings.Generator.Rigs);
+		writer.Write("bones_per_rig", m_Settings.Generator.BonesPerRig);
+		writer.Write("bodies", m_Settings.Generator.Bodies);
+		writer.EndObject();
+	}
+
+	void Bench::WriteTimings(JsonWriter& writer)
+	{
+		writer.BeginObject("systems");
+
+		for (SystemTimings& timings : m_Timings)
+		{
+			std::vector<double> sorted = timings.Samples;
+			std::sort(sorted.begin(), sorted.end());
+
+			double total = 0.0;
+			for (double sample : sorted)
+				total += sample;
+
+			auto percentile = [&sorted](double fraction)
+				{
+					if (sorted.size() == 0)
+						return 0.0;
+
+					size_t index = (size_t)(fraction * (double)(sorted.size() - 1));
+					return sorted[index];
+				};
+
+			writer.BeginObject(timings.Name);
+			writer.Write("total_ms", total);
+			writer.Write("mean_ms", sorted.size() > 0 ? total / (double)sorted.size() : 0.0);
+			writer.Write("min_ms", percentile(0.0));
+			writer.Write("p50_ms", percentile(0.5));
+			writer.Write("p95_ms", percentile(0.95));
+			writer.Write("max_ms", percentile(1.0));
+			writer.Write("heap_allocations_per_frame", sorted.size() > 0 ? (double)timings.HeapAllocations / (double)sorted.size() : 0.0);
+			writer.EndObject();
+		}
+
+		writer.EndObject();
+	}
+}
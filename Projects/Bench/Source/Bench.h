@@ -0,0 +1,81 @@
+#pragma once
+#include "SceneGenerator.h"
+
+namespace Odyssey
+{
+	class JsonWriter;
+	class ScriptCompiler;
+
+	// Runs the engine core without a window or renderer and reports per-system frame timings as JSON
+	class Bench
+	{
+	public:
+		struct Settings
+		{
+		public:
+			// Optional, a project is only needed to load a scene or rig assets from disk
+			Path ProjectDirectory;
+			Path ScenePath;
+			Path PreferencesPath = "Resources/Editor.prefs";
+			Path OutputPath;
+
+			uint32_t Frames = 600;
+			uint32_t WarmupFrames = 60;
+			float FrameTime = 1.0f / 60.0f;
+
+			SceneGenerator::Settings Generator;
+			uint32_t RefIterations = 1000000;
+			uint32_t CullBoxes = 100000;
+			uint32_t FrameAllocatorFrames = 100;
+			uint32_t SceneGraphEntities = 20000;
+			bool CompileShaders = false;
+			uint32_t DeterminismSteps = 0;
+		};
+
+	public:
+		Bench(const Settings& settings);
+		~Bench();
+
+	public:
+		bool Run();
+
+	private:
+		struct SystemTimings
+		{
+		public:
+			std::string Name;
+			std::vector<double> Samples;
+			uint64_t HeapAllocations = 0;
+		};
+
+	private:
+		void LoadProject();
+		void StopActiveScene();
+		void TickFrames(SceneGenerator& generator);
+		void CheckDeterminism(JsonWriter& writer);
+
+		// Load, reparent and destroy at growing entity counts, each should cost the same per entity
+		void RunSceneGraphBenchmarks(JsonWriter& writer);
+		void MeasureSceneGraph(JsonWriter& writer, uint32_t entityCount);
+
+		// Compiles every shader in the project against an empty and then a full shader cache
+		bool RunShaderCacheBenchmark(JsonWriter& writer);
+		std::vector<float3> SimulateBodies(const std::vector<uint32_t>& stepsPerFrame);
+
+	private:
+		void WriteSettings(JsonWriter& writer);
+		void WriteTimings(JsonWriter& writer);
+
+	private:
+		Settings m_Settings;
+		bool m_ScriptingInitialized = false;
+		std::unique_ptr<ScriptCompiler> m_ScriptCompiler;
+		std::vector<SystemTimings> m_Timings;
+
+	private:
+		inline static constexpr uint32_t Determinism_Bodies = 256;
+
+		// Entities are reparented under this many root level groups so no hierarchy gets deep
+		inline static constexpr uint32_t Scene_Graph_Groups = 64;
+	};
+}
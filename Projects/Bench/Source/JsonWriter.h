@@ -0,0 +1,103 @@
+#pragma once
+
+namespace Odyssey
+{
+	// Minimal streaming writer for the bench report, objects only need keys and scalar values
+	class JsonWriter
+	{
+	public:
+		void BeginObject(std::string_view key = "")
+		{
+			WriteKey(key);
+			m_Json += "{";
+			m_FirstEntry.push_back(true);
+		}
+
+		void EndObject()
+		{
+			m_FirstEntry.pop_back();
+			m_Json += "\n" + Indent() + "}";
+		}
+
+		void Write(std::string_view key, std::string_view value)
+		{
+			WriteKey(key);
+			m_Json += "\"" + Escape(value) + "\"";
+		}
+
+		void Write(std::string_view key, const char* value)
+		{
+			Write(key, std::string_view(value));
+		}
+
+		void Write(std::string_view key, bool value)
+		{
+			WriteKey(key);
+			m_Json += value ? "true" : "false";
+		}
+
+		void Write(std::string_view key, uint64_t value)
+		{
+			WriteKey(key);
+			m_Json += std::to_string(value);
+		}
+
+		void Write(std::string_view key, uint32_t value)
+		{
+			Write(key, (uint64_t)value);
+		}
+
+		void Write(std::string_view key, double value)
+		{
+			WriteKey(key);
+
+			// NaN and infinity aren't valid JSON
+			m_Json += std::isfinite(value) ? std::format("{:.6f}", value) : "null";
+		}
+
+		void Write(std::string_view key, float value)
+		{
+			Write(key, (double)value);
+		}
+
+		const std::string& GetString() { return m_Json; }
+
+	private:
+		void WriteKey(std::string_view key)
+		{
+			if (m_FirstEntry.size() == 0)
+				return;
+
+			if (!m_FirstEntry.back())
+				m_Json += ",";
+
+			m_FirstEntry.back() = false;
+			m_Json += "\n" + Indent() + "\"" + Escape(key) + "\": ";
+		}
+
+		std::string Indent()
+		{
+			return std::string(m_FirstEntry.size() * 2, ' ');
+		}
+
+		static std::string Escape(std::string_view value)
+		{
+			std::string escaped;
+			escaped.reserve(value.size());
+
+			for (char c : value)
+			{
+				if (c == '"' || c == '\\')
+					escaped += '\\';
+
+				escaped += c;
+			}
+
+			return escaped;
+		}
+
+	private:
+		std::string m_Json;
+		std::vector<bool> m_FirstEntry;
+	};
+}
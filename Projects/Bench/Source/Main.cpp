@@ -0,0 +1,120 @@
+#include "Bench.h"
+#include "Log.h"
+
+namespace Odyssey
+{
+	void PrintUsage()
+	{
+		std::cout <<
+			"Usage: Odyssey.Bench [options]\n"
+			"  --project <dir>        Project to load assets and scripts from\n"
+			"  --scene <path>         Scene to load from the project\n"
+			"  --prefs <path>         Editor preferences file, defaults to Resources/Editor.prefs\n"
+			"  --output <path>        Write the JSON report here instead of stdout\n"
+			"  --frames <n>           Recorded frames (600)\n"
+			"  --warmup <n>           Frames run before recording (60)\n"
+			"  --frame-time <sec>     Simulated length of each frame (1/60)\n"
+			"  --seed <n>             Seed for the synthetic scene\n"
+			"  --entities <n>         Synthetic transform-only entities\n"
+			"  --rigs <n>             Synthetic rigs\n"
+			"  --bones <n>            Bones per synthetic rig (64)\n"
+			"  --rig-asset <guid>     Animate the rigs with this animation rig\n"
+			"  --blueprint <guid>     Animation blueprint to play on the rigs\n"
+			"  --bodies <n>           Synthetic dynamic rigid bodies\n"
+			"  --ref-iterations <n>   Ref microbenchmark iterations, 0 to skip (1000000)\n"
+			"  --cull-boxes <n>       Bounding boxes in the frustum culling microbenchmark, 0 to skip (100000)\n"
+			"  --arena-frames <n>     Frames in the frame allocator heap check, 0 to skip (100)\n"
+			"  --graph-entities <n>   Largest scene in the scene graph scaling benchmark, 0 to skip (20000)\n"
+			"  --shaders <0|1>        Time a cold and a warm shader cache compile of the project's shaders (0)\n"
+			"  --determinism <steps>  Check physics gives the same result at different frame rates\n";
+	}
+
+	bool ParseArguments(int argc, char** argv, Bench::Settings& settings)
+	{
+		for (int i = 1; i < argc; i++)
+		{
+			std::string_view arg = argv[i];
+
+			if (arg == "--help")
+				return false;
+
+			if (i + 1 >= argc)
+			{
+				Log::Error("[Bench] Missing value for " + std::string(arg));
+				return false;
+			}
+
+			std::string value = argv[++i];
+
+			try
+			{
+				if (arg == "--project")
+					settings.ProjectDirectory = value;
+				else if (arg == "--scene")
+					settings.ScenePath = value;
+				else if (arg == "--prefs")
+					settings.PreferencesPath = value;
+				else if (arg == "--output")
+					settings.OutputPath = value;
+				else if (arg == "--frames")
+					settings.Frames = (uint32_t)std::stoul(value);
+				else if (arg == "--warmup")
+					settings.WarmupFrames = (uint32_t)std::stoul(value);
+				else if (arg == "--frame-time")
+					settings.FrameTime = std::stof(value);
+				else if (arg == "--seed")
+					settings.Generator.Seed = (uint32_t)std::stoul(value);
+				else if (arg == "--entities")
+					settings.Generator.Entities = (uint32_t)std::stoul(value);
+				else if (arg == "--rigs")
+					settings.Generator.Rigs = (uint32_t)std::stoul(value);
+				else if (arg == "--bones")
+					settings.Generator.BonesPerRig = (uint32_t)std::stoul(value);
+				else if (arg == "--rig-asset")
+					settings.Generator.RigAsset = GUID(value);
+				else if (arg == "--blueprint")
+					settings.Generator.BlueprintAsset = GUID(value);
+				else if (arg == "--bodies")
+					settings.Generator.Bodies = (uint32_t)std::stoul(value);
+				else if (arg == "--ref-iterations")
+					settings.RefIterations = (uint32_t)std::stoul(value);
+				else if (arg == "--cull-boxes")
+					settings.CullBoxes = (uint32_t)std::stoul(value);
+				else if (arg == "--arena-frames")
+					settings.FrameAllocatorFrames = (uint32_t)std::stoul(value);
+				else if (arg == "--graph-entities")
+					settings.SceneGraphEntities = (uint32_t)std::stoul(value);
+				else if (arg == "--shaders")
+					settings.CompileShaders = std::stoul(value) != 0;
+				else if (arg == "--determinism")
+					settings.DeterminismSteps = (uint32_t)std::stoul(value);
+				else
+				{
+					Log::Error("[Bench] Unknown argument " + std::string(arg));
+					return false;
+				}
+			}
+			catch (const std::exception&)
+			{
+				Log::Error("[Bench] Invalid value " + value + " for " + std::string(arg));
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	Odyssey::Bench::Settings settings;
+
+	if (!Odyssey::ParseArguments(argc, argv, settings))
+	{
+		Odyssey::PrintUsage();
+		return 1;
+	}
+
+	Odyssey::Bench bench(settings);
+	return bench.Run() ? 0 : 1;
+}
@@ -0,0 +1,274 @@
+#include "MicroBenchmarks.h"
+#include "JsonWriter.h"
+#include "Ref.h"
+#include "Frustum.h"
+#include "DynamicTree.h"
+#include "FrameAllocator.h"
+#include "AllocationCounter.h"
+#include "Log.h"
+
+namespace Odyssey
+{
+	struct RefPayload
+	{
+	public:
+		uint64_t Data[4] = { };
+	};
+
+	struct RefCountedPayload : public RefCounted
+	{
+	public:
+		uint64_t Data[4] = { };
+	};
+
+	// Stops the optimizer from removing the work being measured
+	inline static void KeepAlive(const void* pointer)
+	{
+		static volatile const void* sink = nullptr;
+		sink = pointer;
+	}
+
+	void MicroBenchmarks::RunRefBenchmarks(JsonWriter& writer, uint32_t iterations)
+	{
+		writer.BeginObject("Ref");
+
+		Measure(writer, "MakeRef", iterations, []()
+			{
+				Ref<RefPayload> ref = MakeRef<RefPayload>();
+				KeepAlive(ref.Get());
+			});
+
+		Measure(writer, "MakeRef.RefCounted", iterations, []()
+			{
+				Ref<RefCountedPayload> ref = MakeRef<RefCountedPayload>();
+				KeepAlive(ref.Get());
+			});
+
+		Measure(writer, "FromPointer", iterations, []()
+			{
+				Ref<RefPayload> ref(new RefPayload());
+				KeepAlive(ref.Get());
+			});
+
+		Ref<RefPayload> source = MakeRef<RefPayload>();
+		Measure(writer, "Copy", iterations, [&source]()
+			{
+				Ref<RefPayload> copy = source;
+				KeepAlive(copy.Get());
+			});
+
+		Measure(writer, "std::make_shared", iterations, []()
+			{
+				std::shared_ptr<RefPayload> ptr = std::make_shared<RefPayload>();
+				KeepAlive(ptr.get());
+			});
+
+		std::shared_ptr<RefPayload> sharedSource = std::make_shared<RefPayload>();
+		Measure(writer, "std::shared_ptr.Copy", iterations, [&sharedSource]()
+			{
+				std::shared_ptr<RefPayload> copy = sharedSource;
+				KeepAlive(copy.get());
+			});
+
+		writer.EndObject();
+	}
+
+	void MicroBenchmarks::RunCullingBenchmarks(JsonWriter& writer, uint32_t boxCount, uint32_t seed)
+	{
+		std::mt19937 random(seed);
+		std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+		std::uniform_real_distribution<float> extent(0.1f, 4.0f);
+
+		std::vector<BoundingBox> boxes(boxCount);
+		BoundsArray bounds;
+
+		for (BoundingBox& box : boxes)
+		{
+			float3 center = float3(position(random), position(random), position(random));
+			box = BoundingBox(center - float3(extent(random)), center + float3(extent(random)));
+			bounds.Add(box);
+		}
+
+		mat4 view = glm::lookAtLH(float3(0.0f), float3(0.0f, 0.0f, 1.0f), float3(0.0f, 1.0f, 0.0f));
+		mat4 projection = glm::perspectiveFovLH(glm::radians(60.0f), 1920.0f, 1080.0f, 0.1f, 1000.0f);
+		Frustum frustum(projection * view);
+
+		// Enough passes to average out the timer resolution
+		const uint32_t passes = std::max(1u, 10000000u / std::max(boxCount, 1u));
+		std::vector<uint32_t> visible;
+		visible.reserve(boxCount);
+
+		writer.BeginObject("Frustum");
+
+		Measure(writer, "Cull", passes, [&]()
+			{
+				visible.clear();
+				frustum.Cull(bounds, visible);
+				KeepAlive(visible.data());
+			});
+
+		Measure(writer, "Intersects", passes, [&]()
+			{
+				visible.clear();
+				for (uint32_t i = 0; i < boxCount; i++)
+				{
+					if (frustum.Intersects(boxes[i]))
+						visible.push_back(i);
+				}
+				KeepAlive(visible.data());
+			});
+
+		writer.Write("boxes", boxCount);
+		writer.Write("visible", (uint32_t)visible.size());
+		writer.EndObject();
+	}
+
+	void MicroBenchmarks::RunTreeBenchmarks(JsonWriter& writer, uint32_t boxCount, uint32_t seed)
+	{
+		std::mt19937 random(seed);
+		std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+		std::uniform_real_distribution<float> extent(0.1f, 4.0f);
+		std::uniform_real_distribution<float> offset(-1.0f, 1.0f);
+
+		std::vector<BoundingBox> boxes(boxCount);
+		for (BoundingBox& box : boxes)
+		{
+			float3 center = float3(position(random), position(random), position(random));
+			box = BoundingBox(center - float3(extent(random)), center + float3(extent(random)));
+		}
+
+		DynamicTree tree;
+		std::vector<uint32_t> proxies(boxCount);
+
+		writer.BeginObject("DynamicTree");
+
+		Measure(writer, "Build", 1, [&]()
+			{
+				for (uint32_t i = 0; i < boxCount; i++)
+					proxies[i] = tree.CreateProxy(boxes[i], i);
+			});
+
+		// Nudge a tenth of the boxes each pass, most stay inside their fat bounds
+		const uint32_t moved = std::max(1u, boxCount / 10);
+		Measure(writer, "Move", 10, [&]()
+			{
+				for (uint32_t i = 0; i < moved; i++)
+				{
+					uint32_t index = random() % boxCount;
+					float3 delta = float3(offset(random), offset(random), offset(random)) * 0.05f;
+					boxes[index] = BoundingBox(boxes[index].Min + delta, boxes[index].Max + delta);
+					tree.MoveProxy(proxies[index], boxes[index]);
+				}
+			});
+
+		const uint32_t queries = 1000;
+		std::vector<uint32_t> results;
+		results.reserve(boxCount);
+
+		BoundingBox queryBox(float3(-25.0f), float3(25.0f));
+		Measure(writer, "QueryBox", queries, [&]()
+			{
+				results.clear();
+				tree.Query([&](const BoundingBox& bounds) { return glm::all(glm::lessThanEqual(bounds.Min, queryBox.Max)) && glm::all(glm::lessThanEqual(queryBox.Min, bounds.Max)); },
+					[&](uint32_t proxy) { results.push_back(tree.GetUserData(proxy)); return true; });
+				KeepAlive(results.data());
+			});
+
+		mat4 view = glm::lookAtLH(float3(0.0f), float3(0.0f, 0.0f, 1.0f), float3(0.0f, 1.0f, 0.0f));
+		mat4 projection = glm::perspectiveFovLH(glm::radians(60.0f), 1920.0f, 1080.0f, 0.1f, 1000.0f);
+		Frustum frustum(projection * view);
+
+		Measure(writer, "QueryFrustum", 10, [&]()
+			{
+				results.clear();
+				tree.Query([&](const BoundingBox& bounds) { return frustum.Intersects(bounds); },
+					[&](uint32_t proxy) { results.push_back(tree.GetUserData(proxy)); return true; });
+				KeepAlive(results.data());
+			});
+
+		float3 direction = glm::normalize(float3(1.0f, 0.5f, 0.25f));
+		float3 inverseDirection = 1.0f / direction;
+		Measure(writer, "RayCast", queries, [&]()
+			{
+				float closest = 2000.0f;
+				tree.RayCast(float3(-500.0f), direction, closest, [&](uint32_t proxy, float)
+					{
+						float entry = 0.0f;
+						if (DynamicTree::RayIntersects(boxes[tree.GetUserData(proxy)], float3(-500.0f), inverseDirection, closest, entry))
+							closest = entry;
+
+						return closest;
+					});
+				KeepAlive(&closest);
+			});
+
+		writer.Write("boxes", boxCount);
+		writer.Write("height", (uint32_t)tree.GetHeight());
+		writer.EndObject();
+	}
+
+	bool MicroBenchmarks::RunFrameAllocatorBenchmarks(JsonWriter& writer, uint32_t frames)
+	{
+		const uint32_t elements = 1024;
+
+		auto frame = [&]()
+			{
+				FrameAllocator::Reset();
+
+				FrameVector<uint32_t> vector;
+				FrameMap<uint32_t, uint32_t> map;
+				FrameUnorderedMap<uint32_t, uint32_t> unorderedMap;
+
+				for (uint32_t i = 0; i < elements; i++)
+				{
+					vector.push_back(i);
+					map[i] = i;
+					unorderedMap[i] = i;
+				}
+
+				KeepAlive(vector.data());
+				KeepAlive(&map);
+				KeepAlive(&unorderedMap);
+			};
+
+		// One frame per page so both have grown their blocks before counting
+		frame();
+		frame();
+
+		writer.BeginObject("FrameAllocator");
+
+		AllocationScope scope;
+		Measure(writer, "Frame", frames, frame);
+		uint64_t heapAllocations = scope.GetCount();
+
+		writer.Write("elements", elements);
+		writer.Write("heap_allocations", heapAllocations);
+		writer.Write("frame_usage_bytes", (uint64_t)FrameAllocator::GetFrameUsage());
+		writer.Write("peak_usage_bytes", (uint64_t)FrameAllocator::GetPeakUsage());
+		writer.EndObject();
+
+		if (heapAllocations > 0)
+		{
+			Log::Error("[Bench] Frame containers made " + std::to_string(heapAllocations) + " heap allocations after warmup.");
+			return false;
+		}
+
+		return true;
+	}
+
+	template<typename Func>
+	void MicroBenchmarks::Measure(JsonWriter& writer, std::string_view name, uint32_t iterations, Func&& func)
+	{
+		auto start = std::chrono::steady_clock::now();
+
+		for (uint32_t i = 0; i < iterations; i++)
+			func();
+
+		double nanoseconds = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+		writer.BeginObject(name);
+		writer.Write("iterations", iterations);
+		writer.Write("ns_per_op", nanoseconds / (double)std::max(iterations, 1u));
+		writer.EndObject();
+	}
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+namespace Odyssey
+{
+	class JsonWriter;
+
+	// Small isolated benchmarks that don't need a scene
+	class MicroBenchmarks
+	{
+	public:
+		// Create, copy and destroy cost of Ref against std::shared_ptr
+		static void RunRefBenchmarks(JsonWriter& writer, uint32_t iterations);
+
+		// Batched frustum cull against testing each box on its own, boxes are scattered around the camera
+		static void RunCullingBenchmarks(JsonWriter& writer, uint32_t boxCount, uint32_t seed);
+
+		// Building, refitting and querying a dynamic AABB tree over the same kind of scattered boxes
+		static void RunTreeBenchmarks(JsonWriter& writer, uint32_t boxCount, uint32_t seed);
+
+		// Steady frames of frame containers, fails when any of them still reaches the heap once the arenas have grown
+		static bool RunFrameAllocatorBenchmarks(JsonWriter& writer, uint32_t frames);
+
+	private:
+		template<typename Func>
+		static void Measure(JsonWriter& writer, std::string_view name, uint32_t iterations, Func&& func);
+	};
+}
@@ -0,0 +1 @@
+#include "PCH.h"
\ No newline at end of file
@@ -0,0 +1,41 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <assert.h>
+#include <bitset>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <istream>
+#include <map>
+#include <random>
+#include <queue>
+#include <ranges>
+#include <set>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+	#define NOMINMAX
+	#include <Windows.h>
+#endif
+
+#include "Utils.h"
+#include "Globals.h"
+
+#include "glm.h"
+using namespace glm;
+
+#include <Jolt/Jolt.h>
+using namespace JPH;
+
+using Path = std::filesystem::path;
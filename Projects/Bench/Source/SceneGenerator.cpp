@@ -0,0 +1,139 @@
+#include "SceneGenerator.h"
+#include "Scene.h"
+#include "Transform.h"
+#include "RigidBody.h"
+#include "Colliders.h"
+#include "Animator.h"
+
+namespace Odyssey
+{
+	SceneGenerator::SceneGenerator(const Settings& settings)
+		: m_Settings(settings), m_Random(settings.Seed)
+	{
+
+	}
+
+	void SceneGenerator::Generate(Scene* scene)
+	{
+		m_Random.seed(m_Settings.Seed);
+		m_RigRoots.clear();
+
+		GenerateEntities(scene);
+		GenerateRigs(scene);
+		GenerateBodies(scene);
+	}
+
+	void SceneGenerator::Animate(float elapsed)
+	{
+		for (size_t i = 0; i < m_RigRoots.size(); i++)
+		{
+			Transform& transform = m_RigRoots[i].GetComponent<Transform>();
+			transform.SetRotation(float3(0.0f, elapsed + (float)i, 0.0f));
+		}
+	}
+
+	void SceneGenerator::GenerateEntities(Scene* scene)
+	{
+		std::uniform_real_distribution<float> position(-Scene_Extents, Scene_Extents);
+
+		for (uint32_t i = 0; i < m_Settings.Entities; i++)
+		{
+			GameObject gameObject = scene->CreateGameObject();
+			gameObject.SetName("Entity");
+
+			Transform& transform = gameObject.AddComponent<Transform>();
+			transform.SetPosition(position(m_Random), position(m_Random), position(m_Random));
+		}
+	}
+
+	void SceneGenerator::GenerateRigs(Scene* scene)
+	{
+		std::uniform_real_distribution<float> position(-Scene_Extents, Scene_Extents);
+
+		for (uint32_t i = 0; i < m_Settings.Rigs; i++)
+		{
+			GameObject rigRoot = scene->CreateGameObject();
+			rigRoot.SetName("Rig");
+
+			Transform& rootTransform = rigRoot.AddComponent<Transform>();
+			rootTransform.SetPosition(position(m_Random), 0.0f, position(m_Random));
+			m_RigRoots.push_back(rigRoot);
+
+			if (m_Settings.RigAsset)
+			{
+				Animator& animator = rigRoot.AddComponent<Animator>();
+				animator.SetRig(m_Settings.RigAsset);
+
+				if (m_Settings.BlueprintAsset)
+					animator.SetBlueprint(m_Settings.BlueprintAsset);
+
+				animator.Play();
+				continue;
+			}
+
+			// Without a rig asset, build a skeleton shaped hierarchy of short bone chains branching off the root
+			GameObject parent = rigRoot;
+			for (uint32_t bone = 0; bone < m_Settings.BonesPerRig; bone++)
+			{
+				if (bone % Bone_Chain_Length == 0)
+					parent = rigRoot;
+
+				GameObject boneObject = scene->CreateGameObject();
+				boneObject.SetName("Bone");
+				boneObject.SetParent(parent);
+
+				Transform& transform = boneObject.AddComponent<Transform>();
+				transform.SetPosition(0.0f, 0.25f, 0.0f);
+				transform.SetRotation(float3(0.0f, 0.0f, 0.1f));
+				parent = boneObject;
+			}
+		}
+	}
+
+	void SceneGenerator::GenerateBodies(Scene* scene)
+	{
+		if (m_Settings.Bodies == 0)
+			return;
+
+		// Static floor for the bodies to land and settle on
+		GameObject floor = scene->CreateGameObject();
+		floor.SetName("Floor");
+
+		Transform& floorTransform = floor.AddComponent<Transform>();
+		floorTransform.SetPosition(0.0f, -1.0f, 0.0f);
+
+		BoxCollider& floorCollider = floor.AddComponent<BoxCollider>();
+		floorCollider.SetExtents(float3(Scene_Extents, 1.0f, Scene_Extents));
+
+		RigidBody& floorBody = floor.AddComponent<RigidBody>();
+		floorBody.SetLayer(PhysicsLayer::Static);
+
+		// Drop the bodies in loose layers so they collide with each other on the way down
+		std::uniform_real_distribution<float> jitter(-0.25f, 0.25f);
+		uint32_t rowLength = (uint32_t)std::ceil(std::sqrt((float)Bodies_Per_Layer));
+
+		for (uint32_t i = 0; i < m_Settings.Bodies; i++)
+		{
+			uint32_t layer = i / Bodies_Per_Layer;
+			uint32_t slot = i % Bodies_Per_Layer;
+
+			float3 position;
+			position.x = ((float)(slot % rowLength) - rowLength * 0.5f) * 1.5f + jitter(m_Random);
+			position.y = 2.0f + (float)layer * 1.5f;
+			position.z = ((float)(slot / rowLength) - rowLength * 0.5f) * 1.5f + jitter(m_Random);
+
+			GameObject gameObject = scene->CreateGameObject();
+			gameObject.SetName("Body");
+
+			Transform& transform = gameObject.AddComponent<Transform>();
+			transform.SetPosition(position);
+
+			BoxCollider& collider = gameObject.AddComponent<BoxCollider>();
+			collider.SetExtents(float3(0.5f));
+
+			RigidBody& rigidBody = gameObject.AddComponent<RigidBody>();
+			rigidBody.SetLayer(PhysicsLayer::Dynamic);
+			rigidBody.SetMass(1.0f);
+		}
+	}
+}
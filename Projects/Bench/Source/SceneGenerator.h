@@ -0,0 +1,52 @@
+#pragma once
+#include "GUID.h"
+#include "GameObject.h"
+
+namespace Odyssey
+{
+	class Scene;
+
+	// Fills a scene with synthetic content so each system can be loaded in isolation
+	// The same seed always produces the same scene
+	class SceneGenerator
+	{
+	public:
+		struct Settings
+		{
+		public:
+			uint32_t Seed = 1337;
+			uint32_t Entities = 0;
+			uint32_t Rigs = 0;
+			uint32_t BonesPerRig = 64;
+			uint32_t Bodies = 0;
+
+			// When set every rig gets an animator playing this rig and blueprint
+			GUID RigAsset = GUID::Empty();
+			GUID BlueprintAsset = GUID::Empty();
+		};
+
+	public:
+		SceneGenerator(const Settings& settings);
+
+	public:
+		void Generate(Scene* scene);
+
+		// Moves the rig roots so the transform hierarchy has dirty work every frame
+		void Animate(float elapsed);
+
+	private:
+		void GenerateEntities(Scene* scene);
+		void GenerateRigs(Scene* scene);
+		void GenerateBodies(Scene* scene);
+
+	private:
+		Settings m_Settings;
+		std::mt19937 m_Random;
+		std::vector<GameObject> m_RigRoots;
+
+	private:
+		inline static constexpr float Scene_Extents = 100.0f;
+		inline static constexpr uint32_t Bone_Chain_Length = 8;
+		inline static constexpr uint32_t Bodies_Per_Layer = 32;
+	};
+}
@@ -2,7 +2,7 @@
 struct VertexInput
 {
     float3 Position : POSITION;
-    float3 Normal : NORMAL;
+    float2 Normal : NORMAL;
     float3 Tangent : TANGENT;
     float4 Color : COLOR;
     float2 TexCoord0 : TEXCOORD0;
@@ -26,13 +26,22 @@ cbuffer SceneData : register(b0)
     float4x4 LightViewProj;
 }
 
+// Vertex normals are octahedral encoded
+float3 OctahedralDecode(float2 encoded)
+{
+    float3 normal = float3(encoded.xy, 1.0f - abs(encoded.x) - abs(encoded.y));
+    if (normal.z < 0.0f)
+        normal.xy = (1.0f - abs(normal.yx)) * float2(normal.x >= 0.0f ? 1.0f : -1.0f, normal.y >= 0.0f ? 1.0f : -1.0f);
+    return normalize(normal);
+}
+
 VertexOutput main(VertexInput input)
 {
     VertexOutput output;
     
     float4 position = float4(input.Position, 1.0f);
     output.Position = mul(ViewProjection, position);
-    output.Normal = input.Normal;
+    output.Normal = OctahedralDecode(input.Normal);
     output.Tangent = input.Tangent;
     output.Color = input.Color;
     output.TexCoord0 = input.TexCoord0;
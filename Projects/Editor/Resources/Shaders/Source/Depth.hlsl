@@ -14,18 +14,23 @@ cbuffer SceneData : register(b0)
     float4x4 ViewProjection;
 }
 
-cbuffer ModelData : register(b1)
+struct ObjectData
 {
     float4x4 Model;
-}
+    uint BoneOffset;
+};
+
+StructuredBuffer<ObjectData> ObjectBuffer : register(t1);
+StructuredBuffer<uint> InstanceBuffer : register(t14);
 
-VertexOutput main(VertexInput input)
+VertexOutput main(VertexInput input, uint instanceID : SV_InstanceID)
 {
     VertexOutput output;
+    ObjectData objectData = ObjectBuffer[InstanceBuffer[instanceID]];
     float4 position = float4(input.Position, 1.0f);
     position.xyz = position.xyz;
     
-    output.Position = mul(Model, position);
+    output.Position = mul(objectData.Model, position);
     output.Position = mul(ViewProjection, output.Position);
     return output;
 }
\ No newline at end of file
@@ -4,21 +4,21 @@ cbuffer SceneData : register(b0)
     float4x4 ViewProjection;
 }
 
-cbuffer ModelData : register(b1)
+struct ObjectData
 {
     float4x4 Model;
-}
+    uint BoneOffset;
+};
 
-cbuffer SkinningData : register(b2)
-{
-    float4x4 Bones[128];
-}
+StructuredBuffer<ObjectData> ObjectBuffer : register(t1);
+StructuredBuffer<float4x4> BoneBuffer : register(t2);
+StructuredBuffer<uint> InstanceBuffer : register(t14);
 
 #pragma Vertex
 struct VertexInput
 {
     float3 Position : POSITION;
-    float4 BoneIndices : BLENDINDICES0;
+    uint4 BoneIndices : BLENDINDICES0;
     float4 BoneWeights : BLENDWEIGHT0;
 };
 
@@ -34,20 +34,21 @@ struct SkinningOutput
 };
 
 // Forward declarations
-SkinningOutput SkinVertex(VertexInput input);
+SkinningOutput SkinVertex(VertexInput input, uint boneOffset);
 
-VertexOutput main(VertexInput input)
+VertexOutput main(VertexInput input, uint instanceID : SV_InstanceID)
 {
     VertexOutput output;
+    ObjectData objectData = ObjectBuffer[InstanceBuffer[instanceID]];
     
-    SkinningOutput skinning = SkinVertex(input);
-    output.Position = mul(Model, skinning.Position);
+    SkinningOutput skinning = SkinVertex(input, objectData.BoneOffset);
+    output.Position = mul(objectData.Model, skinning.Position);
     output.Position = mul(ViewProjection, output.Position);
     
     return output;
 }
 
-SkinningOutput SkinVertex(VertexInput input)
+SkinningOutput SkinVertex(VertexInput input, uint boneOffset)
 {
     SkinningOutput output;
     output.Position = float4(0, 0, 0, 1);
@@ -56,7 +57,7 @@ SkinningOutput SkinVertex(VertexInput input)
     
     for (int i = 0; i < 4; i++)
     {
-        output.Position += mul(Bones[input.BoneIndices[i]], vertexPosition) * input.BoneWeights[i];
+        output.Position += mul(BoneBuffer[boneOffset + input.BoneIndices[i]], vertexPosition) * input.BoneWeights[i];
     }
     
     return output;
@@ -7,6 +7,7 @@
 #include "OdysseyTime.h"
 #include "Random.h"
 #include "ShaderCompiler.h"
+#include "Shader.h"
 #include "Project.h"
 #include "Renderer.h"
 #include "DebugRenderer.h"
@@ -17,6 +18,7 @@
 #include "FileManager.h"
 #include "Input.h"
 #include "PhysicsSystem.h"
+#include "FrameAllocator.h"
 
 namespace Odyssey
 {
@@ -28,6 +30,9 @@ namespace Odyssey
 		Random::Initialize();
 		FileManager::Init();
 
+		// Log whenever a frame needs more transient memory than any frame before it
+		FrameAllocator::SetReportPeakUsage(true);
+
 		// Register for event listeners
 		m_BuildCompleteListener = EventSystem::Listen<BuildCompleteEvent>
 			([this](BuildCompleteEvent* event) { OnBuildComplete(event); });
@@ -99,10 +104,21 @@ namespace Odyssey
 
 			if (m_TimeSinceLastUpdate > MaxFPS)
 			{
+				// Physics accumulates the time since the last frame, not since the last loop iteration
+				float frameTime = m_TimeSinceLastUpdate;
 				m_TimeSinceLastUpdate = 0.0f;
 
+				// Rewind the transient per-frame allocations
+				FrameAllocator::Reset();
+
 				FileManager::Get().Dispatch();
 
+				// Recompile the shaders edited since the last frame as one batch
+				Shader::ProcessModifiedShaders();
+
+				// Upload any assets that finished decoding on the loader threads
+				AssetManager::FinalizeAsyncLoads();
+
 				// Process any changes made to the user's managed dll
 				m_ScriptCompiler->Process();
 				GUIManager::Update();
@@ -114,7 +130,10 @@ namespace Odyssey
 				if (m_UpdateScripts)
 					SceneManager::Update();
 
-				PhysicsSystem::Update();
+				PhysicsSystem::Update(frameTime);
+
+				// Deliver the events queued during the frame, duplicates have already been coalesced
+				EventSystem::Flush();
 				
 				DebugRenderer::Update();
 				running = Renderer::Update();
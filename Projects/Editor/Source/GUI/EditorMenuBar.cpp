@@ -1,5 +1,6 @@
 #include "EditorMenuBar.h"
 #include "imgui.h"
+#include "BinaryScene.h"
 #include "FileDialogs.h"
 #include "SceneManager.h"
 #include "GUIManager.h"
@@ -45,6 +46,16 @@ namespace Odyssey
 						SceneManager::SaveActiveScene(scenePath);
 					}
 				}
+				if (ImGui::MenuItem("Export Binary Scene..."))
+				{
+					const Path& scenePath = FileDialogs::SaveFile("Odyssey Binary Scene", BinaryScene::Extension);
+
+					if (!scenePath.empty())
+					{
+						if (Scene* scene = SceneManager::GetActiveScene())
+							scene->SaveTo(scenePath);
+					}
+				}
 
 				ImGui::EndMenu();
 			}
@@ -131,6 +131,8 @@ namespace Odyssey
 
 			m_BlueprintDrawer = AssetFieldDrawer("Blueprint", animator->GetBlueprintAsset(), AnimationBlueprint::Type,
 				[this](GUID guid) { OnBlueprintModified(guid); });
+
+			m_ExposeBonesDrawer = BoolDrawer("Expose Bones", animator->IsExposingBones());
 		}
 	}
 
@@ -155,6 +157,13 @@ namespace Odyssey
 			m_RigDrawer.Draw();
 			m_BlueprintDrawer.Draw();
 
+			if (m_ExposeBonesDrawer.Draw())
+			{
+				if (Animator* animator = m_GameObject.TryGetComponent<Animator>())
+					animator->SetExposeBones(m_ExposeBonesDrawer.GetValue());
+				modified = true;
+			}
+
 			if (ImGui::Button("Play"))
 			{
 				if (Animator* animator = m_GameObject.TryGetComponent<Animator>())
@@ -1319,6 +1328,8 @@ namespace Odyssey
 			m_MipMapDrawer = BoolDrawer("Mip Maps Enabled", m_Texture->GetMipMapsEnabled());
 			m_MipBiasDrawer = FloatDrawer("Mip Bias", m_Texture->GetMipBias());
 			m_MaxMipCountDrawer = IntDrawer<uint32_t>("Max Mip Count", m_Texture->GetMaxMipCount());
+			m_UsageDrawer = EnumDrawer<TextureUsage>("Usage", m_Texture->GetUsage());
+			m_CompressionDrawer = EnumDrawer<TextureCompression>("Compression", m_Texture->GetCompression());
 			m_PreviewTexture = Renderer::AddImguiTexture(m_Texture);
 		}
 	}
@@ -1364,6 +1375,18 @@ namespace Odyssey
 			m_Texture->Save();
 		}
 
+		if (m_UsageDrawer.Draw())
+		{
+			m_Texture->SetUsage(m_UsageDrawer.GetValue());
+			m_Texture->Save();
+		}
+
+		if (m_CompressionDrawer.Draw())
+		{
+			m_Texture->SetCompression(m_CompressionDrawer.GetValue());
+			m_Texture->Save();
+		}
+
 		static float bottomPaneHeight = 400.0f;
 		static float topPaneHeight = 800.0f;
 		Splitter(false, 4.0f, &bottomPaneHeight, &topPaneHeight, 50.0f, 50.0f);
@@ -49,6 +49,7 @@ namespace Odyssey
 		GameObject m_GameObject;
 		AssetFieldDrawer m_RigDrawer;
 		AssetFieldDrawer m_BlueprintDrawer;
+		BoolDrawer m_ExposeBonesDrawer;
 	};
 
 	class CameraInspector : public Inspector
@@ -476,6 +477,8 @@ namespace Odyssey
 		BoolDrawer m_MipMapDrawer;
 		FloatDrawer m_MipBiasDrawer;
 		IntDrawer<uint32_t> m_MaxMipCountDrawer;
+		EnumDrawer<TextureUsage> m_UsageDrawer;
+		EnumDrawer<TextureCompression> m_CompressionDrawer;
 		uint64_t m_PreviewTexture;
 	};
 
@@ -102,12 +102,21 @@ namespace Odyssey
 		m_SceneViewPass->SetRenderTarget(m_RenderTarget);
 		m_TransparentPass->SetRenderTarget(m_RenderTarget);
 
+		bool clicked = ImGui::IsItemClicked(ImGuiMouseButton_Left);
+		float2 imageMin = ImGui::GetItemRectMin();
+		float2 imageSize = ImGui::GetItemRectSize();
+
 		// Draw the menu bar
 		DrawMenuBar(startCursor);
 
 		// Render gizmos
 		RenderGizmos();
 
+		// Clicks on the gizmo belong to the gizmo
+		bool overGizmo = ImGuizmo::IsUsing() || (m_SelectedGO.IsValid() && ImGuizmo::IsOver());
+		if (clicked && !overGizmo)
+			PickGameObject(imageMin, imageSize);
+
 		End();
 		return modified;
 	}
@@ -287,6 +296,35 @@ namespace Odyssey
 		}
 	}
 
+	void SceneViewWindow::PickGameObject(float2 imageMin, float2 imageSize)
+	{
+		if (!m_ActiveScene || !m_GameObject.IsValid() || imageSize.x <= 0.0f || imageSize.y <= 0.0f)
+			return;
+
+		Camera& camera = m_GameObject.GetComponent<Camera>();
+		Transform& transform = m_GameObject.GetComponent<Transform>();
+
+		// The scene view is rendered with a flipped viewport so the top of the image is +y
+		float2 uv = (float2(ImGui::GetMousePos()) - imageMin) / imageSize;
+		float4 clip = float4(uv.x * 2.0f - 1.0f, 1.0f - uv.y * 2.0f, 0.5f, 1.0f);
+
+		float4 world = glm::inverse(camera.GetProjection() * camera.GetInverseView()) * clip;
+		float3 origin = float3(transform.GetWorldMatrix()[3]);
+		float3 direction = float3(world) / world.w - origin;
+
+		RaycastHit hit;
+		if (!m_ActiveScene->GetSpatialIndex().Raycast(origin, direction, camera.GetFarClip(), hit))
+			return;
+
+		if (PropertiesComponent* properties = hit.Object.TryGetComponent<PropertiesComponent>())
+		{
+			GUISelection selection;
+			selection.Type = GameObject::Type;
+			selection.GUID = properties->GUID;
+			EventSystem::Dispatch<GUISelectionChangedEvent>(selection);
+		}
+	}
+
 	void SceneViewWindow::UpdateCameraController()
 	{
 		const float speed = 20.0f;
@@ -38,6 +38,7 @@ namespace Odyssey
 		void DestroyRenderTexture();
 		void DrawMenuBar(float2 menuPosition);
 		void RenderGizmos();
+		void PickGameObject(float2 imageMin, float2 imageSize);
 		void UpdateCameraController();
 		void UpdateGizmosInput();
 
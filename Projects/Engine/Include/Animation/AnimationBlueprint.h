@@ -2,6 +2,7 @@
 #include "Blueprint.h"
 #include "Asset.h"
 #include "AnimationLink.h"
+#include "AnimationRig.h"
 #include "AnimationState.h"
 #include "BoneKeyframe.h"
 #include "RawBuffer.h"
@@ -33,7 +34,7 @@ namespace Odyssey
 		virtual void Update() override;
 
 	public:
-		const std::map<std::string, BlendKey>& GetKeyframe();
+		const std::vector<BlendKey>& GetKeyframe(Ref<AnimationRig>& rig);
 
 	public:
 		Ref<AnimationStateNode> AddAnimationState(std::string name);
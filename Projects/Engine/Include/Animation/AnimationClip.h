@@ -1,6 +1,6 @@
 #pragma once
 #include "Asset.h"
-#include "AnimationClipTimeline.h"
+#include "BoneKeyframe.h"
 
 namespace Odyssey
 {
@@ -9,31 +9,43 @@ namespace Odyssey
 	class AnimationClip : public Asset
 	{
 		CLASS_DECLARATION(Odyssey, AnimationClip)
+	public:
+		struct LoadData
+		{
+			Ref<SourceModel> Source;
+		};
+
 	public:
 		AnimationClip(const Path& assetPath);
 		AnimationClip(const Path& assetPath, Ref<SourceModel> sourceModel);
+		AnimationClip(const Path& assetPath, LoadData& loadData);
 
 	public:
 		virtual void Save() override;
 		void Load();
 
 	public:
-		std::map<std::string, BlendKey>& BlendKeys(float deltaTime);
-		void Reset();
+		// Imports the source model, safe to call from a loader thread
+		static void Decode(const Path& assetPath, LoadData& loadData);
+
+	public:
+		void Sample(size_t prevFrame, size_t nextFrame, float blendFactor, const std::vector<int32_t>& boneTracks, std::vector<BlendKey>& pose);
+		size_t FindFrame(float time);
+		int32_t GetTrackIndex(const std::string& boneName);
 
 	public:
 		void SetClipIndex(size_t index);
 
 	public:
-		std::map<std::string, BoneKeyframe>& GetBoneKeyframes() { return m_BoneKeyframes; }
 		float GetDuration() { return m_Duration; }
-		float GetFrameTime(size_t frameIndex);
-		size_t GetFrameCount();
-		float GetProgress();
+		float GetFrameTime(size_t frameIndex) { return frameIndex < m_FrameTimes.size() ? m_FrameTimes[frameIndex] : 0.0f; }
+		size_t GetFrameCount() { return m_FrameTimes.size(); }
+		size_t GetTrackCount() { return m_TrackNames.size(); }
 		size_t GetClipIndex() { return m_ClipIndex; }
 
 	private:
 		void LoadFromSource(Ref<SourceModel> source);
+		void Compile(const std::map<std::string, BoneKeyframe>& boneKeyframes);
 		void SaveToDisk(const Path& assetPath);
 
 	private:
@@ -42,8 +54,15 @@ namespace Odyssey
 	private:
 		std::string m_Name;
 		float m_Duration;
-		std::map<std::string, BoneKeyframe> m_BoneKeyframes;
-		AnimationClipTimeline m_Timeline;
 		size_t m_ClipIndex = 0;
+
+	private: // Compiled tracks
+		// Keys are stored frame-major so sampling a frame reads one contiguous row per channel
+		std::vector<std::string> m_TrackNames;
+		std::unordered_map<std::string, int32_t> m_TrackLookup;
+		std::vector<float> m_FrameTimes;
+		std::vector<float3> m_Positions;
+		std::vector<quat> m_Rotations;
+		std::vector<float3> m_Scales;
 	};
 }
\ No newline at end of file
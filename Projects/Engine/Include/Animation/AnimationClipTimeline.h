@@ -14,11 +14,15 @@ namespace Odyssey
 		AnimationClipTimeline(AnimationClip* animationClip);
 
 	public:
-		std::map<std::string, BlendKey>& BlendKeys(float deltaTime);
+		void Sample(float deltaTime, const std::vector<int32_t>& boneTracks, std::vector<BlendKey>& pose);
 		void Reset();
 
 	public:
 		float GetTime() { return m_CurrentTime; }
+		float GetProgress() { return m_Duration > 0.0f ? m_CurrentTime / m_Duration : 0.0f; }
+
+	private:
+		void Seek();
 
 	private:
 		AnimationClip* m_AnimationClip = nullptr;
@@ -26,7 +30,5 @@ namespace Odyssey
 		float m_CurrentTime = 0.0;
 		size_t m_PrevFrame = 0;
 		size_t m_NextFrame = 1;
-		std::unordered_map<std::string, glm::mat4> m_BoneKeys;
-		std::map<std::string, BlendKey> m_BlendKeys;
 	};
 }
\ No newline at end of file
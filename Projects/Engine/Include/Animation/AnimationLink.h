@@ -21,7 +21,7 @@ namespace Odyssey
 		GreaterOrEqual = 4,
 	};
 
-	class AnimationCondition
+	class AnimationCondition : public LocalRefCounted
 	{
 	public:
 		AnimationCondition() = default;
@@ -56,7 +56,7 @@ namespace Odyssey
 		float m_BlendTime = 1.0f;
 	};
 
-	class AnimationLink
+	class AnimationLink : public LocalRefCounted
 	{
 	public:
 		AnimationLink(Ref<AnimationState> start, Ref<AnimationState> end);
@@ -1,5 +1,6 @@
 #pragma once
 #include "RawBuffer.h"
+#include "Ref.h"
 
 namespace Odyssey
 {
@@ -11,7 +12,7 @@ namespace Odyssey
 		Trigger = 3,
 	};
 
-	struct AnimationProperty
+	struct AnimationProperty : public LocalRefCounted
 	{
 	public:
 		AnimationProperty() = default;
@@ -9,16 +9,28 @@ namespace Odyssey
 	class AnimationRig : public Asset
 	{
 		CLASS_DECLARATION(Odyssey, AnimationRig)
+	public:
+		struct LoadData
+		{
+			Ref<SourceModel> Source;
+		};
+
 	public:
 		AnimationRig(const Path& assetPath);
 		AnimationRig(const Path& assetPath, Ref<SourceModel> source);
+		AnimationRig(const Path& assetPath, LoadData& loadData);
 
 	public:
 		virtual void Save() override;
 		void Load();
 
+	public:
+		// Imports the source model, safe to call from a loader thread
+		static void Decode(const Path& assetPath, LoadData& loadData);
+
 	public:
 		const std::vector<Bone>& GetBones() { return m_Bones; }
+		const std::vector<uint32_t>& GetEvaluationOrder() { return m_EvaluationOrder; }
 		const glm::mat4& GetGlobalMatrix() { return m_GlobalMatrix; }
 		const glm::mat4 GetRotationOffset() { return m_RotationOffset; }
 
@@ -26,6 +38,7 @@ namespace Odyssey
 
 	private:
 		void LoadFromSource(Ref<SourceModel> source);
+		void BuildEvaluationOrder();
 		void SaveToDisk(const Path& assetPath);
 
 	private:
@@ -34,6 +47,7 @@ namespace Odyssey
 	private:
 		std::uint32_t m_RootBone;
 		std::vector<Bone> m_Bones;
+		std::vector<uint32_t> m_EvaluationOrder;
 		glm::mat4 m_GlobalMatrix;
 		glm::mat4 m_RotationOffset;
 		glm::mat4 m_ScaleOffset;
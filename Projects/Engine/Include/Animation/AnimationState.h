@@ -1,6 +1,8 @@
 #pragma once
 #include "AnimationClip.h"
+#include "AnimationClipTimeline.h"
 #include "AnimationProperty.h"
+#include "AnimationRig.h"
 #include "BoneKeyframe.h"
 #include "GUID.h"
 #include "Ref.h"
@@ -8,7 +10,7 @@
 
 namespace Odyssey
 {
-	class AnimationState
+	class AnimationState : public LocalRefCounted
 	{
 	public:
 		AnimationState() = default;
@@ -16,8 +18,8 @@ namespace Odyssey
 		AnimationState(GUID guid, std::string_view name, GUID animationClip);
 
 	public:
-		std::map<std::string, BlendKey>& Evaluate();
-		std::map<std::string, BlendKey>& Evaluate(Ref<AnimationState>& endState, float blendFactor);
+		const std::vector<BlendKey>& Evaluate(Ref<AnimationRig>& rig);
+		const std::vector<BlendKey>& Evaluate(Ref<AnimationRig>& rig, Ref<AnimationState>& prevState, float blendFactor);
 		void Reset();
 
 	public:
@@ -25,6 +27,7 @@ namespace Odyssey
 		GUID GetGUID() { return m_GUID; }
 		std::string_view GetName();
 		Ref<AnimationClip> GetClip();
+		float GetProgress() { return m_Timeline.GetProgress(); }
 
 	public:
 		void SetEntry(bool entry) { m_IsEntry = entry; }
@@ -32,10 +35,20 @@ namespace Odyssey
 		void SetName(std::string_view name) { m_Name = name; }
 		void SetClip(GUID guid);
 
+	private:
+		void BindRig(Ref<AnimationRig>& rig);
+
 	private:
 		Ref<AnimationClip> m_AnimationClip;
+		AnimationClipTimeline m_Timeline;
 		std::string m_Name;
 		GUID m_GUID;
 		bool m_IsEntry = false;
+
+	private:
+		// Rig bone index to clip track index, resolved once per rig
+		GUID m_BoundRig;
+		std::vector<int32_t> m_BoneTracks;
+		std::vector<BlendKey> m_Pose;
 	};
 }
\ No newline at end of file
@@ -33,9 +33,9 @@ namespace Odyssey
 		void SortKeys();
 
 	public:
-		const std::vector<PositionKey>& GetPositionKeys() { return m_PositionKeys; }
-		const std::vector<RotationKey>& GetRotationKeys() { return m_RotationKeys; }
-		const std::vector<ScaleKey>& GetScaleKeys() { return m_ScaleKeys; }
+		const std::vector<PositionKey>& GetPositionKeys() const { return m_PositionKeys; }
+		const std::vector<RotationKey>& GetRotationKeys() const { return m_RotationKeys; }
+		const std::vector<ScaleKey>& GetScaleKeys() const { return m_ScaleKeys; }
 		const double GetFrameTime(size_t frameIndex) { return m_PositionKeys[frameIndex].Time; }
 		std::string_view GetName() { return m_Name; }
 
@@ -6,7 +6,7 @@
 
 namespace Odyssey
 {
-	class SourceAsset
+	class SourceAsset : public RefCounted
 	{
 	public:
 		SourceAsset() = default;
@@ -51,7 +51,7 @@ namespace Odyssey
 		std::vector<Path> m_Dependencies;
 	};
 
-	class Asset
+	class Asset : public RefCounted
 	{
 	public:
 		Asset() = default;
@@ -61,6 +61,10 @@ namespace Odyssey
 		void SerializeMetadata(AssetSerializer& serializer);
 		void Load();
 
+	public:
+		// Reads the source asset guid without constructing the asset, used by loader threads
+		static GUID ReadSourceAsset(const Path& assetPath);
+
 	public:
 		virtual void Save() = 0;
 
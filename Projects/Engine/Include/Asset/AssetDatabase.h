@@ -2,6 +2,7 @@
 #include "GUID.h"
 #include "FileManager.h"
 #include "AssetRegistry.h"
+#include "ReadWriteLock.h"
 
 namespace Odyssey
 {
@@ -11,6 +12,9 @@ namespace Odyssey
 		std::vector<Path> ExclusionPaths;
 		std::vector<std::string> Extensions;
 		std::map<std::string, std::string> SourceExtensionsMap;
+
+		// Persistent scan index, scanning is not incremental across sessions when empty
+		Path IndexPath;
 	};
 
 	struct AssetMetadata
@@ -35,7 +39,13 @@ namespace Odyssey
 
 	private:
 		void ScanForAssets();
-		void ScanForSourceAssets();
+		bool ScanFile(const std::filesystem::directory_entry& dirEntry);
+		void RemoveAsset(const Path& path);
+		void MoveAsset(const Path& oldPath, const Path& newPath);
+		bool IsExcluded(const Path& path);
+
+		// Every tracked path inside the directory, the directory itself does not need to exist
+		std::vector<Path> GetPathsInDirectory(const Path& directory);
 
 	public:
 		void AddAsset(GUID guid, const Path& path, const std::string& assetName, const std::string& assetType, bool sourceAsset);
@@ -53,12 +63,33 @@ namespace Odyssey
 		std::string GUIDToAssetType(GUID guid);
 		GUID AssetPathToGUID(const Path& assetPath);
 		std::vector<GUID> GetGUIDsOfAssetType(const std::string& assetType);
-		const AssetMetadata& GetMetadata(GUID guid);
+		AssetMetadata GetMetadata(GUID guid);
 
 	private:
+		void InsertAsset(GUID guid, const Path& path, const std::string& assetName, const std::string& assetType, bool sourceAsset);
 		void AddRegistryAsset(GUID guid, const Path& path, const std::string& assetName, const std::string& assetType, bool sourceAsset);
 		void OnFileAction(const Path& oldFilename, const Path& newFilename, FileActionType fileAction);
 
+	private:
+		void SaveChanges();
+		void LoadIndex();
+		void SaveIndex();
+
+	private:
+		struct IndexEntry
+		{
+		public:
+			GUID Guid;
+			std::string Name;
+			std::string Type;
+			int64_t WriteTime = 0;
+			uint64_t FileSize = 0;
+			bool IsSourceAsset = false;
+		};
+
+		inline static constexpr uint32_t Index_Magic = 0x58444941; // AIDX
+		inline static constexpr uint32_t Index_Version = 1;
+
 	protected:
 		TrackingID m_TrackingID;
 		SearchOptions m_SearchOptions;
@@ -70,5 +101,13 @@ namespace Odyssey
 		std::map<Path, GUID> m_AssetPathToGUID;
 		// [AssetType, List<GUID>]
 		std::map<std::string, std::vector<GUID>> m_AssetTypeToGUIDs;
+
+		// [AssetPath, IndexEntry]
+		std::map<Path, IndexEntry> m_Index;
+		bool m_IndexDirty = false;
+		bool m_RegistryDirty = false;
+
+		// Guards the lookups so assets can be resolved from loader threads
+		ReadWriteLock m_Lock;
 	};
 }
\ No newline at end of file
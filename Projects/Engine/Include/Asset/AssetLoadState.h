@@ -0,0 +1,53 @@
+#pragma once
+#include <condition_variable>
+#include <mutex>
+#include "GUID.h"
+
+namespace Odyssey
+{
+	class Asset;
+
+	// Shared between the loader thread that decodes an asset and the main thread that finalizes it
+	class AssetLoadState
+	{
+	public:
+		GUID Guid;
+		std::function<void()> Decode;
+		std::function<Ref<Asset>()> Finalize;
+
+	public: // Main thread only
+		Ref<Asset> Result;
+		bool Finalized = false;
+
+	public:
+		void RunDecode()
+		{
+			if (Decode)
+				Decode();
+
+			{
+				std::scoped_lock lock(m_Mutex);
+				m_Decoded = true;
+			}
+
+			m_Condition.notify_all();
+		}
+
+		void WaitForDecode()
+		{
+			std::unique_lock lock(m_Mutex);
+			m_Condition.wait(lock, [this]() { return m_Decoded; });
+		}
+
+		bool IsDecoded()
+		{
+			std::scoped_lock lock(m_Mutex);
+			return m_Decoded;
+		}
+
+	private:
+		std::mutex m_Mutex;
+		std::condition_variable m_Condition;
+		bool m_Decoded = false;
+	};
+}
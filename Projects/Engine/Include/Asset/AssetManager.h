@@ -5,7 +5,10 @@
 #include "GUID.h"
 #include "AssetRegistry.h"
 #include "AssetList.h"
+#include "AssetLoadState.h"
 #include "Material.h"
+#include "ReadWriteLock.h"
+#include "ThreadPool.h"
 
 namespace Odyssey
 {
@@ -23,6 +26,9 @@ namespace Odyssey
 	class SourceModel;
 	class SourceTexture;
 
+	template<typename T>
+	class AssetFuture;
+
 	class AssetManager
 	{
 	public:
@@ -37,6 +43,10 @@ namespace Odyssey
 	public:
 		static void CreateDatabase(Settings settings);
 
+	public:
+		static BinaryBuffer LoadBinaryData(GUID guid);
+		static void SaveBinaryData(GUID guid, BinaryBuffer& buffer);
+
 	public:
 		template<typename T, typename... Args>
 		static Ref<T> CreateAsset(const Path& assetPath, Args&&... params)
@@ -47,10 +57,13 @@ namespace Odyssey
 			GUID guid = GUID::New();
 			std::string name = assetPath.filename().replace_extension("").string();
 
-			s_LoadedAssets.insert(guid);
+			Ref<Asset> asset = MakeRef<T>(assetPath, std::forward<Args>(params)...);
 
-			Ref<Asset> asset = s_Assets.emplace_back(new T(assetPath, std::forward<Args>(params)...));
+			s_AssetLock.Lock(LockState::Write);
+			s_LoadedAssets.insert(guid);
+			s_Assets.push_back(asset);
 			s_GUIDToIndex[guid] = s_Assets.size() - 1;
+			s_AssetLock.Unlock(LockState::Write);
 
 			// Set asset data
 			asset->m_GUID = guid;
@@ -75,33 +88,53 @@ namespace Odyssey
 			if (sourcePath.empty())
 				return nullptr;
 
-			Ref<T> sourceAsset = new T(sourcePath);
+			Ref<T> sourceAsset = MakeRef<T>(sourcePath);
 
 			// Set the metadata for the source asset
-			const auto& metadata = s_AssetDatabase->GetMetadata(guid);
+			AssetMetadata metadata = s_AssetDatabase->GetMetadata(guid);
 			sourceAsset->SetMetadata(guid, metadata.AssetName, metadata.AssetType);
 
 			return sourceAsset;
 		}
 
+		// Synchronous loads decode on the calling thread, which must be the main thread
 		template<typename T>
 		static Ref<T> LoadAsset(GUID guid)
 		{
-			if (s_LoadedAssets.contains(guid))
-				return s_Assets[s_GUIDToIndex[guid]].As<T>();
+			bool created = false;
+			Ref<Asset> asset;
+			std::shared_ptr<AssetLoadState> loadState = AcquireLoadState<T>(guid, asset, created);
 
-			// Convert the guid to a path
-			Path assetPath = s_AssetDatabase->GUIDToAssetPath(guid);
+			if (!loadState)
+				return asset.As<T>();
 
-			s_LoadedAssets.insert(guid);
+			if (created)
+				loadState->RunDecode();
 
-			Ref<Asset>& asset = s_Assets.emplace_back(new T(assetPath));
-			s_GUIDToIndex[guid] = s_Assets.size() - 1;
+			// Either finishes our own load or joins one already in flight
+			return CompleteLoad(loadState).As<T>();
+		}
 
-			// Load and return the asset
-			return asset.As<T>();
+		// Decodes on a worker thread, the GPU work is finalized by FinalizeAsyncLoads or AssetFuture::Get
+		template<typename T>
+		static AssetFuture<T> LoadAssetAsync(GUID guid)
+		{
+			bool created = false;
+			Ref<Asset> asset;
+			std::shared_ptr<AssetLoadState> loadState = AcquireLoadState<T>(guid, asset, created);
+
+			if (!loadState)
+				return AssetFuture<T>(asset);
+
+			if (created)
+				ThreadPool::Submit([loadState]() { loadState->RunDecode(); });
+
+			return AssetFuture<T>(loadState);
 		}
 
+		// Finalizes every async load whose decode has finished, called once per frame on the main thread
+		static void FinalizeAsyncLoads();
+
 		template<typename T>
 		static Ref<T> LoadAsset(const Path& assetPath)
 		{
@@ -112,7 +145,7 @@ namespace Odyssey
 		template<typename T>
 		static Ref<T> LoadInstance(const Path& assetPath)
 		{
-			return Ref<T>(new T(assetPath));
+			return MakeRef<T>(assetPath);
 		}
 
 		template<typename T>
@@ -122,11 +155,69 @@ namespace Odyssey
 			return LoadInstance<T>(s_AssetDatabase->GUIDToAssetPath(guid));
 		}
 
+	private:
+		template<typename T>
+		static std::shared_ptr<AssetLoadState> AcquireLoadState(GUID guid, Ref<Asset>& loadedAsset, bool& created)
+		{
+			static_assert(std::is_base_of<Asset, T>::value, "T is not a dervied class of Asset.");
+
+			// Convert the guid to a path
+			Path assetPath = s_AssetDatabase->GUIDToAssetPath(guid);
+
+			std::shared_ptr<AssetLoadState> loadState;
+
+			s_AssetLock.Lock(LockState::Write);
+
+			if (s_LoadedAssets.contains(guid))
+			{
+				loadedAsset = s_Assets[s_GUIDToIndex[guid]];
+			}
+			else if (s_PendingLoads.contains(guid))
+			{
+				// Share the load already in flight
+				loadState = s_PendingLoads[guid];
+			}
+			else
+			{
+				loadState = CreateLoadState<T>(guid, assetPath);
+				s_PendingLoads[guid] = loadState;
+				created = true;
+			}
+
+			s_AssetLock.Unlock(LockState::Write);
+
+			return loadState;
+		}
+
+		template<typename T>
+		static std::shared_ptr<AssetLoadState> CreateLoadState(GUID guid, const Path& assetPath)
+		{
+			std::shared_ptr<AssetLoadState> loadState = std::make_shared<AssetLoadState>();
+			loadState->Guid = guid;
+
+			if constexpr (requires { typename T::LoadData; })
+			{
+				// Split loads decode CPU data off-thread and only upload on the main thread
+				std::shared_ptr<typename T::LoadData> loadData = std::make_shared<typename T::LoadData>();
+				loadState->Decode = [assetPath, loadData]() { T::Decode(assetPath, *loadData); };
+				loadState->Finalize = [assetPath, loadData]() { return Ref<Asset>(MakeRef<T>(assetPath, *loadData)); };
+			}
+			else
+			{
+				loadState->Finalize = [assetPath]() { return Ref<Asset>(MakeRef<T>(assetPath)); };
+			}
+
+			return loadState;
+		}
+
+		static Ref<Asset> CompleteLoad(std::shared_ptr<AssetLoadState> loadState);
+
 	public:
 		static std::vector<GUID> GetAssetsOfType(const std::string& assetType);
 
 	public:
 		static GUID PathToGUID(const Path& path);
+		static Path GUIDToPath(GUID guid);
 		static std::string GUIDToName(GUID guid);
 		static std::string GUIDToAssetType(GUID guid);
 
@@ -140,10 +231,46 @@ namespace Odyssey
 	private: // Assets
 		inline static Path s_AssetsDirectory;
 		inline static std::unique_ptr<AssetDatabase> s_AssetDatabase;
+		inline static std::unique_ptr<BinaryCache> s_BinaryCache;
 
 	private:
+		template<typename T>
+		friend class AssetFuture;
+
+		// Guards the loaded and pending asset lookups
+		inline static ReadWriteLock s_AssetLock;
 		inline static std::set<GUID> s_LoadedAssets;
 		inline static std::vector<Ref<Asset>> s_Assets;
 		inline static std::map<GUID, size_t> s_GUIDToIndex;
+		inline static std::map<GUID, std::shared_ptr<AssetLoadState>> s_PendingLoads;
+	};
+
+	template<typename T>
+	class AssetFuture
+	{
+	public:
+		AssetFuture() = default;
+		AssetFuture(Ref<Asset> asset) : m_Asset(asset) { }
+		AssetFuture(std::shared_ptr<AssetLoadState> loadState) : m_LoadState(loadState) { }
+
+	public:
+		// True once the asset has been finalized on the main thread
+		bool IsReady() { return m_Asset || (m_LoadState && m_LoadState->Finalized); }
+
+		// Waits for the decode and finalizes the asset if it has not been yet, main thread only
+		Ref<T> Get()
+		{
+			if (!m_Asset && m_LoadState)
+			{
+				m_Asset = AssetManager::CompleteLoad(m_LoadState);
+				m_LoadState.reset();
+			}
+
+			return m_Asset.As<T>();
+		}
+
+	private:
+		Ref<Asset> m_Asset;
+		std::shared_ptr<AssetLoadState> m_LoadState;
 	};
 }
\ No newline at end of file
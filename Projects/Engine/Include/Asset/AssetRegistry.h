@@ -24,6 +24,7 @@ namespace Odyssey
 
 	public:
 		void AddAsset(const std::string& name, const std::string& type, const Path& path, GUID guid);
+		void RemoveAsset(GUID guid);
 		void UpdateAssetName(GUID guid, const std::string& name);
 		void UpdateAssetPath(GUID guid, const Path& path);
 		void UpdateAssetPath(const Path& oldPath, const Path& newPath);
@@ -42,5 +43,10 @@ namespace Odyssey
 		Path RegistryPath;
 		std::vector<AssetEntry> Entries;
 		TrackingID m_TrackingID;
+
+	private:
+		// Lookups so dupe checks stay cheap on large projects
+		std::set<GUID> m_GUIDs;
+		std::set<Path> m_Paths;
 	};
 }
\ No newline at end of file
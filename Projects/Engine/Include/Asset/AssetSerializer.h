@@ -67,6 +67,7 @@ namespace Odyssey
 			}
 		}
 
+		void RemoveChild(size_t index) { m_Node.remove_child(index); }
 		void SetMap() { m_Node |= ryml::MAP; }
 		void SetSequence() { m_Node |= ryml::SEQ; }
 
@@ -104,6 +105,15 @@ namespace Odyssey
 			}
 		}
 
+		AssetDeserializer(const char* data, size_t size)
+		{
+			// Parse yaml that is already in memory, such as a block embedded in a binary file
+			m_Tree = ryml::parse_in_arena(ryml::csubstr(data, size));
+			m_RootRef = m_Tree.rootref();
+			m_RootNode = SerializationNode("Root", m_RootRef);
+			m_DataParsed = true;
+		}
+
 	public:
 		SerializationNode& GetRoot() { return m_RootNode; }
 		bool IsValid() { return m_DataParsed; }
@@ -144,6 +154,11 @@ namespace Odyssey
 			}
 		}
 
+		std::string WriteToString()
+		{
+			return ryml::emitrs_yaml<std::string>(m_Tree);
+		}
+
 	private:
 		ryml::Tree m_Tree;
 		ryml::NodeRef m_RootRef;
@@ -3,6 +3,7 @@
 #include "BinaryBuffer.h"
 #include "Enums.h"
 #include "FileManager.h"
+#include "ShaderCompiler.h"
 
 namespace Odyssey
 {
@@ -17,6 +18,7 @@ namespace Odyssey
 		void Reload();
 		bool Compile();
 		bool Compile(ShaderType shaderType, BinaryBuffer& codeBuffer);
+		bool GetCompilerSettings(ShaderType shaderType, ShaderCompiler::CompilerSettings& settings);
 
 	public:
 		const std::string& GetShaderLanguage() { return m_ShaderLanguage; }
@@ -0,0 +1,151 @@
+#pragma once
+#include "Frustum.h"
+
+namespace Odyssey
+{
+	// Height balanced AABB tree with fattened leaves, small movements only refit a proxy when it leaves its fat bounds
+	class DynamicTree
+	{
+	public:
+		inline static constexpr uint32_t Null_Node = UINT32_MAX;
+
+	public:
+		DynamicTree() = default;
+
+	public:
+		uint32_t CreateProxy(const BoundingBox& bounds, uint32_t userData);
+		void DestroyProxy(uint32_t proxy);
+
+		// Returns true when the proxy had to be reinserted
+		bool MoveProxy(uint32_t proxy, const BoundingBox& bounds);
+		void Clear();
+
+	public:
+		uint32_t GetUserData(uint32_t proxy) const { return m_Nodes[proxy].UserData; }
+		const BoundingBox& GetFatBounds(uint32_t proxy) const { return m_Nodes[proxy].Bounds; }
+		int32_t GetHeight() const { return m_Root != Null_Node ? m_Nodes[m_Root].Height : 0; }
+
+	public:
+		// Visits every proxy whose fat bounds pass overlaps, the callback returns false to stop early
+		template<typename OverlapFunc, typename Callback>
+		void Query(OverlapFunc&& overlaps, Callback&& callback) const
+		{
+			QueryStack stack;
+			stack.Push(m_Root);
+
+			while (!stack.Empty())
+			{
+				uint32_t nodeID = stack.Pop();
+				if (nodeID == Null_Node)
+					continue;
+
+				const Node& node = m_Nodes[nodeID];
+				if (!overlaps(node.Bounds))
+					continue;
+
+				if (node.IsLeaf())
+				{
+					if (!callback(nodeID))
+						return;
+				}
+				else
+				{
+					stack.Push(node.Child1);
+					stack.Push(node.Child2);
+				}
+			}
+		}
+
+		// The callback receives each proxy the ray enters with its entry distance, and returns the new max distance
+		// Returning 0 stops the cast, returning the hit distance keeps only closer hits
+		template<typename Callback>
+		void RayCast(float3 origin, float3 direction, float maxDistance, Callback&& callback) const
+		{
+			float3 inverseDirection = 1.0f / direction;
+
+			QueryStack stack;
+			stack.Push(m_Root);
+
+			while (!stack.Empty())
+			{
+				uint32_t nodeID = stack.Pop();
+				if (nodeID == Null_Node)
+					continue;
+
+				const Node& node = m_Nodes[nodeID];
+
+				float entry = 0.0f;
+				if (!RayIntersects(node.Bounds, origin, inverseDirection, maxDistance, entry))
+					continue;
+
+				if (node.IsLeaf())
+				{
+					maxDistance = callback(nodeID, entry);
+					if (maxDistance <= 0.0f)
+						return;
+				}
+				else
+				{
+					stack.Push(node.Child1);
+					stack.Push(node.Child2);
+				}
+			}
+		}
+
+	public:
+		static bool RayIntersects(const BoundingBox& bounds, float3 origin, float3 inverseDirection, float maxDistance, float& entry);
+
+	private:
+		struct Node
+		{
+		public:
+			bool IsLeaf() const { return Child1 == Null_Node; }
+
+		public:
+			BoundingBox Bounds;
+			uint32_t Parent = Null_Node;
+			uint32_t Child1 = Null_Node;
+			uint32_t Child2 = Null_Node;
+			uint32_t UserData = 0;
+
+			// Leaves are 0, free nodes are -1
+			int32_t Height = -1;
+		};
+
+		// The tree stays height balanced, so a fixed stack covers far more leaves than could ever be allocated
+		struct QueryStack
+		{
+		public:
+			void Push(uint32_t node) { assert(Count < Max_Depth); Nodes[Count++] = node; }
+			uint32_t Pop() { return Nodes[--Count]; }
+			bool Empty() const { return Count == 0; }
+
+		public:
+			inline static constexpr uint32_t Max_Depth = 256;
+			std::array<uint32_t, Max_Depth> Nodes;
+			uint32_t Count = 0;
+		};
+
+	private:
+		uint32_t AllocateNode();
+		void FreeNode(uint32_t node);
+		void InsertLeaf(uint32_t leaf);
+		void RemoveLeaf(uint32_t leaf);
+		uint32_t Balance(uint32_t node);
+		void Refit(uint32_t node);
+
+	private:
+		static BoundingBox Combine(const BoundingBox& a, const BoundingBox& b);
+		static float SurfaceArea(const BoundingBox& bounds);
+		static bool Contains(const BoundingBox& outer, const BoundingBox& inner);
+
+	private:
+		std::vector<Node> m_Nodes;
+		uint32_t m_Root = Null_Node;
+		uint32_t m_FreeList = Null_Node;
+
+	private:
+		// How far leaves are fattened past the bounds they were given
+		inline static constexpr float Bounds_Margin = 0.1f;
+	};
+}
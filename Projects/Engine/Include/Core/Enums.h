@@ -12,6 +12,13 @@ namespace Odyssey
 		Storage = 5,
 	};
 
+	enum class IndexType
+	{
+		None = 0,
+		UInt16 = 1,
+		UInt32 = 2,
+	};
+
 	enum DescriptorType
 	{
 		None = 0,
@@ -78,6 +85,10 @@ namespace Odyssey
 		R16G16B16A16_SFLOAT = 5,
 		R32G32B32A32_SFLOAT = 6,
 		R16G16_SFLOAT = 7,
+		BC1_RGB_UNORM = 8,
+		BC3_UNORM = 9,
+		BC5_UNORM = 10,
+		BC7_UNORM = 11,
 		D32_SFLOAT = 100,
 		D32_SFLOAT_S8_UINT = 101,
 		D24_UNORM_S8_UINT = 102,
@@ -92,6 +103,28 @@ namespace Odyssey
 			format == TextureFormat::D16_UNORM;
 	}
 
+	inline bool IsCompressedFormat(TextureFormat format)
+	{
+		return format == TextureFormat::BC1_RGB_UNORM ||
+			format == TextureFormat::BC3_UNORM ||
+			format == TextureFormat::BC5_UNORM ||
+			format == TextureFormat::BC7_UNORM;
+	}
+
+	enum class TextureUsage : uint32_t
+	{
+		Color = 0,
+		NormalMap = 1,
+		Linear = 2,
+	};
+
+	enum class TextureCompression : uint32_t
+	{
+		None = 0,
+		Default = 1,
+		HighQuality = 2,
+	};
+
 	enum class ImageTiling
 	{
 		None = 0,
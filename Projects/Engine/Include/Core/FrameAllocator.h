@@ -0,0 +1,102 @@
+#pragma once
+#include <atomic>
+
+namespace Odyssey
+{
+	// Linear allocator for transient data that only lives for the frame it was allocated in
+	// Each thread bumps through its own arena, memory stays valid until the end of the next frame
+	class FrameAllocator
+	{
+	public:
+		// Called once at the start of every frame by the main loop
+		static void Reset();
+
+	public:
+		static void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+		template<typename T>
+		static T* Allocate(size_t count)
+		{
+			return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+		}
+
+	public:
+		// Bytes allocated across every thread during the last frame and the highest seen so far
+		static size_t GetFrameUsage() { return s_LastFrameUsage; }
+		static size_t GetPeakUsage() { return s_PeakUsage; }
+
+		// Logs whenever a frame sets a new peak, the peak itself is always tracked
+		static void SetReportPeakUsage(bool report) { s_ReportPeakUsage = report; }
+
+	private:
+		inline static constexpr size_t Block_Size = 256 * 1024;
+
+		// Allocations survive one frame boundary so data built on frame N can still be read on frame N+1
+		inline static constexpr uint64_t Frames_In_Flight = 2;
+
+	private:
+		struct Block
+		{
+			uint8_t* Data = nullptr;
+			size_t Size = 0;
+		};
+
+		struct Page
+		{
+			std::vector<Block> Blocks;
+			size_t BlockIndex = 0;
+			size_t Offset = 0;
+			uint64_t Frame = UINT64_MAX;
+		};
+
+		struct Arena
+		{
+		public:
+			~Arena();
+
+		public:
+			std::array<Page, Frames_In_Flight> Pages;
+		};
+
+	private:
+		static Page& GetPage();
+
+	private:
+		inline static std::atomic<uint64_t> s_Frame = 0;
+		inline static std::atomic<size_t> s_FrameUsage = 0;
+		inline static size_t s_LastFrameUsage = 0;
+		inline static size_t s_PeakUsage = 0;
+		inline static bool s_ReportPeakUsage = false;
+	};
+
+	// Lets std containers draw from the frame allocator, memory is only reclaimed when the arena resets
+	template<typename T>
+	class FrameContainerAllocator
+	{
+	public:
+		using value_type = T;
+
+	public:
+		FrameContainerAllocator() = default;
+
+		template<typename U>
+		FrameContainerAllocator(const FrameContainerAllocator<U>&) noexcept { }
+
+	public:
+		T* allocate(size_t count) { return FrameAllocator::Allocate<T>(count); }
+		void deallocate(T*, size_t) noexcept { }
+
+		template<typename U>
+		bool operator==(const FrameContainerAllocator<U>&) const noexcept { return true; }
+	};
+
+	// Only use these for locals or containers rebuilt every frame, never for persistent members
+	template<typename T>
+	using FrameVector = std::vector<T, FrameContainerAllocator<T>>;
+
+	template<typename Key, typename Value, typename Compare = std::less<Key>>
+	using FrameMap = std::map<Key, Value, Compare, FrameContainerAllocator<std::pair<const Key, Value>>>;
+
+	template<typename Key, typename Value, typename Hash = std::hash<Key>>
+	using FrameUnorderedMap = std::unordered_map<Key, Value, Hash, std::equal_to<Key>, FrameContainerAllocator<std::pair<const Key, Value>>>;
+}
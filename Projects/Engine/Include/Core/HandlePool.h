@@ -0,0 +1,159 @@
+#pragma once
+#include "SlabAllocator.h"
+
+namespace Odyssey
+{
+	// Stores objects inline in per-type slabs and hands out 64-bit handles of a 32-bit index and generation
+	// Removing an object bumps the generation of its slot so stale handles never alias the next occupant
+	template<typename Base>
+	class HandlePool
+	{
+		static_assert(std::has_virtual_destructor_v<Base>, "Base must have a virtual destructor.");
+
+	public:
+		HandlePool() = default;
+
+		~HandlePool()
+		{
+			for (Slot& slot : m_Slots)
+			{
+				if (slot.Value)
+					slot.Value->~Base();
+			}
+		}
+
+		HandlePool(const HandlePool&) = delete;
+		HandlePool& operator=(const HandlePool&) = delete;
+
+	public:
+		template<typename T>
+		T* Get(uint64_t handle)
+		{
+			static_assert(std::is_base_of<Base, T>::value, "T is not a dervied class of Base.");
+			return static_cast<T*>(Resolve(handle));
+		}
+
+		Base* operator[](uint64_t handle)
+		{
+			return Resolve(handle);
+		}
+
+		bool Contains(uint64_t handle)
+		{
+			uint32_t index = GetIndex(handle);
+			return index < m_Slots.size() && m_Slots[index].Value && m_Slots[index].Generation == GetGeneration(handle);
+		}
+
+	public:
+		// Returns the handle the next call to Add will use
+		uint64_t Peek()
+		{
+			if (m_FreeIndices.size() == 0)
+				Grow();
+
+			uint32_t index = m_FreeIndices.back();
+			return MakeHandle(index, m_Slots[index].Generation);
+		}
+
+		template<typename T, typename... Args>
+		uint64_t Add(Args&&... params)
+		{
+			static_assert(std::is_base_of<Base, T>::value, "T is not a dervied class of Base.");
+
+			if (m_FreeIndices.size() == 0)
+				Grow();
+
+			// Claim the slot before constructing, T may add more objects to the pool
+			uint32_t index = m_FreeIndices.back();
+			m_FreeIndices.pop_back();
+
+			SlabAllocator& slab = GetSlab<T>();
+			T* value = new (slab.Allocate()) T(std::forward<Args>(params)...);
+
+			Slot& slot = m_Slots[index];
+			slot.Value = value;
+			slot.Slab = &slab;
+			return MakeHandle(index, slot.Generation);
+		}
+
+		void Remove(uint64_t handle)
+		{
+			if (!Contains(handle))
+			{
+				assert(false && "Removing a stale handle.");
+				return;
+			}
+
+			uint32_t index = GetIndex(handle);
+			Slot& slot = m_Slots[index];
+
+			slot.Value->~Base();
+			slot.Slab->Free(slot.Value);
+			slot.Value = nullptr;
+			slot.Slab = nullptr;
+
+			// Generation 0 is never handed out so a zeroed handle is always invalid
+			if (++slot.Generation == 0)
+				slot.Generation = 1;
+
+			m_FreeIndices.push_back(index);
+		}
+
+	public:
+		static uint64_t MakeHandle(uint32_t index, uint32_t generation) { return ((uint64_t)generation << 32) | index; }
+		static uint32_t GetIndex(uint64_t handle) { return (uint32_t)(handle & 0xFFFFFFFF); }
+		static uint32_t GetGeneration(uint64_t handle) { return (uint32_t)(handle >> 32); }
+
+	private:
+		Base* Resolve(uint64_t handle)
+		{
+			uint32_t index = GetIndex(handle);
+			if (index >= m_Slots.size())
+				return nullptr;
+
+			Slot& slot = m_Slots[index];
+			bool stale = slot.Generation != GetGeneration(handle);
+
+			// The object this handle pointed at has been removed, and possibly replaced
+			assert(!stale && "Stale handle.");
+			return stale ? nullptr : slot.Value;
+		}
+
+		void Grow()
+		{
+			uint32_t first = (uint32_t)m_Slots.size();
+			uint32_t count = std::max(first, Initial_Capacity);
+			m_Slots.resize(first + count);
+
+			// Pushed in reverse so the lowest index is handed out first
+			for (uint32_t i = first + count; i > first; i--)
+				m_FreeIndices.push_back(i - 1);
+		}
+
+		template<typename T>
+		SlabAllocator& GetSlab()
+		{
+			std::unique_ptr<SlabAllocator>& slab = m_Slabs[typeid(T)];
+			if (!slab)
+				slab = std::make_unique<SlabAllocator>(sizeof(T), alignof(T));
+
+			return *slab;
+		}
+
+	private:
+		struct Slot
+		{
+			Base* Value = nullptr;
+			SlabAllocator* Slab = nullptr;
+			uint32_t Generation = 1;
+		};
+
+	private:
+		inline static constexpr uint32_t Initial_Capacity = 64;
+
+	private:
+		std::vector<Slot> m_Slots;
+		std::vector<uint32_t> m_FreeIndices;
+		std::unordered_map<std::type_index, std::unique_ptr<SlabAllocator>> m_Slabs;
+	};
+}
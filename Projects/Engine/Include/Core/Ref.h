@@ -8,20 +8,76 @@ namespace Odyssey
 	class RefCount
 	{
 	public:
-		uint32_t Count() const { return m_Count.load(); }
+		// Where the count lives decides how the last Ref frees the object
+		enum class Storage : uint8_t
+		{
+			External = 0,
+			Embedded = 1,
+			Inline = 2,
+		};
+
+		// Frees an inline count along with the instance it was created with
+		using Deleter = void(*)(RefCount* refCount);
+
+	public:
+		RefCount(Storage storage = Storage::External, bool atomic = true, Deleter deleter = nullptr)
+			: m_Storage(storage), m_Atomic(atomic), m_Deleter(deleter) { }
+
+	public:
+		uint32_t Count() const { return m_Count.load(std::memory_order_relaxed); }
+		Storage GetStorage() const { return m_Storage; }
+		bool IsAtomic() const { return m_Atomic; }
 
 		void Increment()
 		{
-			++m_Count;
+			if (m_Atomic)
+				m_Count.fetch_add(1, std::memory_order_relaxed);
+			else
+				m_Count.store(m_Count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
 		}
 
-		void Decrement()
+		// Returns true when the last reference was released
+		bool Decrement()
 		{
-			--m_Count;
+			if (m_Atomic)
+				return m_Count.fetch_sub(1, std::memory_order_acq_rel) == 1;
+
+			uint32_t count = m_Count.load(std::memory_order_relaxed) - 1;
+			m_Count.store(count, std::memory_order_relaxed);
+			return count == 0;
 		}
 
+		void Destroy() { m_Deleter(this); }
+
 	private:
 		std::atomic<uint32_t> m_Count = 0;
+		Storage m_Storage;
+		bool m_Atomic;
+		Deleter m_Deleter = nullptr;
+	};
+
+	// Opt-in base that embeds the count in the object so a Ref never allocates a separate block
+	class RefCounted
+	{
+	protected:
+		RefCounted(bool atomic = true) : m_RefCount(RefCount::Storage::Embedded, atomic) { }
+		RefCounted(const RefCounted& other) : m_RefCount(RefCount::Storage::Embedded, other.m_RefCount.IsAtomic()) { }
+
+		// Copying an object never copies its references
+		RefCounted& operator=(const RefCounted&) { return *this; }
+
+	private:
+		template<typename T>
+		friend class Ref;
+
+		mutable RefCount m_RefCount;
+	};
+
+	// Skips the atomics, only for objects that are never shared between threads
+	class LocalRefCounted : public RefCounted
+	{
+	protected:
+		LocalRefCounted() : RefCounted(false) { }
 	};
 
 	template<typename T>
@@ -43,7 +99,14 @@ namespace Odyssey
 		Ref(T* instance)
 			: m_Instance(instance)
 		{
-			m_RefCount = new RefCount();
+			if (!instance)
+				return;
+
+			if constexpr (std::is_base_of_v<RefCounted, T>)
+				m_RefCount = &instance->m_RefCount;
+			else
+				m_RefCount = new RefCount();
+
 			Increment();
 		}
 
@@ -60,6 +123,14 @@ namespace Odyssey
 			Increment();
 		}
 
+		Ref(Ref<T>&& other) noexcept
+		{
+			m_Instance = other.m_Instance;
+			m_RefCount = other.m_RefCount;
+			other.m_Instance = nullptr;
+			other.m_RefCount = nullptr;
+		}
+
 		template<typename T2>
 		Ref(const Ref<T2>& other)
 		{
@@ -80,10 +151,11 @@ namespace Odyssey
 		template<typename T2>
 		Ref& operator=(const Ref<T2>& other)
 		{
-			other.m_RefCount->Increment();
+			if (other.m_RefCount)
+				other.m_RefCount->Increment();
 			Decrement();
 
-			m_Instance = other.m_Instance;
+			m_Instance = (T*)other.m_Instance;
 			m_RefCount = other.m_RefCount;
 			return *this;
 		}
@@ -92,7 +164,7 @@ namespace Odyssey
 		Ref& operator=(Ref<T2>&& other)
 		{
 			Decrement();
-			m_Instance = other.m_Instance;
+			m_Instance = (T*)other.m_Instance;
 			m_RefCount = other.m_RefCount;
 			other.m_Instance = nullptr;
 			other.m_RefCount = nullptr;
@@ -113,7 +185,8 @@ namespace Odyssey
 			if (this == &other)
 				return *this;
 
-			other.m_RefCount->Increment();
+			if (other.m_RefCount)
+				other.m_RefCount->Increment();
 			Decrement();
 
 			m_Instance = other.m_Instance;
@@ -122,6 +195,19 @@ namespace Odyssey
 			return *this;
 		}
 
+		Ref& operator=(Ref<T>&& other) noexcept
+		{
+			if (this == &other)
+				return *this;
+
+			Decrement();
+			m_Instance = other.m_Instance;
+			m_RefCount = other.m_RefCount;
+			other.m_Instance = nullptr;
+			other.m_RefCount = nullptr;
+			return *this;
+		}
+
 	public:
 		T& operator*() { return *m_Instance; }
 		const T& operator*() const { return *m_Instance; }
@@ -158,27 +244,33 @@ namespace Odyssey
 	private:
 		void Increment()
 		{
-
-			std::string name(typeid(T).name());
-
 			if (m_RefCount)
 				m_RefCount->Increment();
 		}
 
 		void Decrement()
 		{
-			if (m_RefCount)
+			if (m_RefCount && m_RefCount->Decrement())
 			{
-				m_RefCount->Decrement();
+				// Read the storage first, an embedded count is freed along with the instance
+				RefCount* refCount = m_RefCount;
+				RefCount::Storage storage = refCount->GetStorage();
 
-				if (m_RefCount->Count() == 0)
+				if (storage == RefCount::Storage::Inline)
+				{
+					// The count destroys the type MakeRef created, T may only be a base of it
+					refCount->Destroy();
+				}
+				else
 				{
 					delete m_Instance;
-					m_Instance = nullptr;
 
-					delete m_RefCount;
-					m_RefCount = nullptr;
+					if (storage == RefCount::Storage::External)
+						delete refCount;
 				}
+
+				m_Instance = nullptr;
+				m_RefCount = nullptr;
 			}
 		}
 
@@ -186,7 +278,51 @@ namespace Odyssey
 		template<typename T2>
 		friend class Ref;
 
+		template<typename T2, typename... Args>
+		friend Ref<T2> MakeRef(Args&&... params);
+
 		mutable T* m_Instance = nullptr;
 		mutable RefCount* m_RefCount = nullptr;
 	};
-}
\ No newline at end of file
+
+	// Creates the instance and its count with a single allocation
+	template<typename T, typename... Args>
+	Ref<T> MakeRef(Args&&... params)
+	{
+		if constexpr (std::is_base_of_v<RefCounted, T> || alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+		{
+			return Ref<T>(new T(std::forward<Args>(params)...));
+		}
+		else
+		{
+			// Lay the instance out right behind the count
+			constexpr size_t offset = (sizeof(RefCount) + alignof(T) - 1) & ~(alignof(T) - 1);
+			uint8_t* block = (uint8_t*)::operator new(offset + sizeof(T));
+
+			T* instance = nullptr;
+			try
+			{
+				instance = new (block + offset) T(std::forward<Args>(params)...);
+			}
+			catch (...)
+			{
+				::operator delete(block);
+				throw;
+			}
+
+			auto deleter = [](RefCount* refCount)
+				{
+					uint8_t* block = (uint8_t*)refCount;
+					((T*)(block + offset))->~T();
+					refCount->~RefCount();
+					::operator delete(block);
+				};
+
+			Ref<T> ref;
+			ref.m_Instance = instance;
+			ref.m_RefCount = new (block) RefCount(RefCount::Storage::Inline, true, deleter);
+			ref.m_RefCount->Increment();
+			return ref;
+		}
+	}
+}
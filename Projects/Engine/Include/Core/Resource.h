@@ -28,6 +28,7 @@ namespace Odyssey
 	public:
 		Resource() = default;
 		Resource(uint64_t id) : m_ResourceID(id) { }
+		virtual ~Resource() = default;
 
 	public:
 		ResourceID GetResourceID() { return m_ResourceID; }
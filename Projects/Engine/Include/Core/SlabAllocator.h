@@ -0,0 +1,34 @@
+#pragma once
+
+namespace Odyssey
+{
+	// Fixed size allocator carving slots out of chunked slabs, slots never move once allocated
+	class SlabAllocator
+	{
+	public:
+		SlabAllocator(size_t slotSize, size_t slotAlignment, size_t slotsPerSlab = Default_Slots_Per_Slab);
+		~SlabAllocator();
+
+		SlabAllocator(const SlabAllocator&) = delete;
+		SlabAllocator& operator=(const SlabAllocator&) = delete;
+
+	public:
+		void* Allocate();
+		void Free(void* slot);
+
+	private:
+		void AddSlab();
+
+	private:
+		inline static constexpr size_t Default_Slots_Per_Slab = 64;
+
+	private:
+		size_t m_SlotSize = 0;
+		size_t m_SlotAlignment = 0;
+		size_t m_SlotsPerSlab = 0;
+		std::vector<void*> m_Slabs;
+
+		// Free slots are linked through their own memory
+		void* m_FreeHead = nullptr;
+	};
+}
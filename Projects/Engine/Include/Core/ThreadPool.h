@@ -0,0 +1,31 @@
+#pragma once
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace Odyssey
+{
+	class ThreadPool
+	{
+	public:
+		// Queue a job to run on one of the worker threads
+		static void Submit(std::function<void()> job);
+		static uint32_t GetWorkerCount();
+
+	private:
+		ThreadPool();
+		~ThreadPool() = default;
+
+	private:
+		static ThreadPool& Get();
+		void WorkerLoop(std::stop_token stopToken);
+
+	private:
+		std::queue<std::function<void()>> m_Jobs;
+		std::mutex m_Mutex;
+		std::condition_variable_any m_Condition;
+
+		// Declared last so the workers are joined before the queue is destroyed
+		std::vector<std::jthread> m_Workers;
+	};
+}
@@ -27,6 +27,12 @@ namespace Odyssey
 		void OnEditorUpdate();
 		void Update();
 
+	public:
+		// Update split into phases so the pose evaluation can run across threads
+		void BeginUpdate();
+		void EvaluatePose();
+		void ApplyPose();
+
 	public:
 		void SetEnabled(bool enabled);
 		void SetFloat(const std::string& propertyName, float value);
@@ -36,11 +42,13 @@ namespace Odyssey
 
 	public:
 		bool IsEnabled() { return m_Enabled; }
+		bool IsExposingBones() { return m_ExposeBones; }
 		GUID GetRigAsset();
 		GUID GetBlueprintAsset();
 		void SetRig(GUID animationRigGUID);
 		void SetBlueprint(GUID animationClipGUID);
 		void SetDebugEnabled(bool enabled);
+		void SetExposeBones(bool expose);
 
 	public:
 		const std::vector<glm::mat4>& GetFinalPoses() { return m_FinalPoses; }
@@ -49,7 +57,7 @@ namespace Odyssey
 		void CreateBoneGameObjects();
 		void DestroyBoneGameObjects();
 		void CatalogBoneGameObjects();
-		void ProcessKeys();
+		void ApplyKeys();
 		void ProcessTransforms();
 		void ResetToBindpose();
 
@@ -63,14 +71,18 @@ namespace Odyssey
 		Ref<AnimationBlueprint> m_Blueprint;
 
 	private:
+		bool m_ExposeBones = false;
 		GUID m_RigRootGUID;
 		GameObject m_RigRoot;
 		std::vector<GameObject> m_BoneGameObjects;
 		std::unordered_map<std::string, GameObject> m_BoneCatalog;
 
 	private:
-		std::map<std::string, glm::mat4> m_BoneTransforms;
+		std::vector<BlendKey> m_LocalPose;
+		std::vector<glm::mat4> m_ModelPoses;
 		std::vector<glm::mat4> m_FinalPoses;
+		glm::mat4 m_RigRootMatrix = glm::mat4(1.0f);
+		bool m_PoseEvaluated = false;
 		bool m_Playing = false;
 
 	private:
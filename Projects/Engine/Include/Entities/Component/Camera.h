@@ -1,6 +1,7 @@
 #pragma once
 #include "AssetSerializer.h"
 #include "GameObject.h"
+#include "Frustum.h"
 
 namespace Odyssey
 {
@@ -51,6 +52,7 @@ namespace Odyssey
 		mat4 GetView();
 		mat4 GetInverseView();
 		float4 GetViewPosition();
+		Frustum GetFrustum();
 
 	public:
 		void SetMainCamera(bool mainCamera) { m_MainCamera = mainCamera; }
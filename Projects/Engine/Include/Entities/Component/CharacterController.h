@@ -2,6 +2,7 @@
 #include "GameObject.h"
 #include "AssetSerializer.h"
 #include "Jolt.h"
+#include "InterpolatedPose.h"
 
 namespace Odyssey
 {
@@ -22,6 +23,7 @@ namespace Odyssey
 	public:
 		void UpdateVelocity(Vec3 gravity, float dt);
 		void ResetVelocity();
+		void ClearInputVelocity() { m_InputVelocity = float3(0.0f); }
 
 		void SetLinearVelocity(float3 velocity);
 		float3 GetLinearVelocity();
@@ -58,6 +60,7 @@ namespace Odyssey
 		float GetPadding() { return m_CharacterPadding; }
 		bool HasInnerBody() { return m_CreateInnerBody; }
 		Ref<CharacterVirtual> GetCharacter() { return m_Character; }
+		InterpolatedPose& GetPose() { return m_Pose; }
 
 	public:
 		bool IsGrounded();
@@ -79,6 +82,10 @@ namespace Odyssey
 	private:
 		float3 m_PrevFrameLinearVelocity = float3(0.0f);
 
+		// Set by scripts once per frame and applied to every fixed step until the frame ends
+		float3 m_InputVelocity = float3(0.0f);
+		InterpolatedPose m_Pose;
+
 	private:
 		float3 m_Center = float3(0.0f);
 		float m_Mass = 70.0f;
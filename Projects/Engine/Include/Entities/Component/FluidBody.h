@@ -22,6 +22,7 @@ namespace Odyssey
 
 	public:
 		void CheckCollision(const BroadPhaseQuery& bpQuery);
+		void ApplyBuoyancy(const BodyLockInterface& lockInterface, float deltaTime);
 		virtual void AddHit(const BodyID& inBodyID) override;
 
 	public:
@@ -67,5 +68,8 @@ namespace Odyssey
 	private:
 		Vec3 m_SurfacePosition = Vec3::sZero();
 		Vec3 m_SurfaceNormal = Vec3::sAxisY();
+
+		// Bodies overlapping the fluid this step, locked together when the impulses are applied
+		std::vector<BodyID> m_Hits;
 	};
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 #include "GameObject.h"
+#include "Frustum.h"
 
 namespace Odyssey
 {
@@ -42,6 +43,7 @@ namespace Odyssey
 	public:
 		glm::vec3 GetPosition();
 		glm::vec3 GetDirection();
+		Frustum GetShadowFrustum(float3 sceneCenter, float sceneRadius);
 		static mat4 CalculateViewProj(float3 sceneCenter, float sceneRadius, float3 lightDir);
 
 	private:
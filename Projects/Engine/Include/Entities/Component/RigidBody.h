@@ -2,6 +2,7 @@
 #include "GameObject.h"
 #include "AssetSerializer.h"
 #include "PhysicsLayers.h"
+#include "InterpolatedPose.h"
 
 namespace JPH
 {
@@ -70,12 +71,15 @@ namespace Odyssey
 		bool IsEnabled() { return m_Enabled; }
 		PhysicsLayer GetLayer() { return m_PhysicsLayer; }
 		BodyID GetBodyID();
+		float3 GetColliderCenter();
+		InterpolatedPose& GetPose() { return m_Pose; }
 
 	private:
 		bool m_Enabled = true;
 		GameObject m_GameObject;
 		Body* m_Body = nullptr;
 		BodyID m_BodyID;
+		InterpolatedPose m_Pose;
 
 	private: // Serialized
 		PhysicsLayer m_PhysicsLayer = PhysicsLayer::Static;
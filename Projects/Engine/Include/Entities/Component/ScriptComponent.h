@@ -18,6 +18,7 @@ namespace Odyssey
 	public:
 		void Awake();
 		void Update();
+		void FixedUpdate();
 		void OnDestroy();
 		void OnCollisionEnter(GameObject& body, float3 contactNormal);
 		void OnCollisionStay(GameObject& body, float3 contactNormal);
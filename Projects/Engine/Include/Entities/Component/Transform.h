@@ -10,6 +10,7 @@ namespace Odyssey
         Transform() = default;
         Transform(const GameObject& gameObject);
         Transform(const GameObject& gameObject, SerializationNode& node);
+        Transform(const GameObject& gameObject, float3 position, quat rotation, float3 scale);
 
 	public:
         void Awake() { }
@@ -39,6 +40,7 @@ namespace Odyssey
         mat4 GetWorldMatrix();
 
     public:
+        void SetWorldDirty();
         void SetLocalSpace();
         void DecomposeWorldMatrix(float3& pos, quat& rotation, float3& scale);
         void RotateAround(float3 center, float3 axis, float degrees, bool worldSpace);
@@ -46,6 +48,7 @@ namespace Odyssey
 
     private:
         void SetEulerRotation(float3 eulerAngles);
+        void MarkWorldDirty();
         void ComposeLocalMatrix();
         void Reset();
 
@@ -60,7 +63,8 @@ namespace Odyssey
         float3 m_EulerRotation;
         mat4 m_LocalMatrix;
         mat4 m_WorldMatrix;
-        bool m_Dirty;
+        bool m_Dirty = true;
+        bool m_WorldDirty = true;
 		CLASS_DECLARATION(Odyssey, Transform)
 	};
 }
\ No newline at end of file
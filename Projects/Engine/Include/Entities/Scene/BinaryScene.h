@@ -0,0 +1,25 @@
+#pragma once
+
+namespace Odyssey
+{
+	class Scene;
+
+	// Chunked, little-endian scene layout that loads straight out of a memory-mapped file
+	// Note: YAML remains the source-control format, this is a cooked representation of it
+	class BinaryScene
+	{
+	public:
+		inline static constexpr const char* Extension = ".bscene";
+		inline static constexpr uint32_t Magic = 0x4E435342; // "BSCN"
+		inline static constexpr uint32_t Version = 1;
+
+	public:
+		static bool IsBinaryScene(const Path& path);
+		static void Save(Scene* scene, const Path& path);
+		static bool Load(Scene* scene, const Path& path);
+
+	public:
+		static bool ConvertToBinary(const Path& yamlPath, const Path& binaryPath);
+		static bool ConvertToYaml(const Path& binaryPath, const Path& yamlPath);
+	};
+}
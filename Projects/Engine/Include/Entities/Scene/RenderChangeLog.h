@@ -0,0 +1,62 @@
+#pragma once
+#include "entt.hpp"
+
+namespace Odyssey
+{
+	// Entities whose render state changed, in the order they changed
+	// Every render scene reads it from its own cursor so each frame in flight sees every change
+	class RenderChangeLog
+	{
+	public:
+		RenderChangeLog();
+
+	public:
+		// An entity is only logged once between reads, later writes are covered by the entry already there
+		void MarkDirty(entt::entity entity);
+
+		// Drops every change, readers rebuild from the scene on their next read
+		void Clear();
+
+	public:
+		// Appends the entities changed since the cursor and moves the cursor to the end of the log
+		// Returns false when changes past the cursor were dropped, the reader has to rebuild from the scene
+		bool Read(uint64_t& cursor, std::vector<entt::entity>& changes);
+
+		// Moves the cursor to the end of the log without reading, for readers about to rebuild from the scene
+		void Skip(uint64_t& cursor);
+
+		uint64_t GetEnd() const { return m_End; }
+
+		// Unique per log, a new scene at the same address still reads as a different scene
+		uint64_t GetID() const { return m_ID; }
+
+	private:
+		struct LoggedEntity
+		{
+		public:
+			entt::entity Entity = entt::null;
+			uint64_t Position = 0;
+		};
+
+	private:
+		uint64_t m_ID = 0;
+
+		// Ring of the newest changes, a position's slot is the position modulo the ring size
+		std::vector<entt::entity> m_Changes;
+
+		// Positions of the first change still held and the next one logged
+		uint64_t m_Start = 0;
+		uint64_t m_End = 0;
+
+		// End of the log at the last read, entities logged past it aren't logged again
+		uint64_t m_ReadEnd = 0;
+
+		// Newest position of each entity, indexed by the entity's slot
+		std::vector<LoggedEntity> m_Logged;
+
+	private:
+		// Readers that fall this far behind rebuild instead, a power of two so the ring index is a mask
+		inline static constexpr uint64_t Max_Changes = 65536;
+		inline static uint64_t s_NextID = 1;
+	};
+}
@@ -4,6 +4,8 @@
 #include "GameObject.h"
 #include "GUID.h"
 #include "SceneGraph.h"
+#include "SpatialIndex.h"
+#include "RenderChangeLog.h"
 #include "EnvironmentSettings.h"
 #include "EventSystem.h"
 #include "Events.h"
@@ -35,6 +37,7 @@ namespace Odyssey
 		void Awake();
 		void OnEditorUpdate();
 		void Update();
+		void FixedUpdate();
 		void OnDestroy();
 
 	public:
@@ -48,14 +51,26 @@ namespace Odyssey
 		const Path& GetPath() { return m_Path; }
 		SceneGraph& GetSceneGraph() { return m_SceneGraph; }
 		EnvironmentSettings& GetEnvironmentSettings() { return m_EnvironmentSettings; }
+		SpatialIndex& GetSpatialIndex() { return m_SpatialIndex; }
+		RenderChangeLog& GetRenderChanges() { return m_RenderChanges; }
+
+		// Called by transforms that become dirty under a clean parent, the next update recomputes their subtree
+		void AddDirtyTransform(entt::entity entity) { m_DirtyTransforms.push_back(entity); }
+
+	private:
+		void UpdateAnimators();
+		void UpdateTransforms();
 
 	private:
 		void SaveToDisk(const Path& assetPath);
 		void LoadFromDisk(const Path& assetPath);
+		void PrefetchAssets(SerializationNode& gameObjectsNode);
 
 	private:
 		void OnParticleEmitterCreate(entt::registry& registry, entt::entity entity);
 		void OnParticleEmitterDestroy(entt::registry& registry, entt::entity entity);
+		void OnSpatialComponentChanged(entt::registry& registry, entt::entity entity);
+		void OnRenderComponentChanged(entt::registry& registry, entt::entity entity);
 
 	public:
 		template<typename... Components>
@@ -69,7 +84,7 @@ namespace Odyssey
 		inline T& AddComponent(GameObject& gameObject, Args && ...params)
 		{
 			T& component = m_Registry.emplace<T>(gameObject, gameObject, std::forward<Args>(params)...);
-			EventSystem::Dispatch<SceneModifiedEvent>(this, SceneModifiedEvent::Modification::AddComponent);
+			EventSystem::Queue<SceneModifiedEvent>(this, SceneModifiedEvent::Modification::AddComponent);
 			return component;
 		}
 
@@ -90,12 +105,20 @@ namespace Odyssey
 		EnvironmentSettings m_EnvironmentSettings;
 
 	private:
+		friend class BinaryScene;
 		friend class RenderScene;
 		friend class GameObject;
 		Camera* m_MainCamera = nullptr;
+
+		// Declared before the registry so they outlive any destroy signals
+		SpatialIndex m_SpatialIndex;
+		RenderChangeLog m_RenderChanges;
 		entt::registry m_Registry;
 		std::map<GUID, GameObject> m_GUIDToGameObject;
 		SceneGraph m_SceneGraph;
+
+		// Roots of the subtrees whose world matrices changed since the last update
+		std::vector<entt::entity> m_DirtyTransforms;
 		SceneState m_State = SceneState::None;
 	};
 }
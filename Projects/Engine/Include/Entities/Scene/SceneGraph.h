@@ -5,19 +5,24 @@
 
 namespace Odyssey
 {
-	struct SceneNode
+	struct SceneNode : public LocalRefCounted
 	{
 	public:
 		SceneNode() = default;
 		SceneNode(const GameObject& entity) : Entity(entity) { }
 
 	public:
+		// Appends the child and records its position so it can be removed without a search
+		void AddChild(Ref<SceneNode>& child);
 		void SortChildren(bool recursive = false);
 
 	public:
 		Ref<SceneNode> Parent = nullptr;
 		GameObject Entity;
 		std::vector<Ref<SceneNode>> Children;
+
+		// Position in the parent's children
+		uint32_t ChildIndex = 0;
 	};
 
 	class SceneGraph
@@ -34,6 +39,8 @@ namespace Odyssey
 
 	public:
 		void AddEntity(const GameObject& entity);
+		void Build(const std::vector<GameObject>& entities, const std::vector<int32_t>& parentIndices);
+		void Clear();
 		void RemoveEntityAndChildren(const GameObject& entity);
 		void SetParent(const GameObject& parent, const GameObject& entity);
 		void RemoveParent(const GameObject& entity);
@@ -45,13 +52,14 @@ namespace Odyssey
 		Ref<SceneNode> GetNode(const GameObject& entity);
 
 	private:
-		void RemoveNode(Ref<SceneNode> node);
-		void RemoveParent(Ref<SceneNode> node);
-		void RemoveChildNode(Ref<SceneNode> parentNode, Ref<SceneNode> childNode);
-		void GetAllChildren(const GameObject& entity, std::vector<GameObject>& children);
+		void SerializeNode(SerializationNode& sceneGraphNode, Ref<SceneNode>& node);
+		void RemoveNode(const Ref<SceneNode>& node);
+		void RemoveParent(Ref<SceneNode>& node);
+		void RemoveChildNode(Ref<SceneNode>& parentNode, Ref<SceneNode>& childNode);
+		void GetAllChildren(const Ref<SceneNode>& node, std::vector<GameObject>& children);
 
 	private:
 		Ref<SceneNode> m_Root;
-		std::vector<Ref<SceneNode>> m_Nodes;
+		std::unordered_map<entt::entity, Ref<SceneNode>> m_Nodes;
 	};
 }
\ No newline at end of file
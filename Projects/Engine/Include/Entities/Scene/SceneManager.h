@@ -11,6 +11,7 @@ namespace Odyssey
 	{
 	public:
 		static void LoadScene(const Path& assetPath);
+		static Scene* CreateScene();
 		static void SaveActiveScene();
 		static void SaveActiveScene(const Path& path);
 		static Scene* GetActiveScene();
@@ -21,6 +22,7 @@ namespace Odyssey
 		static void Update();
 
 	private:
+		static void SetActiveScene(std::shared_ptr<Scene> scene);
 		static void BuildFinished(BuildCompleteEvent* onBuildFinished);
 		static void AssembliesReloaded(OnAssembliesReloaded* reloadedEvent);
 
@@ -0,0 +1,68 @@
+#pragma once
+#include "DynamicTree.h"
+#include "GameObject.h"
+#include "entt.hpp"
+
+namespace Odyssey
+{
+	class Scene;
+
+	struct RaycastHit
+	{
+	public:
+		GameObject Object;
+		float Distance = 0.0f;
+		float3 Point = float3(0.0f);
+	};
+
+	// World bounds of every mesh renderer in a scene, kept in a dynamic tree and refit from transform changes
+	class SpatialIndex
+	{
+	public:
+		SpatialIndex(Scene* scene);
+
+	public:
+		// Queues the entity to have its bounds recomputed on the next update
+		void MarkDirty(entt::entity entity);
+		void Update();
+		void Clear();
+
+	public:
+		// Closest hit along the ray, tested against the world bounds of each object
+		bool Raycast(float3 origin, float3 direction, float maxDistance, RaycastHit& hit);
+
+		// Every hit along the ray sorted by distance
+		void Raycast(float3 origin, float3 direction, float maxDistance, std::vector<RaycastHit>& hits);
+
+		void QueryBox(const BoundingBox& bounds, std::vector<GameObject>& results);
+		void QuerySphere(float3 center, float radius, std::vector<GameObject>& results);
+		void QueryFrustum(const Frustum& frustum, std::vector<GameObject>& results);
+
+	public:
+		size_t GetProxyCount() const { return m_ProxyCount; }
+
+	private:
+		struct Entry
+		{
+		public:
+			entt::entity Entity = entt::null;
+			uint32_t Proxy = DynamicTree::Null_Node;
+			bool Queued = false;
+
+			// The tree only stores fattened bounds, queries confirm against these
+			BoundingBox Bounds;
+		};
+
+	private:
+		Entry& GetEntry(entt::entity entity);
+		bool ComputeBounds(entt::entity entity, BoundingBox& bounds);
+		void RemoveProxy(Entry& entry);
+
+	private:
+		Scene* m_Scene = nullptr;
+		DynamicTree m_Tree;
+		std::vector<Entry> m_Entries;
+		std::vector<entt::entity> m_Dirty;
+		size_t m_ProxyCount = 0;
+	};
+}
@@ -12,23 +12,26 @@ namespace Odyssey
 		uint64_t ID = (uint64_t)(-1);
 	};
 
+	// Handle returned to the listener's owner, the callback itself lives in the listener array
 	template<typename EventType>
 	struct EventListener : IEventListener
 	{
 	public:
-		EventListener(uint64_t id, std::function<void(EventType*)> callback)
+		EventListener(uint64_t id)
 		{
 			ID = id;
-			Callback = callback;
 		}
-
-	public:
-		std::function<void(EventType*)> Callback;
 	};
 
-	// Empty abstract base class so we can store the templated version in containers
+	// Base class so we can store the templated version in containers
 	class IEventListenerArray
 	{
+	public:
+		virtual ~IEventListenerArray() = default;
+
+	public:
+		// Dispatches every queued event
+		virtual void Flush() = 0;
 	};
 
 	template<typename EventType>
@@ -37,27 +40,124 @@ namespace Odyssey
 	public:
 		Ref<EventListener<EventType>> AddListener(std::function<void(EventType*)> callback)
 		{
-			return m_Listeners.emplace_back(new EventListener<EventType>(m_NextID++, callback));
+			uint64_t id = m_NextID++;
+
+			// Listeners added mid-dispatch start receiving events once it finishes
+			std::vector<Entry>& entries = m_DispatchDepth > 0 ? m_AddedEntries : m_Entries;
+			entries.push_back({ id, std::move(callback) });
+
+			return MakeRef<EventListener<EventType>>(id);
 		}
 
 		void RemoveListener(Ref<EventListener<EventType>> listener)
 		{
-			auto iter = std::find(m_Listeners.begin(), m_Listeners.end(), listener);
-			if (iter != m_Listeners.end())
-				m_Listeners.erase(iter);
+			if (!listener)
+				return;
+
+			auto matchesID = [id = listener->ID](const Entry& entry) { return entry.ID == id; };
+			std::erase_if(m_AddedEntries, matchesID);
+
+			auto iter = std::find_if(m_Entries.begin(), m_Entries.end(), matchesID);
+			if (iter == m_Entries.end())
+				return;
+
+			// Erasing mid-dispatch would shift the entries being iterated, mark it and compact afterwards
+			if (m_DispatchDepth > 0)
+				iter->ID = Invalid_ID;
+			else
+				m_Entries.erase(iter);
 		}
 
 		void ExecuteCallbacks(EventType* e)
 		{
-			for (auto& listener : m_Listeners)
+			m_DispatchDepth++;
+
+			for (size_t i = 0; i < m_Entries.size(); i++)
 			{
-				if (listener)
-					listener->Callback(e);
+				if (m_Entries[i].ID != Invalid_ID)
+					m_Entries[i].Callback(e);
+			}
+
+			if (--m_DispatchDepth == 0)
+			{
+				std::erase_if(m_Entries, [](const Entry& entry) { return entry.ID == Invalid_ID; });
+
+				if (m_AddedEntries.size() > 0)
+				{
+					m_Entries.insert(m_Entries.end(), std::make_move_iterator(m_AddedEntries.begin()), std::make_move_iterator(m_AddedEntries.end()));
+					m_AddedEntries.clear();
+				}
 			}
 		}
 
+	public:
+		// Returns true when the array isn't already waiting on the next flush
+		template<typename... Args>
+		bool Enqueue(Args&&... params)
+		{
+			bool first = !m_Pending;
+			m_Pending = true;
+
+			EventType& queued = m_Queue.emplace_back(std::forward<Args>(params)...);
+
+			// Coalesced events only need to be seen once per flush
+			if constexpr (requires { EventType::Coalesce; })
+			{
+				if constexpr (EventType::Coalesce)
+				{
+					for (size_t i = 0; i + 1 < m_Queue.size(); i++)
+					{
+						if (m_Queue[i] == queued)
+						{
+							m_Queue.pop_back();
+							break;
+						}
+					}
+				}
+			}
+
+			return first;
+		}
+
+		void Flush() override
+		{
+			m_Pending = false;
+			DispatchQueued();
+		}
+
+		// Dispatches the events queued so far, skipped while those are already being dispatched
+		void DispatchQueued()
+		{
+			if (m_Queue.size() == 0 || m_Flushing.size() > 0)
+				return;
+
+			// Swap so events queued by the listeners wait for the next flush, both vectors keep their capacity
+			std::swap(m_Queue, m_Flushing);
+
+			for (EventType& e : m_Flushing)
+				ExecuteCallbacks(&e);
+
+			m_Flushing.clear();
+		}
+
 	private:
-		std::vector<Ref<EventListener<EventType>>> m_Listeners;
+		struct Entry
+		{
+			uint64_t ID;
+			std::function<void(EventType*)> Callback;
+		};
+
+	private:
+		inline static constexpr uint64_t Invalid_ID = (uint64_t)(-1);
+
+	private:
+		std::vector<Entry> m_Entries;
+		std::vector<Entry> m_AddedEntries;
 		uint64_t m_NextID = 0;
+		uint32_t m_DispatchDepth = 0;
+
+		std::vector<EventType> m_Queue;
+		std::vector<EventType> m_Flushing;
+		bool m_Pending = false;
 	};
-}
\ No newline at end of file
+}
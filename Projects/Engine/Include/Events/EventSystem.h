@@ -1,4 +1,5 @@
 #pragma once
+#include <atomic>
 #include "Ref.h"
 #include "EventListenerArray.h"
 
@@ -13,17 +14,32 @@ namespace Odyssey
 	class EventSystem
 	{
 	public:
+		// Calls every listener immediately, the event only lives on the stack for the duration of the call
+		// Queued events of the same type go out first so listeners see them in the order they were raised
 		template<typename EventType, typename... Args>
 		static void Dispatch(Args&&... params)
 		{
-			std::type_index typeID = typeid(EventType);
-			EventType* currentEvent = new EventType(params...);
+			EventListenerArray<EventType>* listeners = GetEventListenerArray<EventType>();
+			listeners->DispatchQueued();
 
-			GetEventListenerArray<EventType>()->ExecuteCallbacks(currentEvent);
+			EventType currentEvent(std::forward<Args>(params)...);
+			listeners->ExecuteCallbacks(&currentEvent);
+		}
+
+		// Defers the event until the next flush, duplicates of coalesced events are dropped
+		template<typename EventType, typename... Args>
+		static void Queue(Args&&... params)
+		{
+			EventListenerArray<EventType>* listeners = GetEventListenerArray<EventType>();
 
-			delete currentEvent;
+			if (listeners->Enqueue(std::forward<Args>(params)...))
+				s_QueuedArrays.push_back(listeners);
 		}
 
+		// Dispatches the queued events, called once per frame by the main loop
+		static void Flush();
+
+	public:
 		template<typename EventType>
 		static Ref<IEventListener> Listen(std::function<void(EventType*)> callback)
 		{
@@ -37,19 +53,36 @@ namespace Odyssey
 		}
 
 		template<typename EventType>
-		static Ref<EventListenerArray<EventType>> GetEventListenerArray()
+		static EventListenerArray<EventType>* GetEventListenerArray()
 		{
-			std::type_index typeID = typeid(EventType);
+			uint32_t typeID = GetEventTypeID<EventType>();
+
+			if (typeID >= s_ListenerArrays.size())
+				s_ListenerArrays.resize(typeID + 1);
 
-			if (eventTypeToListeners.find(typeID) == eventTypeToListeners.end())
-			{
-				eventTypeToListeners[typeID] = new EventListenerArray<EventType>();
-			}
+			if (!s_ListenerArrays[typeID])
+				s_ListenerArrays[typeID] = new EventListenerArray<EventType>();
 
-			return eventTypeToListeners[typeID].As<EventListenerArray<EventType>>();
+			return static_cast<EventListenerArray<EventType>*>(s_ListenerArrays[typeID].Get());
 		}
 
 	private:
-		inline static std::map<std::type_index, Ref<IEventListenerArray>> eventTypeToListeners;
+		// Assigned at runtime on first use rather than at compile time, so IDs can differ between runs
+		// The counter is atomic since thread pool jobs can hit a type's first use at the same time
+		template<typename EventType>
+		static uint32_t GetEventTypeID()
+		{
+			static const uint32_t typeID = s_NextEventTypeID.fetch_add(1, std::memory_order_relaxed);
+			return typeID;
+		}
+
+	private:
+		inline static std::vector<Ref<IEventListenerArray>> s_ListenerArrays;
+		inline static std::atomic<uint32_t> s_NextEventTypeID = 0;
+
+		// Listener arrays holding queued events
+		inline static std::vector<IEventListenerArray*> s_QueuedArrays;
+		inline static std::vector<IEventListenerArray*> s_FlushingArrays;
+		inline static bool s_Flushing = false;
 	};
-}
\ No newline at end of file
+}
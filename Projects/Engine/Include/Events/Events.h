@@ -71,5 +71,10 @@ namespace Odyssey
 	public:
 		Scene* Scene;
 		Modification Modification;
+
+	public:
+		// Queued modifications collapse into one event per scene and modification type
+		inline static constexpr bool Coalesce = true;
+		bool operator==(const SceneModifiedEvent& other) const { return Scene == other.Scene && Modification == other.Modification; }
 	};
 }
\ No newline at end of file
@@ -1,6 +1,6 @@
 #pragma once
 #include "Enums.h"
-#include "FreeList.h"
+#include "HandlePool.h"
 #include "Ref.h"
 #include "Resource.h"
 
@@ -15,7 +15,7 @@ namespace Odyssey
 
 	public:
 		template<typename T, typename... Args>
-		static ResourceID Allocate(Args... args)
+		static ResourceID Allocate(Args&&... args)
 		{
 			static_assert(std::is_base_of_v<Resource, T>, "T is not a dervied class of Resource.");
 			ResourceID id = s_Resources.Peek();
@@ -24,11 +24,11 @@ namespace Odyssey
 		}
 
 		template<typename T>
-		static Ref<T> GetResource(ResourceID resourceID)
+		static T* GetResource(ResourceID resourceID)
 		{
-			
+			// Owned by the pool, don't hold onto the pointer past the resource's lifetime
 			static_assert(std::is_base_of_v<Resource, T>, "T is not a dervied class of Resource.");
-			return s_Resources[resourceID].As<T>();
+			return s_Resources.Get<T>(resourceID);
 		}
 
 		static void Destroy(ResourceID resourceID)
@@ -38,9 +38,9 @@ namespace Odyssey
 
 			auto func = [](ResourceID resourceID)
 				{
-					if (Ref<Resource> resource = s_Resources[resourceID])
+					if (s_Resources.Contains(resourceID))
 					{
-						resource->Destroy();
+						s_Resources[resourceID]->Destroy();
 						s_Resources.Remove(resourceID);
 					}
 				};
@@ -53,7 +53,7 @@ namespace Odyssey
 
 	private: // Vulkan members
 		inline static std::shared_ptr<VulkanContext> s_Context = nullptr;
-		inline static FreeList<Resource> s_Resources;
+		inline static HandlePool<Resource> s_Resources;
 
 	private:
 		struct ResourceDeallocation
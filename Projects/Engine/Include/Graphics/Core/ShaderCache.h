@@ -0,0 +1,43 @@
+#pragma once
+#include "BinaryBuffer.h"
+#include "ShaderCompiler.h"
+#include "Shader.h"
+
+namespace Odyssey
+{
+	// Reflected resources of a single shader stage, cached next to the bytecode
+	struct ShaderReflection
+	{
+	public:
+		BinaryBuffer VertexAttributes;
+		std::vector<ShaderBinding> Bindings;
+		std::vector<MaterialProperty> MaterialProperties;
+		size_t MaterialBufferSize = 0;
+	};
+
+	// Content-addressed store of compiled SPIR-V so warm loads skip both shaderc and spirv_cross
+	class ShaderCache
+	{
+	public:
+		static void Init(const Path& cacheDirectory);
+		static void Clear();
+
+	public:
+		static uint64_t GenerateKey(const ShaderCompiler::CompilerSettings& settings);
+		static bool Load(uint64_t key, BinaryBuffer& codeBuffer, ShaderReflection& reflection);
+		static void Save(uint64_t key, BinaryBuffer& codeBuffer, const ShaderReflection& reflection);
+
+	private:
+		static bool WriteEntry(const Path& path, uint64_t key, BinaryBuffer& codeBuffer, const ShaderReflection& reflection);
+		static Path GetCachePath(uint64_t key);
+
+	private:
+		inline static constexpr uint32_t Magic = 0x43565053; // "SPVC"
+
+		// Bump when the compiler options or the reflection layout change to invalidate old entries
+		inline static constexpr uint32_t Version = 2;
+
+	private:
+		inline static Path s_Path;
+	};
+}
@@ -26,17 +26,18 @@ namespace Odyssey
 		struct Result
 		{
 		public:
-			bool Success;
+			bool Success = false;
+			BinaryBuffer CodeBuffer;
 		};
 
 	public:
 		static bool Compile(const CompilerSettings settings, BinaryBuffer& codeBuffer);
 
+		// Compiles every entry across the thread pool, results are returned in the same order as the settings
+		static std::vector<Result> CompileBatch(const std::vector<CompilerSettings>& settings);
+
 	private:
 		inline static std::string HLSL_EXTENSION = ".hlsl";
 		inline static std::string GLSL_EXTENSION = ".glsl";
-
-	private:
-		inline static CompilerSettings s_Options;
 	};
 }
\ No newline at end of file
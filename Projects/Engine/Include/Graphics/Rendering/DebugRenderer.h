@@ -42,7 +42,7 @@ namespace Odyssey
 		inline static constexpr size_t Ring_Segments = 32;
 		inline static ResourceID m_VertexBufferID;
 		inline static Settings m_Settings;
-		inline static std::vector<Vertex> m_Vertices;
+		inline static std::vector<PackedVertex> m_Vertices;
 		inline static size_t m_VertexCount = 0;
 
 	private:
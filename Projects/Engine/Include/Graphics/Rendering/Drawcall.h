@@ -15,8 +15,22 @@ namespace Odyssey
 		ResourceID VertexBufferID;
 		ResourceID IndexBufferID;
 		uint32_t IndexCount;
-		uint32_t UniformBufferIndex;
+		IndexType IndexFormat = IndexType::UInt32;
 		bool Skinned = false;
+
+	public:
+		// Slot of the object in the scene object buffer
+		uint32_t ObjectIndex = 0;
+
+		// Slot of the submesh's world bounds in the scene culling arrays
+		uint32_t BoundsIndex = 0;
+
+		// Range of the scene instance buffer drawn by this drawcall
+		uint32_t FirstInstance = 0;
+		uint32_t InstanceCount = 1;
+
+		// Per-object uniform buffer for shaders that read ModelData instead of the object buffer
+		uint32_t UniformBufferIndex = 0;
 	};
 
 	struct SpriteDrawcall
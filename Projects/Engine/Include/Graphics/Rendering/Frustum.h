@@ -0,0 +1,71 @@
+#pragma once
+#include "glm.h"
+
+namespace Odyssey
+{
+	struct BoundingBox
+	{
+	public:
+		BoundingBox() = default;
+		BoundingBox(float3 min, float3 max) : Min(min), Max(max) { }
+
+	public:
+		void Encapsulate(float3 point);
+		BoundingBox Transform(const mat4& matrix) const;
+		bool IsValid() const { return Min.x <= Max.x && Min.y <= Max.y && Min.z <= Max.z; }
+
+	public:
+		// Passes every frustum test, used for anything that can't be bounded ahead of time
+		static BoundingBox Infinite();
+
+	public:
+		float3 Min = float3(std::numeric_limits<float>::max());
+		float3 Max = float3(std::numeric_limits<float>::lowest());
+	};
+
+	// World bounds stored one component per array so the cull can test four boxes at a time
+	struct BoundsArray
+	{
+	public:
+		void Clear();
+		uint32_t Add(const BoundingBox& bounds);
+		void Set(uint32_t index, const BoundingBox& bounds);
+		size_t Size() const { return MinX.size(); }
+
+	public:
+		std::vector<float> MinX, MinY, MinZ;
+		std::vector<float> MaxX, MaxY, MaxZ;
+	};
+
+	class Frustum
+	{
+	public:
+		enum Plane : uint8_t
+		{
+			Left = 0,
+			Right = 1,
+			Bottom = 2,
+			Top = 3,
+			Near = 4,
+			Far = 5,
+			Count = 6,
+		};
+
+	public:
+		Frustum() = default;
+		Frustum(const mat4& viewProjection);
+
+	public:
+		bool Intersects(const BoundingBox& bounds) const;
+
+		// Appends the index of every box touching the frustum to visible
+		void Cull(const BoundsArray& bounds, std::vector<uint32_t>& visible) const;
+
+	public:
+		const std::array<float4, Plane::Count>& GetPlanes() const { return m_Planes; }
+
+	private:
+		// Normals point inward, a point is inside when dot(plane.xyz, point) + plane.w >= 0
+		std::array<float4, Plane::Count> m_Planes;
+	};
+}
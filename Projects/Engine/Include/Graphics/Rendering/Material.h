@@ -15,14 +15,26 @@ namespace Odyssey
 	class Material : public Asset
 	{
 		CLASS_DECLARATION(Odyssey, Material)
+	public:
+		struct LoadData
+		{
+			GUID Shader;
+			std::vector<GUID> Textures;
+		};
+
 	public:
 		Material() = default;
 		Material(const Path& assetPath);
+		Material(const Path& assetPath, LoadData& loadData);
 
 	public:
 		virtual void Save() override;
 		void Load();
 
+	public:
+		// Starts loading the shader and textures so they decode alongside the material
+		static void Decode(const Path& assetPath, LoadData& loadData);
+
 	private:
 		void SaveToDisk(const Path& path);
 		void LoadFromDisk(const Path& path);
@@ -36,6 +48,9 @@ namespace Odyssey
 		bool GetDepthWrite() { return m_DepthWrite; }
 		const std::vector<MaterialProperty>& GetMaterialProperties() { return m_MaterialData.Properties; }
 
+		// Changes whenever the shader, pipeline state, render queue or textures change, property values excluded
+		uint32_t GetVersion() { return m_Version; }
+
 	public:
 		ResourceID GetPipeline();
 		ResourceID GetMaterialBuffer();
@@ -43,7 +58,7 @@ namespace Odyssey
 	public:
 		void SetShader(Ref<Shader> shader);
 		void SetTexture(std::string propertyName, GUID texture);
-		void SetRenderQueue(RenderQueue queue) { m_RenderQueue = queue; }
+		void SetRenderQueue(RenderQueue queue) { m_RenderQueue = queue; m_Version++; }
 		void SetBlendMode(BlendMode blendMode);
 		void SetDepthWrite(bool write);
 
@@ -75,6 +90,7 @@ namespace Odyssey
 		ResourceID m_MaterialBuffer;
 		bool m_RemakePipeline = false;
 		bool m_UpdateBuffer = false;
+		uint32_t m_Version = 0;
 
 		Ref<Shader> m_Shader;
 		uint32_t m_ListenerID = 0;
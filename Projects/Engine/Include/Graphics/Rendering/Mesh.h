@@ -1,7 +1,9 @@
 #pragma once
 #include "Asset.h"
+#include "MeshCache.h"
 #include "Vertex.h"
 #include "Resource.h"
+#include "Frustum.h"
 
 namespace Odyssey
 {
@@ -10,43 +12,69 @@ namespace Odyssey
 	struct SubMesh
 	{
 	public:
-		uint32_t VertexCount;
-		uint32_t IndexCount;
-		std::vector<Vertex> Vertices;
-		std::vector<uint32_t> Indices;
+		uint32_t VertexCount = 0;
+		uint32_t IndexCount = 0;
+		IndexType IndexFormat = IndexType::UInt32;
 		ResourceID VertexBuffer;
 		ResourceID IndexBuffer;
+
+		// Object space bounds of the vertices, used for culling
+		BoundingBox Bounds;
 	};
 
 	class Mesh : public Asset
 	{
 		CLASS_DECLARATION(Odyssey, Mesh)
+	public:
+		struct LoadData
+		{
+			size_t MeshIndex = 0;
+			bool QuantizePositions = false;
+			std::vector<MeshCache::Submesh> Submeshes;
+		};
+
 	public:
 		Mesh() = default;
 		Mesh(const Path& assetPath);
+		Mesh(const Path& assetPath, LoadData& loadData);
 		Mesh(const Path& assetPath, Ref<SourceModel> source, uint32_t meshIndex = 0);
 
 	public:
 		virtual void Save() override;
 		void Load();
 
+	public:
+		// Reads the cooked mesh or imports the source, safe to call from a loader thread
+		static void Decode(const Path& assetPath, LoadData& loadData);
+
 	private:
+		void Load(LoadData& loadData);
 		void LoadFromSource(Ref<SourceModel> source);
 		void SaveToDisk(const Path& assetPath);
+		MeshCache::Settings GetCacheSettings();
+		static MeshCache::Settings GetCacheSettings(GUID sourceAsset, size_t meshIndex, bool quantizePositions);
 
 	public:
 		ResourceID GetVertexBuffer(size_t submeshIndex = 0) { return m_SubMeshes[submeshIndex].VertexBuffer; }
 		ResourceID GetIndexBuffer(size_t submeshIndex = 0) { return m_SubMeshes[submeshIndex].IndexBuffer; }
 		uint32_t GetIndexCount(size_t submeshIndex = 0) { return m_SubMeshes[submeshIndex].IndexCount; }
 		uint32_t GetVertexCount(size_t submeshIndex = 0) { return m_SubMeshes[submeshIndex].VertexCount; }
+		IndexType GetIndexType(size_t submeshIndex = 0) { return m_SubMeshes[submeshIndex].IndexFormat; }
+		size_t GetSubmeshCount() { return m_SubMeshes.size(); }
 		SubMesh* GetSubmesh(size_t submeshIndex = 0);
 
+		// Changes whenever a submesh gets new buffers or bounds
+		uint32_t GetVersion() { return m_Version; }
+
 	public:
 		void SetVertices(const std::vector<Vertex>& vertices, size_t submeshIndex = 0);
+		void SetVertices(const std::vector<PackedVertex>& vertices, size_t submeshIndex = 0);
 		void SetIndices(const std::vector<uint32_t>& indices, size_t submeshIndex = 0);
 
 	private:
 		std::vector<SubMesh> m_SubMeshes;
 		size_t m_MeshIndex = 0;
+		bool m_QuantizePositions = false;
+		uint32_t m_Version = 0;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,35 @@
+#pragma once
+#include "BinaryBuffer.h"
+#include "Vertex.h"
+
+namespace Odyssey
+{
+	struct MeshImportData;
+
+	// Cooks imported meshes into a packed layout for the binary cache so loads can skip the model importer
+	// Uncooking goes straight to the packed GPU vertex layout without expanding to Vertex
+	class MeshCache
+	{
+	public:
+		inline static constexpr uint32_t Magic = 0x48534D43; // "CMSH"
+		inline static constexpr uint32_t Version = 1;
+
+	public:
+		struct Settings
+		{
+			uint64_t SourceTimestamp = 0;
+			uint32_t MeshIndex = 0;
+			bool QuantizePositions = false;
+		};
+
+		struct Submesh
+		{
+			std::vector<PackedVertex> Vertices;
+			std::vector<uint32_t> Indices;
+		};
+
+	public:
+		static BinaryBuffer Cook(const MeshImportData& meshData, const Settings& settings);
+		static bool Uncook(BinaryBuffer& buffer, const Settings& settings, std::vector<Submesh>& submeshes);
+	};
+}
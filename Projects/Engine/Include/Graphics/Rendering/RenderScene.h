@@ -6,12 +6,15 @@
 #include "Ref.h"
 #include "BinaryBuffer.h"
 #include "Material.h"
+#include "Mesh.h"
+#include "Frustum.h"
+#include "VulkanRingBuffer.h"
+#include "entt.hpp"
 
 namespace Odyssey
 {
 	class Camera;
 	class Material;
-	class Mesh;
 	class Scene;
 	class VulkanGraphicsPipeline;
 	class VulkanDescriptorLayout;
@@ -32,26 +35,13 @@ namespace Odyssey
 		glm::mat4 world;
 	};
 
-	struct SkinningData
+	// Matches the ObjectData layout read from the ObjectBuffer in shaders
+	struct alignas(16) ObjectData
 	{
-		std::array<glm::mat4, 128> Bones;
+		glm::mat4 World = glm::mat4(1.0f);
+		uint32_t BoneOffset = 0;
 
-		SkinningData()
-		{
-			for (size_t i = 0; i < Bones.size(); i++)
-			{
-				Bones[i] = glm::identity<mat4>();
-			}
-		}
-
-		void SetBindposes(std::vector<glm::mat4> bindposes)
-		{
-			assert(bindposes.size() <= Bones.size());
-			for (size_t i = 0; i < bindposes.size(); i++)
-			{
-				Bones[i] = bindposes[i];
-			}
-		}
+		bool operator==(const ObjectData& other) const = default;
 	};
 
 	struct alignas(16) MaterialData
@@ -81,34 +71,87 @@ namespace Odyssey
 		float GammaCorrection;
 	};
 
+	// Binding indices resolved from the shader once per set pass, -1 when unused by the shader
+	struct SetPassBindings
+	{
+	public:
+		int32_t SceneData = -1;
+		int32_t ObjectBuffer = -1;
+		int32_t BoneBuffer = -1;
+		int32_t InstanceBuffer = -1;
+		int32_t ModelData = -1;
+		int32_t GlobalData = -1;
+		int32_t LightData = -1;
+		int32_t MaterialData = -1;
+		int32_t CameraColor = -1;
+		int32_t BRDFLut = -1;
+		int32_t Irradiance = -1;
+		int32_t Prefiltered = -1;
+		int32_t Shadowmap = -1;
+		int32_t Depth = -1;
+		std::vector<std::pair<uint32_t, Ref<Texture2D>>> Textures;
+	};
+
 	struct SetPass
 	{
 	public:
 		SetPass() = default;
 
 	public:
-		void SetMaterial(Ref<Material> material, bool skinned);
+		void SetMaterial(Ref<Material> material);
+
+	public:
+		// Instanced set passes draw every object sharing a mesh with a single drawcall
+		bool IsInstanced() { return Bindings.ModelData < 0; }
+
+		// Batches that survived culling for a view, views are camera tags with the shadow view at 0
+		std::vector<Drawcall>& GetDrawcalls(uint8_t view) { return ViewDrawcalls[view]; }
 
 	public:
-		std::map<std::string, ShaderBinding> ShaderBindings;
-		std::map<std::string, Ref<Texture2D>> Textures;
+		SetPassBindings Bindings;
+
+		// Set passes outlive a frame, the bindings are resolved again when the material version moves on
+		Ref<Material> SourceMaterial;
+		uint32_t MaterialVersion = 0;
 
 		ResourceID GraphicsPipeline;
 		ResourceID MaterialBuffer;
-		std::map<ShaderType, ResourceID> Shaders;
 		RenderQueue RenderQueue;
-		std::vector<Drawcall> Drawcalls;
 		bool WriteDepth = true;
+
+		// Every submesh drawn with the set pass, before culling
+		std::vector<Drawcall> Drawcalls;
+		std::vector<std::vector<Drawcall>> ViewDrawcalls;
+	};
+
+	// A mesh renderer as the render scene sees it, kept across frames and refreshed when the scene reports a change
+	struct RenderProxy
+	{
+	public:
+		entt::entity Entity = entt::null;
+		uint32_t ObjectIndex = 0;
+		Ref<Mesh> SourceMesh;
+		std::vector<Ref<Material>> Materials;
+		bool Skinned = false;
+
+		// Culling slot of the first submesh, the rest follow in submesh order
+		uint32_t FirstBounds = 0;
+		uint32_t BoundsCount = 0;
+
+		// ModelData slot shared by the drawcalls on set passes that can't be instanced
+		uint32_t ModelDataIndex = UINT32_MAX;
 	};
 
 	class RenderScene
 	{
 	public:
-		RenderScene();
+		RenderScene(std::shared_ptr<VulkanRingBuffer> uniformRing);
 		void Destroy();
 
 	public:
 		void ConvertScene(Scene* scene);
+
+		// For frames without an active scene, the proxies are dropped and rebuilt once a scene is active again
 		void ClearSceneData();
 
 		void SetSceneData(uint8_t cameraTag);
@@ -117,34 +160,135 @@ namespace Odyssey
 		Camera* GetCamera(uint8_t cameraTag);
 		mat4 GetShadowLightMatrix() { return m_ShadowLightMatrix; }
 		bool HasMainCamera() { return m_MainCamera != nullptr; }
+		std::shared_ptr<VulkanRingBuffer> GetUniformRing() { return m_UniformRing; }
 
 	private:
+		void ResetFrameData();
 		void SetupDrawcalls(Scene* scene);
 
+	private: // Proxies
+		void UpdateProxies(Scene* scene);
+		void RebuildProxies(Scene* scene);
+		void RefreshProxy(Scene* scene, entt::entity entity);
+		void RemoveProxy(uint32_t proxyIndex);
+		void ReleaseProxies();
+		void RefreshSetPasses();
+		void CheckMeshVersions();
+
+	private: // Draw lists
+		void BuildDrawLists();
+		void AddDraws(uint32_t proxyIndex, bool sorted);
+		void RemoveDraws(uint32_t proxyIndex);
+		uint32_t AllocateModelData(uint32_t objectIndex);
+		void UpdateSkinnedObjects(Scene* scene);
+		void WriteModelData();
+
+	private: // Object slots
+		uint32_t AllocateObject();
+		bool SetObjectData(uint32_t index, const ObjectData& objectData);
+		void UpdateObjectBounds(uint32_t index, Mesh* mesh, const mat4& world, bool moved);
+
+	private:
+		void CullViews();
+		void CullView(uint8_t view, const Frustum& frustum);
+		void BuildInstances();
+		void UploadObjectData();
+		bool ReserveBuffer(ResourceID& buffer, uint32_t& capacity, size_t count, size_t stride);
+
 	public:
 		// Scene objects
 		Camera* m_MainCamera = nullptr;
 		Light* m_ShadowLight = nullptr;
 		mat4 m_ShadowLightMatrix;
+		Frustum m_ShadowFrustum;
 
 		std::map<uint8_t, Camera*> m_Cameras;
 		ResourceID SkyboxCubemap;
 		std::map<RenderQueue, std::vector<SetPass>> SetPasses;
 		std::vector<SpriteDrawcall> SpriteDrawcalls;
-		std::map<GUID, size_t> m_GUIDToSetPass;
 
 		std::vector<GUID> ParticleEmitters;
 
-		// Scene uniform buffers
-		std::vector<ResourceID> sceneDataBuffers;
-		std::vector<ResourceID> perObjectUniformBuffers;
-		std::vector<ResourceID> skinningBuffers;
-		ResourceID LightingBuffer;
+		// Scene uniforms, written into the renderer's uniform ring each frame
+		std::vector<RingAllocation> SceneDataBuffers;
+		std::vector<RingAllocation> ModelDataBuffers;
+		RingAllocation LightingBuffer;
+
+		// Scene storage buffers, indexed through the instance buffer in shaders
+		ResourceID ObjectBuffer;
+		ResourceID BoneBuffer;
+		ResourceID InstanceBuffer;
 
-		uint32_t m_NextUniformBuffer = 0;
 		uint32_t m_NextMaterialBuffer = 0;
 
-		const uint32_t Max_Uniform_Buffers = 256;
+	private:
+		std::shared_ptr<VulkanRingBuffer> m_UniformRing;
+
+		// The scene and change log position the proxies were last brought up to date with
+		Scene* m_Scene = nullptr;
+		uint64_t m_ChangeLogID = 0;
+		uint64_t m_ChangeCursor = 0;
+		std::vector<entt::entity> m_Changes;
+
+		// Dense, removals move the last proxy into the hole
+		std::vector<RenderProxy> m_Proxies;
+		std::unordered_map<entt::entity, uint32_t> m_EntityToProxy;
+
+		// Proxies patch their drawcalls in and out, the draw lists are only rebuilt from the proxies when this is set
+		bool m_DrawListsDirty = true;
+
+		// Queue and set pass of each material drawn, set passes emptied by removals are dropped on the next rebuild
+		std::map<GUID, std::pair<RenderQueue, size_t>> m_SetPassIndices;
+
+		struct MeshUsage
+		{
+		public:
+			uint32_t Version = 0;
+			uint32_t Proxies = 0;
+		};
+
+		std::unordered_map<Mesh*, MeshUsage> m_MeshVersions;
+		std::vector<uint32_t> m_SkinnedProxies;
+		std::vector<uint32_t> m_ModelDataObjects;
+		std::vector<uint32_t> m_FreeModelData;
+
+		// Culling slots left behind by removed drawcalls, the draw lists are rebuilt once they are half of all slots
+		uint32_t m_FreeBounds = 0;
+
+		// Persistent object slots, only re-uploaded when their data changes
+		std::vector<ObjectData> m_Objects;
+		std::vector<uint32_t> m_FreeObjects;
+		uint32_t m_DirtyBegin = UINT32_MAX;
+		uint32_t m_DirtyEnd = 0;
+
+		// World bounds of each submesh in a slot, only transformed again when the object moves or its mesh changes
+		struct ObjectBounds
+		{
+		public:
+			Mesh* Source = nullptr;
+			uint32_t Version = 0;
+			std::vector<BoundingBox> Submeshes;
+		};
+
+		std::vector<ObjectBounds> m_ObjectBounds;
+
+		// Rebuilt every frame
+		std::vector<glm::mat4> m_Bones;
+		std::vector<uint32_t> m_Instances;
+
+		// Bounds of every submesh in the draw lists and one bit per view that can see it
+		BoundsArray m_DrawBounds;
+		std::vector<uint16_t> m_DrawVisibility;
+		std::vector<uint32_t> m_VisibleDraws;
+		uint16_t m_ActiveViews = 0;
+
+		uint32_t m_ObjectCapacity = 0;
+		uint32_t m_BoneCapacity = 0;
+		uint32_t m_InstanceCapacity = 0;
+
+	public:
+		inline static constexpr uint32_t Initial_Object_Capacity = 1024;
+		inline static constexpr uint32_t Max_Bones = 128;
 		inline static constexpr uint32_t MAX_CAMERAS = 12;
 		inline static constexpr uint32_t MAX_LIGHTS = 16;
 	};
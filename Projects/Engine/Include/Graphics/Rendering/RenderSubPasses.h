@@ -52,11 +52,13 @@ namespace Odyssey
 
 	private: // Shared
 		Ref<VulkanPushDescriptors> m_PushDescriptors;
-		ResourceID m_DepthUBO;
 
 	private:
 		inline static const GUID& Shader_GUID = 879318792137863213;
 		inline static const GUID& Skinned_Shader_GUID = 218097783217681239;
+		inline static constexpr uint32_t Object_Buffer_Binding = 1;
+		inline static constexpr uint32_t Bone_Buffer_Binding = 2;
+		inline static constexpr uint32_t Instance_Buffer_Binding = 14;
 	};
 
 	class RenderObjectSubPass : public RenderSubPass
@@ -68,7 +70,6 @@ namespace Odyssey
 
 	private:
 		Ref<VulkanPushDescriptors> m_PushDescriptors;
-		ResourceID m_GlobalDataUBO;
 		Ref<Texture2D> m_BlackTexture;
 		ResourceID m_BlackTextureID;
 		Ref<Texture2D> m_WhiteTexture;
@@ -111,7 +112,6 @@ namespace Odyssey
 	private:
 		ResourceID m_GraphicsPipeline;
 		Ref<VulkanPushDescriptors> m_PushDescriptors;
-		ResourceID uboID;
 		Ref<Shader> m_Shader;
 		Ref<Mesh> m_CubeMesh;
 		inline static const GUID& s_SkyboxShaderGUID = 12373133592092994291;
@@ -143,15 +143,11 @@ namespace Odyssey
 	private:
 		void OnSpriteShaderModified();
 
-	private:
-		inline static constexpr size_t Max_Supported_Sprites = 1024;
-
 	private:
 		Ref<Shader> m_Shader;
 		Ref<Mesh> m_QuadMesh;
 		ResourceID m_GraphicsPipeline;
 		Ref<VulkanPushDescriptors> m_PushDescriptors;
-		std::array<ResourceID, Max_Supported_Sprites> m_SpriteDataUBO;
 
 	private:
 		struct alignas(16) SpriteData
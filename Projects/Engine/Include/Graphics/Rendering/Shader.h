@@ -10,6 +10,7 @@ namespace Odyssey
 {
 	class VulkanShaderModule;
 	class SourceShader;
+	struct ShaderReflection;
 
 	class ShaderBinding
 	{
@@ -26,10 +27,20 @@ namespace Odyssey
 		Shader() = default;
 		Shader(const Path& assetPath);
 		Shader(const Path& assetPath, Ref<SourceShader> source);
+		~Shader();
 
 	public:
 		void Recompile();
 
+		// Compiles the stages of every shader in a single batch across the thread pool
+		static void RecompileBatch(const std::vector<Shader*>& shaders);
+
+		// Compiles the stages of every source through the shader cache without creating shader modules, returns the cache hits
+		static uint32_t Precompile(const std::vector<SourceShader*>& sources, uint32_t& stageCount);
+
+		// Recompiles the shaders whose source changed since the last call
+		static void ProcessModifiedShaders();
+
 	public:
 		virtual void Save() override;
 		void Load();
@@ -50,13 +61,20 @@ namespace Odyssey
 
 	private:
 		void LoadFromSource(Ref<SourceShader> source);
+		void DestroyShaderModules();
+		void NotifyModified();
 		void SaveToDisk(const Path& path);
 		void LoadMaterialDefaults();
 
 	private:
-		void GenerateShaderResources();
+		void GenerateShaderResources(std::map<ShaderType, ShaderReflection>& reflections);
 		void OnSourceModified();
 
+	private:
+		struct CompiledStage;
+		static uint32_t CompileStages(const std::vector<SourceShader*>& sources, std::vector<CompiledStage>& stages);
+		static void ReflectShader(ShaderType shaderType, BinaryBuffer& codeBuffer, ShaderReflection& reflection);
+
 	private:
 		struct Listener
 		{
@@ -83,5 +101,8 @@ namespace Odyssey
 		Ref<SourceShader> m_Source;
 		uint32_t m_NextID = 0;
 		std::vector<Listener> m_OnModifiedListeners;
+
+	private:
+		inline static std::vector<Shader*> s_ModifiedShaders;
 	};
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "Resource.h"
 #include "VulkanGlobals.h"
 #include "VulkanImage.h"
+#include "TextureCache.h"
 
 namespace Odyssey
 {
@@ -12,14 +13,29 @@ namespace Odyssey
 	class Texture2D : public Asset
 	{
 		CLASS_DECLARATION(Odyssey, Texture2D)
+	public:
+		struct LoadData
+		{
+			VulkanImageDescription Description;
+			TextureUsage Usage = TextureUsage::Color;
+			TextureCompression Compression = TextureCompression::Default;
+			TextureCache::CookedTexture Texture;
+		};
+
 	public:
 		Texture2D(const Path& assetPath);
+		Texture2D(const Path& assetPath, LoadData& loadData);
 		Texture2D(const Path& assetPath, TextureFormat format);
 		Texture2D(const Path& assetPath, Ref<SourceTexture> source);
 
 	public:
 		virtual void Save() override;
-		void Load(Ref<SourceTexture> source);
+		void Load();
+		void Load(LoadData& loadData);
+
+	public:
+		// Loads the cooked texture, cooking it from the source pixels on a miss, safe to call from a loader thread
+		static void Decode(const Path& assetPath, LoadData& loadData);
 
 	public:
 		ResourceID GetTexture() { return m_Texture; }
@@ -28,22 +44,30 @@ namespace Odyssey
 		bool GetMipMapsEnabled() { return m_TextureDescription.MipMapEnabled; }
 		float GetMipBias() { return m_TextureDescription.MipBias; }
 		uint32_t GetMaxMipCount() { return m_TextureDescription.MaxMipCount; }
+		TextureUsage GetUsage() { return m_Usage; }
+		TextureCompression GetCompression() { return m_Compression; }
 
 	public:
 		void SetMipMapsEnabled(bool enabled);
 		void SetMipBias(float bias);
 		void SetMaxMipCount(uint32_t count);
+		void SetUsage(TextureUsage usage);
+		void SetCompression(TextureCompression compression);
 
 	private:
-		void LoadFromSource(Ref<SourceTexture> source);
+		void Reload();
+		void CreateTexture(TextureCache::CookedTexture& texture);
 		void SaveToDisk(const Path& assetPath);
 
 	private:
-		void OnSourceModified();
+		static TextureCache::Settings GetCacheSettings(GUID sourceAsset, TextureUsage usage, TextureCompression compression);
+		static bool LoadCookedTexture(GUID guid, GUID sourceAsset, const TextureCache::Settings& settings, TextureCache::CookedTexture& texture);
 
 	private:
 		GUID m_PixelBufferGUID;
 		VulkanImageDescription m_TextureDescription;
+		TextureUsage m_Usage = TextureUsage::Color;
+		TextureCompression m_Compression = TextureCompression::Default;
 		ResourceID m_Texture;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+#include "BinaryBuffer.h"
+#include "Enums.h"
+
+namespace Odyssey
+{
+	// Cooks decoded textures into a mip chain of GPU ready blocks for the binary cache so loads can skip stb_image
+	class TextureCache
+	{
+	public:
+		inline static constexpr uint32_t Magic = 0x58455443; // "CTEX"
+		inline static constexpr uint32_t Version = 1;
+
+	public:
+		struct Settings
+		{
+			uint64_t SourceHash = 0;
+			TextureUsage Usage = TextureUsage::Color;
+			TextureCompression Compression = TextureCompression::Default;
+		};
+
+		struct CookedTexture
+		{
+			uint32_t Width = 0;
+			uint32_t Height = 0;
+			TextureFormat Format = TextureFormat::R8G8B8A8_UNORM;
+
+			// Byte offset of each mip into the pixel buffer, largest first
+			std::vector<size_t> MipOffsets;
+			BinaryBuffer Pixels;
+		};
+
+	public:
+		static uint64_t HashSource(const Path& sourcePath);
+		static BinaryBuffer Cook(BinaryBuffer& pixels, uint32_t width, uint32_t height, const Settings& settings);
+		static bool Uncook(BinaryBuffer& buffer, const Settings& settings, CookedTexture& texture);
+	};
+}
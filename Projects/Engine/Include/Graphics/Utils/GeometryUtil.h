@@ -9,6 +9,11 @@ namespace Odyssey
 	public:
 		static void GenerateTangents(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices);
 
+	public:
+		// Maps a unit direction onto the [-1, 1] square
+		static float2 OctahedralEncode(float3 normal);
+		static float3 OctahedralDecode(float2 encoded);
+
 	public:
 		static void setHandedness(bool rightHanded);
 		static void ComputeBox(vec3 center, vec3 scale, std::vector<Vertex>& vertices, std::vector<uint32_t>& indices);
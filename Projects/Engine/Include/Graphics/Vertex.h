@@ -11,10 +11,6 @@ namespace Odyssey
 		Vertex(glm::vec3 position, glm::vec4 color);
 		Vertex(glm::vec3 position, glm::vec3 normal, glm::vec2 uv0);
 
-	public:
-		static uint32_t GetOffset(std::string_view attribute);
-		static VkVertexInputBindingDescription GetBindingDescription();
-
 	public:
 		float3 Position = float3(0, 0, 0);
 		float3 Normal = float3(0, 1, 0);
@@ -31,4 +27,30 @@ namespace Odyssey
 		float4 BoneIndices = float4(0, 0, 0, 0);
 		float4 BoneWeights = float4(0, 0, 0, 0);
 	};
+
+	// The layout every vertex buffer uses on the GPU, Vertex is only used to build meshes on the CPU
+	// Normals are octahedral and decoded in the vertex shader, the input assembler expands everything else
+	struct alignas(4) PackedVertex
+	{
+	public:
+		PackedVertex();
+		PackedVertex(const Vertex& vertex);
+
+	public:
+		static std::vector<PackedVertex> Pack(const std::vector<Vertex>& vertices);
+
+		// Returns false when the attribute is not part of the packed layout
+		static bool GetAttribute(std::string_view attribute, uint32_t& offset, VkFormat& format);
+		static VkVertexInputBindingDescription GetBindingDescription();
+
+	public:
+		float3 Position = float3(0, 0, 0);
+		glm::i16vec2 Normal = glm::i16vec2(0, 0);
+		glm::i16vec4 Tangent = glm::i16vec4(0, 0, 0, 0);
+		glm::u8vec4 Color = glm::u8vec4(0, 0, 0, 0);
+		uint32_t TexCoord0 = 0;
+		uint32_t TexCoord1 = 0;
+		glm::u16vec4 BoneIndices = glm::u16vec4(0, 0, 0, 0);
+		glm::u16vec4 BoneWeights = glm::u16vec4(0, 0, 0, 0);
+	};
 }
\ No newline at end of file
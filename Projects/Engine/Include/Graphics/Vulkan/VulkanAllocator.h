@@ -13,7 +13,8 @@ namespace Odyssey
 		~VulkanAllocator();
 
 	public:
-		VmaAllocation AllocateBuffer(VkBufferCreateInfo createInfo, VmaMemoryUsage usage, bool cpuRead, VkBuffer& outBuffer);
+		// Host visible buffers are mapped for their whole lifetime when mappedData is given
+		VmaAllocation AllocateBuffer(VkBufferCreateInfo createInfo, VmaMemoryUsage usage, bool cpuRead, VkBuffer& outBuffer, void** mappedData = nullptr);
 		VmaAllocation AllocateImage(VkImageCreateInfo createInfo, VmaMemoryUsage usage, VkImage& outImage, VkDeviceSize* size = nullptr);
 		void Free(VmaAllocation allocation);
 		void DestroyImage(VkImage image, VmaAllocation allocation);
@@ -28,6 +29,8 @@ namespace Odyssey
 		}
 
 		void UnmapMemory(VmaAllocation allocation);
+		void Flush(VmaAllocation allocation, VkDeviceSize offset, VkDeviceSize size);
+		void Invalidate(VmaAllocation allocation, VkDeviceSize offset, VkDeviceSize size);
 
 	public:
 		static void Init(std::shared_ptr<VulkanContext> context);
@@ -3,6 +3,7 @@
 #include "VulkanGlobals.h"
 #include "Enums.h"
 #include "VulkanAllocator.h"
+#include "VulkanUploadManager.h"
 
 VK_FWD_DECLARE(VkBuffer)
 VK_FWD_DECLARE(VkDeviceMemory)
@@ -18,8 +19,8 @@ namespace Odyssey
 		virtual void Destroy() override;
 
 	public:
-		void CopyData(VkDeviceSize size, const void* data);
-		void UploadData(const void* data, VkDeviceSize size);
+		void CopyData(VkDeviceSize size, const void* data, VkDeviceSize offset = 0);
+		UploadToken UploadData(const void* data, VkDeviceSize size);
 		void CopyBufferMemory(void* dst);
 
 	public:
@@ -27,6 +28,10 @@ namespace Odyssey
 		uint32_t GetSize() { return m_Size; }
 		VkWriteDescriptorSet GetDescriptorInfo();
 
+		// Null for device local buffers
+		uint8_t* GetMappedData() { return m_MappedData; }
+		void Flush(VkDeviceSize offset, VkDeviceSize size);
+
 	public:
 		std::shared_ptr<VulkanContext> m_Context;
 		VkBuffer m_Buffer = nullptr;
@@ -34,5 +39,8 @@ namespace Odyssey
 		BufferType m_BufferType;
 		uint32_t m_Size;
 		VkDescriptorBufferInfo m_Descriptor{};
+
+		// Host visible buffers stay mapped until they are destroyed
+		uint8_t* m_MappedData = nullptr;
 	};
 }
\ No newline at end of file
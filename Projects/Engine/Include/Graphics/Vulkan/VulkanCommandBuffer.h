@@ -37,12 +37,13 @@ namespace Odyssey
 		void Draw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance);
 		void DrawIndexed(uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, uint32_t vertexOffset, uint32_t firstInstance);
 		void TransitionLayouts(ResourceID imageID, VkImageLayout newLayout);
-		void CopyBufferToImage(ResourceID bufferID, ResourceID imageID, uint32_t width, uint32_t height);
+		void CopyBufferToImage(ResourceID bufferID, ResourceID imageID, uint32_t width, uint32_t height, bool generateMips = true);
+		void GenerateMips(ResourceID imageID, uint32_t width, uint32_t height);
 		void BindVertexBuffer(ResourceID vertexBufferID);
 		void CopyBufferToBuffer(ResourceID source, ResourceID destination, size_t dataSize);
 		void CopyImageToImage(ResourceID source, ResourceID destination);
 		void CopyImageToImage(ResourceID source, uint32_t srcMip, uint32_t srcSlice, ResourceID destination, uint32_t dstMip, uint32_t dstSlice, uint width, uint height);
-		void BindIndexBuffer(ResourceID indexBufferID);
+		void BindIndexBuffer(ResourceID indexBufferID, IndexType indexType = IndexType::UInt32);
 		void PushDescriptorsGraphics(VulkanPushDescriptors* descriptors, ResourceID pipelineID);
 		void PushDescriptorsCompute(VulkanPushDescriptors* descriptors, ResourceID pipelineID);
 		void PushConstantsGraphics(ResourceID pipelineID, uint32_t offset, uint32_t size, const void* data);
@@ -17,6 +17,7 @@ namespace Odyssey
 	class VulkanDevice;
 	class VulkanPhysicalDevice;
 	class VulkanQueue;
+	class VulkanUploadManager;
 
 	class VulkanContext: public std::enable_shared_from_this<VulkanContext>
 	{
@@ -35,8 +36,11 @@ namespace Odyssey
 		VkDevice GetDeviceVK();
 		VulkanQueue* GetGraphicsQueue();
 		VulkanQueue* GetComputeQueue();
+		VulkanQueue* GetTransferQueue();
 		const VkQueue GetGraphicsQueueVK();
 		const VkQueue GetComputeQueueVK();
+		const VkQueue GetTransferQueueVK();
+		VulkanUploadManager* GetUploadManager() { return m_UploadManager.get(); }
 		ResourceID GetGraphicsCommandPool() { return m_GraphicsCommandPool; }
 		ResourceID GetComputeCommandPool() { return m_ComputeCommandPool; }
 		uint32_t GetSampleCount() { return m_SampleCount; }
@@ -55,6 +59,8 @@ namespace Odyssey
 		ResourceID m_ComputeCommandPool;
 		std::shared_ptr<VulkanQueue> m_GraphicsQueue;
 		std::shared_ptr<VulkanQueue> m_ComputeQueue;
+		std::shared_ptr<VulkanQueue> m_TransferQueue;
+		std::shared_ptr<VulkanUploadManager> m_UploadManager;
 
 	private:
 		uint32_t m_SampleCount = 1;
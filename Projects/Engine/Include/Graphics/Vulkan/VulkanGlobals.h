@@ -29,6 +29,7 @@ namespace Odyssey
     {
         std::optional<uint32_t> graphicsFamily;
         std::optional<uint32_t> computeFamily;
+        std::optional<uint32_t> transferFamily;
     };
 
     // ALLOCATIONS
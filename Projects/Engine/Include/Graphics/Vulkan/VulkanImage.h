@@ -4,6 +4,7 @@
 #include "Resource.h"
 #include "BinaryBuffer.h"
 #include "VulkanAllocator.h"
+#include "VulkanUploadManager.h"
 
 VK_FWD_DECLARE(VkImage)
 VK_FWD_DECLARE(VkDeviceMemory)
@@ -36,8 +37,9 @@ namespace Odyssey
 		void Destroy();
 
 	public:
-		void SetData(BinaryBuffer& buffer);
-		void SetData(BinaryBuffer& buffer, size_t arrayDepth);
+		UploadToken SetData(BinaryBuffer& buffer);
+		UploadToken SetData(BinaryBuffer& buffer, size_t arrayDepth);
+		UploadToken SetMipData(BinaryBuffer& buffer, const std::vector<size_t>& mipOffsets);
 		void SetLayout(VkImageLayout layout) { imageLayout = layout; }
 
 	public:
@@ -1,6 +1,7 @@
 #pragma once
 #include "VulkanGlobals.h"
 #include "Resource.h"
+#include "VulkanRingBuffer.h"
 
 namespace Odyssey
 {
@@ -10,7 +11,9 @@ namespace Odyssey
 		VulkanPushDescriptors() = default;
 	public:
 		void AddBuffer(ResourceID bufferID, uint32_t bindingIndex);
+		void AddBuffer(const RingAllocation& allocation, uint32_t bindingIndex);
 		void AddTexture(ResourceID textureID, uint32_t bindingIndex);
+		void RemoveLast();
 		void Clear();
 
 	public:
@@ -18,5 +21,8 @@ namespace Odyssey
 	
 	private:
 		std::vector<VkWriteDescriptorSet> m_WriteDescriptors;
+
+		// Offset and range of each sub-allocated buffer, a deque so the write descriptors can point into it
+		std::deque<VkDescriptorBufferInfo> m_BufferRanges;
 	};
 }
\ No newline at end of file
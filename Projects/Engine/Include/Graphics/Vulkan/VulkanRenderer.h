@@ -9,6 +9,7 @@
 #include "VulkanDevice.h"
 #include "VulkanFrame.h"
 #include "VulkanImgui.h"
+#include "VulkanRingBuffer.h"
 #include "VulkanShaderModule.h"
 #include "VulkanSwapchain.h"
 
@@ -63,6 +64,7 @@ namespace Odyssey
 
 	private: // Draws
 		std::vector<std::shared_ptr<RenderScene>> m_RenderScenes;
+		std::shared_ptr<VulkanRingBuffer> m_UniformRing;
 		std::vector<Ref<RenderPass>> m_RenderPasses;
 		std::shared_ptr<ImguiPass> m_IMGUIPass;
 		std::shared_ptr<PerFrameRenderingData> m_RenderingData;
@@ -86,5 +88,8 @@ namespace Odyssey
 
 	private: // Const
 		const float DEFAULT_FONT_SIZE = 18.0f;
+
+		// Starting size of each frame's region in the uniform ring, it grows when a frame runs out
+		inline static constexpr uint32_t Uniform_Ring_Frame_Size = 4 * 1024 * 1024;
 	};
 }
\ No newline at end of file
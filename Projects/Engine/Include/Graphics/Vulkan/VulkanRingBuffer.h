@@ -0,0 +1,73 @@
+#pragma once
+#include "Resource.h"
+#include "Enums.h"
+
+namespace Odyssey
+{
+	class VulkanContext;
+
+	// A slice of a ring buffer, only valid for the frame it was allocated in
+	struct RingAllocation
+	{
+	public:
+		bool IsValid() const { return Data != nullptr; }
+
+	public:
+		ResourceID Buffer;
+		uint32_t Offset = 0;
+		uint32_t Size = 0;
+		uint8_t* Data = nullptr;
+	};
+
+	// One persistently mapped buffer split into a region per frame in flight
+	// Each region is reset when its frame begins, the renderer's frame fences keep the GPU out of it by then
+	class VulkanRingBuffer
+	{
+	public:
+		VulkanRingBuffer(std::shared_ptr<VulkanContext> context, BufferType bufferType, uint32_t frameSize, uint32_t frameCount);
+		void Destroy();
+
+	public:
+		void BeginFrame(uint32_t frameIndex);
+
+		// Allocations written through their data pointer need to be flushed before they are used
+		RingAllocation Allocate(uint32_t size);
+		void Flush(const RingAllocation& allocation);
+
+		template<typename T>
+		RingAllocation Write(const T& data)
+		{
+			RingAllocation allocation = Allocate((uint32_t)sizeof(T));
+			if (allocation.IsValid())
+			{
+				memcpy(allocation.Data, &data, sizeof(T));
+				Flush(allocation);
+			}
+
+			return allocation;
+		}
+
+	public:
+		uint32_t GetFrameSize() { return m_FrameSize; }
+		uint32_t GetAlignment() { return m_Alignment; }
+
+	private:
+		void CreateBuffer();
+		uint32_t Align(uint32_t size) { return (size + m_Alignment - 1) & ~(m_Alignment - 1); }
+
+	private:
+		std::shared_ptr<VulkanContext> m_Context;
+		BufferType m_BufferType;
+		ResourceID m_Buffer;
+		uint8_t* m_MappedData = nullptr;
+
+		uint32_t m_FrameSize = 0;
+		uint32_t m_FrameCount = 0;
+		uint32_t m_FrameIndex = 0;
+		uint32_t m_Alignment = 0;
+		uint32_t m_MaxRange = 0;
+
+		// Offset of the next allocation within the current frame's region
+		uint32_t m_Head = 0;
+	};
+}
@@ -13,7 +13,7 @@ namespace Odyssey
 	{
 	public:
 		VulkanTexture(ResourceID id);
-		VulkanTexture(ResourceID id, std::shared_ptr<VulkanContext> context, VulkanImageDescription description, BinaryBuffer* buffer);
+		VulkanTexture(ResourceID id, std::shared_ptr<VulkanContext> context, VulkanImageDescription description, BinaryBuffer* buffer, std::vector<size_t> mipOffsets = {});
 		VulkanTexture(ResourceID id, std::shared_ptr<VulkanContext> context, ResourceID image, TextureFormat format);
 
 	public:
@@ -0,0 +1,116 @@
+#pragma once
+#include "VulkanGlobals.h"
+#include "Resource.h"
+
+VK_FWD_DECLARE(VkSemaphore)
+
+namespace Odyssey
+{
+	class VulkanContext;
+
+	// Timeline value an upload completes at, 0 when the data was written without a copy
+	using UploadToken = uint64_t;
+
+	// Records buffer and image copies out of one persistently mapped staging ring and submits them together
+	// Copies run on the transfer queue when the device has one, then are handed to the graphics queue
+	class VulkanUploadManager
+	{
+	public:
+		VulkanUploadManager(std::shared_ptr<VulkanContext> context);
+		void Destroy();
+
+	public:
+		UploadToken UploadBuffer(ResourceID destination, const void* data, size_t size, size_t offset = 0);
+
+		// Region buffer offsets are relative to data, mips are generated on the graphics queue when requested
+		UploadToken UploadImage(ResourceID destination, const void* data, size_t size, const std::vector<VkBufferImageCopy>& regions, bool generateMips);
+
+	public:
+		// Submits every copy recorded since the last flush, any graphics work submitted after this can use them
+		void Flush();
+		bool IsComplete(UploadToken token);
+		void Wait(UploadToken token);
+		void WaitIdle();
+
+	private:
+		// Release and acquire are split across the transfer and graphics queues, complete is both on a shared queue
+		enum class Handoff
+		{
+			Release,
+			Acquire,
+			Complete,
+		};
+
+		struct StagingAllocation
+		{
+		public:
+			ResourceID Buffer;
+			VkDeviceSize Offset = 0;
+			uint8_t* Data = nullptr;
+		};
+
+		struct PendingImage
+		{
+		public:
+			ResourceID Image;
+			bool GenerateMips = false;
+		};
+
+		// Everything a submitted batch holds until the timeline passes its value
+		struct UploadBatch
+		{
+		public:
+			uint64_t Value = 0;
+			uint64_t StagingEnd = 0;
+			ResourceID TransferCommands;
+			ResourceID GraphicsCommands;
+			std::vector<ResourceID> StagingBuffers;
+		};
+
+	private:
+		void BeginBatch();
+		StagingAllocation AllocateStaging(size_t size);
+		void RetireBatches();
+		void WaitForValue(uint64_t value);
+		void Submit(VkQueue queue, VkCommandBuffer commandBuffer, uint64_t waitValue, uint64_t signalValue);
+		void RecordHandoff(VkCommandBuffer commandBuffer, Handoff handoff);
+		void GenerateMips(ResourceID commandBufferID);
+
+	private:
+		std::shared_ptr<VulkanContext> m_Context;
+		uint32_t m_TransferFamily = 0;
+		uint32_t m_GraphicsFamily = 0;
+		bool m_DedicatedTransfer = false;
+
+		ResourceID m_TransferCommandPool;
+		VkSemaphore m_Timeline = VK_NULL_HANDLE;
+
+		// Timeline values are reserved when a batch begins so uploads can hand out their token straight away
+		uint64_t m_NextValue = 0;
+		uint64_t m_SubmittedValue = 0;
+		uint64_t m_CompletedValue = 0;
+
+	private: // Staging ring
+		ResourceID m_StagingBuffer;
+		uint8_t* m_StagingData = nullptr;
+
+		// Positions only ever grow, the ring offset is the position modulo the ring size
+		uint64_t m_StagingHead = 0;
+		uint64_t m_StagingTail = 0;
+
+	private: // Recording batch
+		bool m_Recording = false;
+		uint64_t m_BatchValue = 0;
+		ResourceID m_TransferCommands;
+		std::vector<VkBufferMemoryBarrier> m_BufferBarriers;
+		std::vector<PendingImage> m_PendingImages;
+		std::vector<ResourceID> m_BatchStagingBuffers;
+		std::deque<UploadBatch> m_InFlight;
+
+	private:
+		inline static constexpr uint64_t Staging_Ring_Size = 64 * 1024 * 1024;
+
+		// Covers texel sizes and compressed block sizes for copies into images
+		inline static constexpr uint64_t Staging_Alignment = 16;
+	};
+}
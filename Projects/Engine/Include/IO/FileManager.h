@@ -93,6 +93,9 @@ namespace Odyssey
 		std::unordered_map<TrackingID, Path> m_TrackedIDs;
 		efsw::FileWatcher m_Watcher;
 		TrackingID m_NextID = 0;
+
+		// Source assets can be tracked from loader threads
+		ReadWriteLock m_Lock;
 	};
 
 }
\ No newline at end of file
@@ -0,0 +1,37 @@
+#pragma once
+
+namespace Odyssey
+{
+	// Read-only view of a file on disk, mapped into memory where the platform supports it
+	class MappedFile
+	{
+	public:
+		MappedFile() = default;
+		MappedFile(const Path& path);
+		~MappedFile();
+
+	public:
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+	public:
+		operator bool() const { return m_Data != nullptr; }
+		const uint8_t* GetData() const { return m_Data; }
+		size_t GetSize() const { return m_Size; }
+
+	public:
+		void Close();
+
+	private:
+		const uint8_t* m_Data = nullptr;
+		size_t m_Size = 0;
+
+	private:
+#ifdef _WIN32
+		HANDLE m_File = INVALID_HANDLE_VALUE;
+		HANDLE m_Mapping = nullptr;
+#else
+		std::vector<uint8_t> m_Buffer;
+#endif
+	};
+}
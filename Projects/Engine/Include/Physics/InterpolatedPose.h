@@ -0,0 +1,51 @@
+#pragma once
+
+namespace Odyssey
+{
+	// Body pose after the last two fixed steps, blended so the rendered transform moves smoothly between steps
+	struct InterpolatedPose
+	{
+	public:
+		void Reset(float3 position, quat rotation)
+		{
+			PreviousPosition = CurrentPosition = WrittenPosition = position;
+			PreviousRotation = CurrentRotation = WrittenRotation = rotation;
+		}
+
+		void Push(float3 position, quat rotation)
+		{
+			PreviousPosition = CurrentPosition;
+			PreviousRotation = CurrentRotation;
+			CurrentPosition = position;
+			CurrentRotation = rotation;
+		}
+
+		// Alpha is how far the accumulator is into the next step
+		float3 GetPosition(float alpha) { return glm::mix(PreviousPosition, CurrentPosition, alpha); }
+		quat GetRotation(float alpha) { return glm::slerp(PreviousRotation, CurrentRotation, alpha); }
+
+		// True when something other than the physics writeback has moved the transform since
+		bool IsTeleported(float3 position)
+		{
+			return glm::any(glm::epsilonNotEqual(position, WrittenPosition, Position_Epsilon));
+		}
+
+		bool IsTeleported(float3 position, quat rotation)
+		{
+			return IsTeleported(position) || glm::abs(glm::dot(rotation, WrittenRotation)) < 1.0f - Rotation_Epsilon;
+		}
+
+	public:
+		float3 PreviousPosition = float3(0.0f);
+		float3 CurrentPosition = float3(0.0f);
+		float3 WrittenPosition = float3(0.0f);
+		quat PreviousRotation = quat(1.0f, 0.0f, 0.0f, 0.0f);
+		quat CurrentRotation = quat(1.0f, 0.0f, 0.0f, 0.0f);
+		quat WrittenRotation = quat(1.0f, 0.0f, 0.0f, 0.0f);
+
+	private:
+		// Loose enough to absorb the world to local round trip of the writeback
+		inline static constexpr float Position_Epsilon = 1e-3f;
+		inline static constexpr float Rotation_Epsilon = 1e-5f;
+	};
+}
@@ -33,10 +33,14 @@ namespace Odyssey
 	{
 	public: // Singleton
 		static void Init();
-		static void Update();
+		static void Update(float deltaTime);
 		static void Destroy();
 		static PhysicsSystem& Instance() { return *s_Instance; }
 
+	public:
+		// Length of one fixed step at the active project's tick rate
+		static float GetFixedDeltaTime();
+
 	private:
 		PhysicsSystem();
 		~PhysicsSystem();
@@ -52,7 +56,6 @@ namespace Odyssey
 	public:
 		BodyInterface& GetBodyInterface();
 		BodyProperties* GetBodyProperties(BodyID id);
-		BodyLockWrite* GetBodyLock(BodyID bodyID);
 		GameObject GetBodyGameObject(BodyID bodyID);
 		GameObject GetCharacterGameObject(const CharacterVirtual* character);
 		Vec3 GetGravity();
@@ -75,20 +78,61 @@ namespace Odyssey
 		virtual void OnContactAdded(const Body& inBody1, const Body& inBody2, const ContactManifold& inManifold, ContactSettings& ioSettings) override;
 
 	private:
-		void FixedUpdate();
+		void UpdateFrame(float deltaTime);
+		void FixedUpdate(Scene* activeScene, float fixedDeltaTime);
+		void SyncToPhysics(Scene* activeScene);
+		void SyncFromPhysics(Scene* activeScene, float alpha);
+		void PushActiveBodyPoses();
+		void WriteInterpolatedBodies(float alpha);
 		void PreProcessCollisionData();
 		void ProcessCollisionData();
 
-		Body* CreateBody(ShapeRefC shapeRef, float3 position, quat rotation, BodyProperties& properties, PhysicsLayer layer);
+		Body* CreateBody(GameObject& gameObject, ShapeRefC shapeRef, float3 position, quat rotation, BodyProperties& properties, PhysicsLayer layer);
+
+		template<typename ColliderType>
+		void SyncBodiesToPhysics(Scene* activeScene);
 
 	private: // Singleton
 		inline static PhysicsSystem* s_Instance = nullptr;
 
 	private:
-		std::map<BodyID, BodyProperties*> s_BodyProperties;
-		std::map<BodyID, GameObject> s_BodyToGameObject;
+		struct TrackedBody
+		{
+		public:
+			BodyID ID;
+			GameObject Owner;
+			BodyProperties* Properties = nullptr;
+			uint64_t LastActiveStep = 0;
+			bool Interpolating = false;
+		};
+
+		struct BodyState
+		{
+		public:
+			BodyID ID;
+			float3 Position;
+			quat Rotation;
+		};
+
+		TrackedBody* GetTrackedBody(BodyID bodyID);
+
+	private:
+		// Indexed by the body ID's index, the ID stored in the entry rejects recycled indices
+		std::vector<TrackedBody> m_Bodies;
 		std::map<const CharacterVirtual*, GameObject> s_CharacterToGameObject;
 
+	private: // Active body sync
+		uint64_t m_StepCount = 0;
+		BodyIDVector m_ActiveBodies;
+		std::vector<BodyState> m_ActiveBodyStates;
+		std::vector<BodyID> m_InterpolatingBodies;
+
+	private: // Fixed step
+		inline static constexpr uint32_t Default_Tick_Rate = 60;
+		inline static constexpr uint32_t Default_Max_Substeps = 4;
+		float m_Accumulator = 0.0f;
+		Scene* m_SimulatedScene = nullptr;
+
 	private: // Collision
 		ReadWriteLock m_CollisionDataLock;
 		std::unordered_map<uint64_t, CollisionData> m_CollisionData;
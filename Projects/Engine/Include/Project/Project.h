@@ -18,6 +18,8 @@ namespace Odyssey
 		const Path& GetUserScriptsProject() { return m_ProjectSettings.GetScriptsProjectPath(); }
 		const Path& GetTempDirectory() { return m_ProjectSettings.GetTempDirectory(); }
 		const Path& GetAssetRegistry() { return m_ProjectSettings.GetAssetRegistryPath(); }
+		uint32_t GetPhysicsTickRate() { return m_ProjectSettings.GetPhysicsTickRate(); }
+		uint32_t GetMaxPhysicsSubsteps() { return m_ProjectSettings.GetMaxPhysicsSubsteps(); }
 
 	public:
 		static void CreateNewProject(const std::string& projectName, const Path& projectDirectory);
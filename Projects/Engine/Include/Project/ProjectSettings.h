@@ -27,6 +27,10 @@ namespace Odyssey
 		const Path& GetScriptsProjectPath() { return m_FullScriptsProjectPath; }
 		const Path& GetAssetRegistryPath() { return m_FullAssetRegistryPath; }
 
+	public:
+		uint32_t GetPhysicsTickRate() { return m_PhysicsTickRate; }
+		uint32_t GetMaxPhysicsSubsteps() { return m_MaxPhysicsSubsteps; }
+
 	private: // Serialized
 		std::string m_ProjectName;
 		Path m_AssetsDirectory;
@@ -38,6 +42,10 @@ namespace Odyssey
 		Path m_ScriptsProjectPath;
 		Path m_AssetRegistryPath;
 
+		// Fixed physics steps per second and the most steps a single frame may take to catch up
+		uint32_t m_PhysicsTickRate = 60;
+		uint32_t m_MaxPhysicsSubsteps = 4;
+
 	private: // Generated
 		Path m_FullAssetsDirectory;
 		Path m_FullCacheDirectory;
@@ -2,12 +2,13 @@
 #include "Pin.h"
 #include "imgui.hpp"
 #include "GUID.h"
+#include "Ref.h"
 
 namespace Odyssey::Rune
 {
 	class BlueprintBuilder;
 
-	struct Node
+	struct Node : public LocalRefCounted
 	{
 	public:
 		GUID Guid;
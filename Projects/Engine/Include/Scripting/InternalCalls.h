@@ -758,6 +758,84 @@ namespace Odyssey::InternalCalls
 
 #pragma endregion
 
+#pragma region Spatial Query
+
+	static int32_t WriteQueryResults(std::vector<GameObject>& results, uint64_t* guids, int32_t capacity)
+	{
+		// Always report the full count so the caller can retry with a larger buffer
+		int32_t count = 0;
+		for (GameObject& gameObject : results)
+		{
+			if (!gameObject.HasComponent<PropertiesComponent>())
+				continue;
+
+			if (count < capacity)
+				guids[count] = gameObject.GetGUID();
+
+			count++;
+		}
+
+		return count;
+	}
+
+	bool SpatialQuery_Raycast(float3 origin, float3 direction, float maxDistance, uint64_t* hitGUID, float* hitDistance)
+	{
+		Scene* activeScene = SceneManager::GetActiveScene();
+
+		RaycastHit hit;
+		if (!activeScene || !activeScene->GetSpatialIndex().Raycast(origin, direction, maxDistance, hit))
+			return false;
+
+		if (!hit.Object.HasComponent<PropertiesComponent>())
+			return false;
+
+		*hitGUID = hit.Object.GetGUID();
+		*hitDistance = hit.Distance;
+		return true;
+	}
+
+	int32_t SpatialQuery_OverlapSphere(float3 center, float radius, uint64_t* results, int32_t capacity)
+	{
+		Scene* activeScene = SceneManager::GetActiveScene();
+		if (!activeScene)
+			return 0;
+
+		std::vector<GameObject> gameObjects;
+		activeScene->GetSpatialIndex().QuerySphere(center, radius, gameObjects);
+		return WriteQueryResults(gameObjects, results, capacity);
+	}
+
+	int32_t SpatialQuery_OverlapBox(float3 min, float3 max, uint64_t* results, int32_t capacity)
+	{
+		Scene* activeScene = SceneManager::GetActiveScene();
+		if (!activeScene)
+			return 0;
+
+		std::vector<GameObject> gameObjects;
+		activeScene->GetSpatialIndex().QueryBox(BoundingBox(glm::min(min, max), glm::max(min, max)), gameObjects);
+		return WriteQueryResults(gameObjects, results, capacity);
+	}
+
+	int32_t SpatialQuery_OverlapCamera(uint64_t cameraGUID, uint64_t* results, int32_t capacity)
+	{
+		Scene* activeScene = SceneManager::GetActiveScene();
+		if (!activeScene)
+			return 0;
+
+		GameObject gameObject = GetGameObject(cameraGUID);
+		Camera* camera = gameObject.TryGetComponent<Camera>();
+		if (!camera)
+		{
+			Log::Error("[InternalCalls] No camera found for SpatialQuery_OverlapCamera.");
+			return 0;
+		}
+
+		std::vector<GameObject> gameObjects;
+		activeScene->GetSpatialIndex().QueryFrustum(camera->GetFrustum(), gameObjects);
+		return WriteQueryResults(gameObjects, results, capacity);
+	}
+
+#pragma endregion
 
 #pragma region Input
 
@@ -805,5 +883,10 @@ namespace Odyssey::InternalCalls
 		return Time::DeltaTime();
 	}
 
+	float Time_GetFixedDeltaTime()
+	{
+		return Time::FixedDeltaTime();
+	}
+
 #pragma endregion
 }
\ No newline at end of file
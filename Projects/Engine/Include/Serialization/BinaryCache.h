@@ -1,6 +1,7 @@
 #pragma once
 #include "BinaryBuffer.h"
 #include "GUID.h"
+#include "ReadWriteLock.h"
 
 namespace Odyssey
 {
@@ -25,5 +26,6 @@ namespace Odyssey
 		Path m_Path;
 		std::map<GUID, Path> m_GUIDToPath;
 		std::map<Path, GUID> m_PathToGUID;
+		ReadWriteLock m_Lock;
 	};
 }
\ No newline at end of file
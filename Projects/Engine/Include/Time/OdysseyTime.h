@@ -12,10 +12,12 @@ namespace Odyssey
 	public:
 		static float Elapsed() { return s_Elapsed; }
 		static float DeltaTime() { return s_DeltaTime; }
+		static float FixedDeltaTime() { return s_FixedDeltaTime; }
 
 	public:
 		inline static float s_DeltaTime;
 		inline static float s_Elapsed;
+		inline static float s_FixedDeltaTime = 1.0f / 60.0f;
 		inline static Stopwatch s_Stopwatch;
 
 	};
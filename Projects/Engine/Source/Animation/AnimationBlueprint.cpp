@@ -373,7 +373,7 @@ namespace Odyssey
 		ClearTriggers();
 	}
 
-	const std::map<std::string, BlendKey>& AnimationBlueprint::GetKeyframe()
+	const std::vector<BlendKey>& AnimationBlueprint::GetKeyframe(Ref<AnimationRig>& rig)
 	{
 		Ref<AnimationState> nextState;
 		float nextBlendTime = 0.0f;
@@ -407,7 +407,7 @@ namespace Odyssey
 			m_CurrentBlendTime = std::clamp(m_CurrentBlendTime + Time::DeltaTime(), 0.0f, m_EndBlendTime);
 
 			// Evaluate the current state mixing it with the previous state using the blend time as the ratio
-			const auto& keyMap = m_CurrentState->Evaluate(m_PrevState, m_CurrentBlendTime / m_EndBlendTime);
+			const std::vector<BlendKey>& pose = m_CurrentState->Evaluate(rig, m_PrevState, m_CurrentBlendTime / m_EndBlendTime);
 
 			// Check if blending is complete
 			if (m_CurrentBlendTime == m_EndBlendTime)
@@ -419,11 +419,11 @@ namespace Odyssey
 				m_PrevState.Reset();
 			}
 
-			return keyMap;
+			return pose;
 		}
 
 		// No blending so just evaluate the current state
-		return m_CurrentState->Evaluate();
+		return m_CurrentState->Evaluate(rig);
 	}
 
 	Ref<AnimationStateNode> AnimationBlueprint::AddAnimationState(std::string name)
@@ -4,6 +4,33 @@
 
 namespace Odyssey
 {
+	static constexpr double s_KeyEpsilon = 0.000001;
+
+	inline static float3 InterpolateKey(const float3& a, const float3& b, float ratio) { return glm::mix(a, b, ratio); }
+	inline static quat InterpolateKey(const quat& a, const quat& b, float ratio) { return glm::slerp(a, b, ratio); }
+
+	template<typename KeyType, typename ValueType>
+	inline static ValueType SampleKeys(const std::vector<KeyType>& keys, double time, ValueType defaultValue)
+	{
+		if (keys.empty())
+			return defaultValue;
+
+		// Binary search for the first key at or past our time
+		auto next = std::lower_bound(keys.begin(), keys.end(), time,
+			[](const KeyType& key, double time) { return key.Time < time; });
+
+		if (next == keys.begin())
+			return next->Value;
+		else if (next == keys.end())
+			return keys.back().Value;
+		else if (std::abs(next->Time - time) < s_KeyEpsilon)
+			return next->Value;
+
+		auto prev = next - 1;
+		float ratio = (float)((time - prev->Time) / (next->Time - prev->Time));
+		return InterpolateKey(prev->Value, next->Value, ratio);
+	}
+
 	AnimationClip::AnimationClip(const Path& assetPath)
 		: Asset(assetPath)
 	{
@@ -13,11 +40,10 @@ namespace Odyssey
 			LoadFromSource(source);
 		}
 
-		m_Timeline = AnimationClipTimeline(this);
 	}
 
 	AnimationClip::AnimationClip(const Path& assetPath, Ref<SourceModel> sourceModel)
-		: Asset(assetPath), m_Timeline(this)
+		: Asset(assetPath)
 	{
 		sourceModel->AddOnModifiedListener([this]() { OnSourceModified(); });
 
@@ -25,6 +51,21 @@ namespace Odyssey
 		LoadFromSource(sourceModel);
 	}
 
+	AnimationClip::AnimationClip(const Path& assetPath, LoadData& loadData)
+		: Asset(assetPath)
+	{
+		if (loadData.Source)
+		{
+			loadData.Source->AddOnModifiedListener([this]() { OnSourceModified(); });
+			LoadFromSource(loadData.Source);
+		}
+	}
+
+	void AnimationClip::Decode(const Path& assetPath, LoadData& loadData)
+	{
+		loadData.Source = AssetManager::LoadSourceAsset<SourceModel>(Asset::ReadSourceAsset(assetPath));
+	}
+
 	void AnimationClip::Save()
 	{
 		SaveToDisk(m_AssetPath);
@@ -36,46 +77,59 @@ namespace Odyssey
 			LoadFromSource(source);
 	}
 
-	std::map<std::string, BlendKey>& AnimationClip::BlendKeys(float deltaTime)
+	void AnimationClip::Sample(size_t prevFrame, size_t nextFrame, float blendFactor, const std::vector<int32_t>& boneTracks, std::vector<BlendKey>& pose)
 	{
-		return m_Timeline.BlendKeys(deltaTime);
-	}
+		const size_t frameCount = m_FrameTimes.size();
+		const size_t trackCount = m_TrackNames.size();
 
-	void AnimationClip::Reset()
-	{
-		m_Timeline.Reset();
-	}
+		if (prevFrame >= frameCount || nextFrame >= frameCount)
+			return;
 
-	void AnimationClip::SetClipIndex(size_t index)
-	{
-		m_ClipIndex = index;
+		// Grab the rows for both frames
+		const float3* prevPositions = &m_Positions[prevFrame * trackCount];
+		const float3* nextPositions = &m_Positions[nextFrame * trackCount];
+		const quat* prevRotations = &m_Rotations[prevFrame * trackCount];
+		const quat* nextRotations = &m_Rotations[nextFrame * trackCount];
+		const float3* prevScales = &m_Scales[prevFrame * trackCount];
+		const float3* nextScales = &m_Scales[nextFrame * trackCount];
 
-		Load();
-		m_Timeline = AnimationClipTimeline(this);
+		for (size_t i = 0; i < boneTracks.size(); i++)
+		{
+			// Bones without a track keep their current pose
+			const int32_t track = boneTracks[i];
+			if (track < 0 || track >= (int32_t)trackCount)
+				continue;
+
+			BlendKey& key = pose[i];
+			key.Position = glm::mix(prevPositions[track], nextPositions[track], blendFactor);
+			key.Rotation = glm::slerp(prevRotations[track], nextRotations[track], blendFactor);
+			key.Scale = glm::mix(prevScales[track], nextScales[track], blendFactor);
+		}
 	}
 
-	float AnimationClip::GetFrameTime(size_t frameIndex)
+	size_t AnimationClip::FindFrame(float time)
 	{
-		for (auto& [boneName, boneKeyframe] : m_BoneKeyframes)
-		{
-			return boneKeyframe.GetFrameTime(frameIndex);
-		}
+		// TODO: We -1 here because the exporter includes an extra bad frame at the end
+		size_t frameCount = m_FrameTimes.size() > 1 ? m_FrameTimes.size() - 1 : m_FrameTimes.size();
+
+		auto begin = m_FrameTimes.begin();
+		auto end = begin + frameCount;
 
-		return 0.0f;
+		// Find the last frame that starts at or before our time
+		auto next = std::upper_bound(begin, end, time);
+		return next == begin ? 0 : (size_t)(next - begin) - 1;
 	}
 
-	size_t AnimationClip::GetFrameCount()
+	int32_t AnimationClip::GetTrackIndex(const std::string& boneName)
 	{
-		for (auto& [boneName, boneKeyframe] : m_BoneKeyframes)
-		{
-			return boneKeyframe.GetPositionKeys().size();
-		}
-		return 0;
+		auto iter = m_TrackLookup.find(boneName);
+		return iter != m_TrackLookup.end() ? iter->second : -1;
 	}
 
-	float AnimationClip::GetProgress()
+	void AnimationClip::SetClipIndex(size_t index)
 	{
-		return m_Timeline.GetTime() / m_Duration;
+		m_ClipIndex = index;
+		Load();
 	}
 
 	void AnimationClip::LoadFromSource(Ref<SourceModel> source)
@@ -92,11 +146,49 @@ namespace Odyssey
 		m_Name = animationData.Name;
 		m_Duration = animationData.Duration;
 
-		m_BoneKeyframes.clear();
+		Compile(animationData.BoneKeyframes);
+	}
+
+	void AnimationClip::Compile(const std::map<std::string, BoneKeyframe>& boneKeyframes)
+	{
+		m_TrackNames.clear();
+		m_TrackLookup.clear();
+		m_FrameTimes.clear();
+		m_Positions.clear();
+		m_Rotations.clear();
+		m_Scales.clear();
+
+		if (boneKeyframes.empty())
+			return;
+
+		// The importer aligns every bone to the same frame times, use the first bone as the reference
+		for (auto& positionKey : boneKeyframes.begin()->second.GetPositionKeys())
+			m_FrameTimes.push_back((float)positionKey.Time);
+
+		const size_t frameCount = m_FrameTimes.size();
+		const size_t trackCount = boneKeyframes.size();
+
+		m_TrackNames.reserve(trackCount);
+		m_Positions.resize(frameCount * trackCount);
+		m_Rotations.resize(frameCount * trackCount);
+		m_Scales.resize(frameCount * trackCount);
 
-		for (auto& [boneName, boneKeyframe] : animationData.BoneKeyframes)
+		for (auto& [boneName, boneKeyframe] : boneKeyframes)
 		{
-			m_BoneKeyframes[boneName] = BoneKeyframe(boneKeyframe);
+			const size_t track = m_TrackNames.size();
+			m_TrackLookup[boneName] = (int32_t)track;
+			m_TrackNames.push_back(boneName);
+
+			// Resample each channel at the clip's frame times
+			for (size_t frame = 0; frame < frameCount; frame++)
+			{
+				const double time = m_FrameTimes[frame];
+				const size_t index = frame * trackCount + track;
+
+				m_Positions[index] = SampleKeys(boneKeyframe.GetPositionKeys(), time, float3(0.0f));
+				m_Rotations[index] = SampleKeys(boneKeyframe.GetRotationKeys(), time, quat(1, 0, 0, 0));
+				m_Scales[index] = SampleKeys(boneKeyframe.GetScaleKeys(), time, float3(1.0f));
+			}
 		}
 	}
 
@@ -7,59 +7,30 @@ namespace Odyssey
 	AnimationClipTimeline::AnimationClipTimeline(AnimationClip* animationClip)
 		: m_AnimationClip(animationClip)
 	{
-		m_Duration = (float)m_AnimationClip->GetDuration();
+		m_Duration = m_AnimationClip ? (float)m_AnimationClip->GetDuration() : 0.0f;
 		Reset();
 	}
 
-	std::map<std::string, BlendKey>& AnimationClipTimeline::BlendKeys(float deltaTime)
+	void AnimationClipTimeline::Sample(float deltaTime, const std::vector<int32_t>& boneTracks, std::vector<BlendKey>& pose)
 	{
-		m_CurrentTime += deltaTime;
+		if (!m_AnimationClip || m_AnimationClip->GetFrameCount() == 0)
+			return;
 
-		// Load the animation clip and get the bone keyframes
-		std::map<std::string, BoneKeyframe>& boneKeyframes = m_AnimationClip->GetBoneKeyframes();
+		m_CurrentTime += deltaTime;
 
-		// Set our time back to the previous frame's time to re-sync
+		// Wrap our time back into the clip
 		if (m_CurrentTime > m_Duration)
-		{
 			m_CurrentTime = std::fmod(m_CurrentTime, m_Duration);
-			m_PrevFrame = 0;
-			m_NextFrame = 1;
-		}
 
-		// Get the next frame time
-		double nextFrameTime = m_AnimationClip->GetFrameTime(m_NextFrame);
-		double frameTime = m_NextFrame == 0 ? m_AnimationClip->GetDuration() : nextFrameTime;
+		Seek();
 
-		// Continue advancing frames until we catch up to the correct frame time
-		while (m_CurrentTime >= frameTime)
-		{
-			// TODO: We -1 here because the exporter includes an extra bad frame at the end
-			// The real fix is to modify the exporter to include frames up to duration - 1/30.0f.
-			size_t maxFrames = m_AnimationClip->GetFrameCount() - 1;
-
-			// Advance 1 frame forward cycling back to 0 when we reach the last frame
-			m_PrevFrame = m_NextFrame;
-			m_NextFrame = (m_NextFrame + 1) % maxFrames;
+		// Calculate the blend factor based on clip times
+		const double prevTime = m_AnimationClip->GetFrameTime(m_PrevFrame);
+		const double nextTime = m_NextFrame == 0 ? m_Duration : m_AnimationClip->GetFrameTime(m_NextFrame);
+		float blendFactor = nextTime > prevTime ? (float)((m_CurrentTime - prevTime) / (nextTime - prevTime)) : 0.0f;
 
-			// Get the next frame time
-			double nextFrameTime = m_AnimationClip->GetFrameTime(m_NextFrame);
-			frameTime = m_NextFrame == 0 ? m_AnimationClip->GetDuration() : nextFrameTime;
-		}
-
-		for (auto& [boneName, boneKeyframe] : boneKeyframes)
-		{
-			const double prevTime = boneKeyframe.GetFrameTime(m_PrevFrame);
-			const double nextTime = boneKeyframe.GetFrameTime(m_NextFrame);
-
-			// Calculate the blend factor based on clip times
-			double totalTime = nextTime == 0.0 ? m_AnimationClip->GetDuration() : nextTime;
-			float blendFactor = (float)((m_CurrentTime - prevTime) / (totalTime - prevTime));
-
-			// Blend the keys
-			m_BlendKeys[boneName] = boneKeyframe.BlendKeys(m_PrevFrame, m_NextFrame, blendFactor);
-		}
-
-		return m_BlendKeys;
+		// Blend the keys straight into the pose
+		m_AnimationClip->Sample(m_PrevFrame, m_NextFrame, blendFactor, boneTracks, pose);
 	}
 
 	void AnimationClipTimeline::Reset()
@@ -68,4 +39,39 @@ namespace Odyssey
 		m_PrevFrame = 0;
 		m_NextFrame = 1;
 	}
+
+	void AnimationClipTimeline::Seek()
+	{
+		// TODO: We -1 here because the exporter includes an extra bad frame at the end
+		// The real fix is to modify the exporter to include frames up to duration - 1/30.0f.
+		const size_t frameCount = m_AnimationClip->GetFrameCount();
+		const size_t maxFrames = frameCount > 1 ? frameCount - 1 : 1;
+
+		// Single frame clips only ever sample frame 0
+		if (m_NextFrame >= maxFrames)
+			m_NextFrame = 0;
+
+		auto frameEnd = [&](size_t nextFrame)
+			{
+				return nextFrame == 0 ? m_Duration : m_AnimationClip->GetFrameTime(nextFrame);
+			};
+
+		// Fast path: we are still inside the cached frame pair
+		const float prevTime = m_AnimationClip->GetFrameTime(m_PrevFrame);
+		if (m_CurrentTime >= prevTime && m_CurrentTime < frameEnd(m_NextFrame))
+			return;
+
+		// Common case: we advanced exactly one frame
+		const size_t nextFrame = (m_NextFrame + 1) % maxFrames;
+		if (m_CurrentTime >= m_AnimationClip->GetFrameTime(m_NextFrame) && m_CurrentTime < frameEnd(nextFrame))
+		{
+			m_PrevFrame = m_NextFrame;
+			m_NextFrame = nextFrame;
+			return;
+		}
+
+		// Otherwise binary search for the frame
+		m_PrevFrame = m_AnimationClip->FindFrame(m_CurrentTime);
+		m_NextFrame = (m_PrevFrame + 1) % maxFrames;
+	}
 }
\ No newline at end of file
@@ -44,7 +44,7 @@ namespace Odyssey
 
 			if (m_AnimationState->GetClip())
 			{
-				progress = m_AnimationState->GetClip()->GetProgress();
+				progress = m_AnimationState->GetProgress();
 			}
 		}
 
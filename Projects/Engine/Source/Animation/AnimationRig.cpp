@@ -23,6 +23,21 @@ namespace Odyssey
 		LoadFromSource(source);
 	}
 
+	AnimationRig::AnimationRig(const Path& assetPath, LoadData& loadData)
+		: Asset(assetPath)
+	{
+		if (loadData.Source)
+		{
+			loadData.Source->AddOnModifiedListener([this]() { OnSourceModified(); });
+			LoadFromSource(loadData.Source);
+		}
+	}
+
+	void AnimationRig::Decode(const Path& assetPath, LoadData& loadData)
+	{
+		loadData.Source = AssetManager::LoadSourceAsset<SourceModel>(Asset::ReadSourceAsset(assetPath));
+	}
+
 	void AnimationRig::Save()
 	{
 		SaveToDisk(m_AssetPath);
@@ -54,10 +69,36 @@ namespace Odyssey
 			newBone.Index = bone.Index;
 			newBone.ParentIndex = bone.ParentIndex;
 			newBone.InverseBindpose = bone.inverseBindpose;
+			newBone.Bindpose = glm::inverse(bone.inverseBindpose);
 
 			if (bone.ParentIndex == -1)
 				m_RootBone = bone.Index;
 		}
+
+		BuildEvaluationOrder();
+	}
+
+	void AnimationRig::BuildEvaluationOrder()
+	{
+		// Order the bones so every parent comes before its children
+		m_EvaluationOrder.clear();
+		m_EvaluationOrder.reserve(m_Bones.size());
+
+		std::vector<std::vector<uint32_t>> children(m_Bones.size());
+		for (size_t i = 0; i < m_Bones.size(); i++)
+		{
+			int32_t parentIndex = m_Bones[i].ParentIndex;
+			if (parentIndex < 0)
+				m_EvaluationOrder.push_back((uint32_t)i);
+			else
+				children[parentIndex].push_back((uint32_t)i);
+		}
+
+		for (size_t i = 0; i < m_EvaluationOrder.size(); i++)
+		{
+			for (uint32_t child : children[m_EvaluationOrder[i]])
+				m_EvaluationOrder.push_back(child);
+		}
 	}
 
 	void AnimationRig::SaveToDisk(const Path& assetPath)
@@ -2,6 +2,7 @@
 #include "AnimationNodes.h"
 #include "AssetManager.h"
 #include "AnimationClip.h"
+#include "SourceModel.h"
 #include "OdysseyTime.h"
 
 namespace Odyssey
@@ -18,34 +19,34 @@ namespace Odyssey
 		SetClip(animationClip);
 	}
 
-	std::map<std::string, BlendKey>& AnimationState::Evaluate()
+	const std::vector<BlendKey>& AnimationState::Evaluate(Ref<AnimationRig>& rig)
 	{
-		return m_AnimationClip->BlendKeys(Time::DeltaTime());
+		BindRig(rig);
+		m_Timeline.Sample(Time::DeltaTime(), m_BoneTracks, m_Pose);
+		return m_Pose;
 	}
 
-	std::map<std::string, BlendKey>& AnimationState::Evaluate(Ref<AnimationState>& prevState, float blendFactor)
+	const std::vector<BlendKey>& AnimationState::Evaluate(Ref<AnimationRig>& rig, Ref<AnimationState>& prevState, float blendFactor)
 	{
-		std::map<std::string, BlendKey>& currentKeys = m_AnimationClip->BlendKeys(Time::DeltaTime());
-		std::map<std::string, BlendKey>& prevKeys = prevState->Evaluate();
+		Evaluate(rig);
+		const std::vector<BlendKey>& prevPose = prevState->Evaluate(rig);
 
-		for (auto& [boneName, currentKey] : currentKeys)
+		for (size_t i = 0; i < m_Pose.size(); i++)
 		{
-			if (prevKeys.contains(boneName))
-			{
-				BlendKey& prevKey = prevKeys[boneName];
-
-				currentKey.Position = glm::mix(prevKey.Position, currentKey.Position, blendFactor);
-				currentKey.Rotation = glm::slerp(prevKey.Rotation, currentKey.Rotation, blendFactor);
-				currentKey.Scale = glm::mix(prevKey.Scale, currentKey.Scale, blendFactor);
-			}
+			BlendKey& currentKey = m_Pose[i];
+			const BlendKey& prevKey = prevPose[i];
+
+			currentKey.Position = glm::mix(prevKey.Position, currentKey.Position, blendFactor);
+			currentKey.Rotation = glm::slerp(prevKey.Rotation, currentKey.Rotation, blendFactor);
+			currentKey.Scale = glm::mix(prevKey.Scale, currentKey.Scale, blendFactor);
 		}
 
-		return currentKeys;
+		return m_Pose;
 	}
 
 	void AnimationState::Reset()
 	{
-		m_AnimationClip->Reset();
+		m_Timeline.Reset();
 	}
 
 	std::string_view AnimationState::GetName()
@@ -61,5 +62,38 @@ namespace Odyssey
 	void AnimationState::SetClip(GUID guid)
 	{
 		m_AnimationClip = AssetManager::LoadAsset<AnimationClip>(guid);
+
+		// An empty or missing clip leaves an empty timeline that never samples
+		m_Timeline = m_AnimationClip ? AnimationClipTimeline(m_AnimationClip.Get()) : AnimationClipTimeline();
+
+		// Force the bone tracks to be resolved against the new clip
+		m_BoundRig = GUID::Empty();
+	}
+
+	void AnimationState::BindRig(Ref<AnimationRig>& rig)
+	{
+		if (m_BoundRig == rig->GetGUID() && m_BoneTracks.size() == rig->GetBones().size())
+			return;
+
+		const std::vector<Bone>& bones = rig->GetBones();
+		m_BoundRig = rig->GetGUID();
+
+		// Resolve each rig bone to a clip track so sampling never touches bone names
+		m_BoneTracks.resize(bones.size());
+		for (size_t i = 0; i < bones.size(); i++)
+			m_BoneTracks[i] = m_AnimationClip ? m_AnimationClip->GetTrackIndex(bones[i].Name) : -1;
+
+		// Bones without a track rest at their local bind pose
+		m_Pose.resize(bones.size());
+		for (size_t i = 0; i < bones.size(); i++)
+		{
+			const Bone& bone = bones[i];
+			glm::mat4 localBindpose = bone.ParentIndex > -1 ? glm::inverse(bones[bone.ParentIndex].Bindpose) * bone.Bindpose : bone.Bindpose;
+
+			glm::vec3 skew;
+			glm::vec4 perspective;
+			BlendKey& key = m_Pose[i];
+			glm::decompose(localBindpose, key.Scale, key.Rotation, key.Position, skew, perspective);
+		}
 	}
 }
\ No newline at end of file
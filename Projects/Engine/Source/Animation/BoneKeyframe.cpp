@@ -5,35 +5,32 @@ namespace Odyssey
 	static constexpr double s_Epsilon = 0.000001;
 
 	template<typename KeyType>
-	inline static void FindKeys(double time, std::vector<KeyType>& keys, KeyType& outPrev, KeyType& outNext, bool loop)
+	inline static void FindKeys(double time, const std::vector<KeyType>& keys, KeyType& outPrev, KeyType& outNext, bool loop)
 	{
-		for (size_t i = 0; i < keys.size(); i++)
-		{
-			// Look for the first key frame past our time
-			if (keys[i].Time >= time)
-			{
-				// That's our next key
-				outNext = keys[i];
+		// Binary search for the first key frame past our time
+		auto next = std::lower_bound(keys.begin(), keys.end(), time,
+			[](const KeyType& key, double time) { return key.Time < time; });
 
-				// Use the previous key directly
-				if (i > 0)
-				{
-					outPrev = keys[i - 1];
-				}
-				// Rare case where key 0 is our next key
-				else
-				{
-					if (loop)
-						// Loop back to the end of the animation as our previous
-						outPrev = keys[keys.size() - 1];
-					else
-						// Don't loop, so we don't blend the animation
-						outPrev = keys[i];
-				}
+		if (next == keys.end())
+			return;
 
-				// Break out
-				break;
-			}
+		// That's our next key
+		outNext = *next;
+
+		// Use the previous key directly
+		if (next != keys.begin())
+		{
+			outPrev = *(next - 1);
+		}
+		// Rare case where key 0 is our next key
+		else
+		{
+			if (loop)
+				// Loop back to the end of the animation as our previous
+				outPrev = keys.back();
+			else
+				// Don't loop, so we don't blend the animation
+				outPrev = *next;
 		}
 	}
 
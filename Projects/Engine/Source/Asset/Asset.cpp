@@ -82,6 +82,20 @@ namespace Odyssey
 		}
 	}
 
+	GUID Asset::ReadSourceAsset(const Path& assetPath)
+	{
+		GUID sourceAsset;
+
+		AssetDeserializer deserializer(assetPath);
+		if (deserializer.IsValid())
+		{
+			SerializationNode root = deserializer.GetRoot();
+			root.ReadData("m_SourceAsset", sourceAsset.Ref());
+		}
+
+		return sourceAsset;
+	}
+
 	void Asset::SetName(std::string_view name)
 	{
 		m_Name = name;
@@ -26,6 +26,7 @@ namespace Odyssey
 		FolderTracker::Options options;
 		options.Extensions = supportedExtensions;
 		options.Recursive = true;
+		options.IncludeDirectoryChanges = true;
 		options.Callback = [this](const Path& oldPath, const Path& newPath, FileActionType fileAction) { OnFileAction(oldPath, newPath, fileAction); };
 		m_TrackingID = FileManager::Get().TrackFolder(searchOptions.Root, options);
 
@@ -35,171 +36,324 @@ namespace Odyssey
 		{
 			AddRegistry(registry);
 		}
+
+		LoadIndex();
 		Scan();
 	}
 
 	void AssetDatabase::Scan()
 	{
+		m_Lock.Lock(LockState::Write);
 		ScanForAssets();
-		ScanForSourceAssets();
+		SaveChanges();
+		m_Lock.Unlock(LockState::Write);
 	}
 
 	AssetRegistry AssetDatabase::CreateRegistry()
 	{
 		AssetRegistry registry;
 
+		m_Lock.Lock(LockState::Read);
+
 		for (auto& [guid, metadata] : m_GUIDToMetadata)
 		{
 			Path relativePath = std::filesystem::relative(metadata.AssetPath, m_SearchOptions.Root);
 			registry.AddAsset(metadata.AssetName, metadata.AssetType, relativePath, guid);
 		}
 
+		m_Lock.Unlock(LockState::Read);
+
 		return registry;
 	}
 
 	void AssetDatabase::AddRegistry(const AssetRegistry& registry)
 	{
+		m_Lock.Lock(LockState::Write);
+
 		for (auto& entry : registry.Entries)
 		{
-			bool sourceAsset = Odyssey::Contains(m_SearchOptions.Extensions, entry.Path.extension().string());
+			bool sourceAsset = m_SearchOptions.SourceExtensionsMap.contains(entry.Path.extension().string());
 			AddRegistryAsset(entry.Guid, registry.RootDirectory / entry.Path, entry.Path.filename().replace_extension().string(), entry.Type, sourceAsset);
 		}
+
+		m_Lock.Unlock(LockState::Write);
 	}
 
 	void AssetDatabase::ScanForAssets()
 	{
+		std::set<Path> foundPaths;
+
+		// A single pass covers both assets and source assets
 		for (const auto& dirEntry : std::filesystem::recursive_directory_iterator(m_SearchOptions.Root))
 		{
-			// Skip assets we are already tracking
-			if (m_AssetPathToGUID.contains(dirEntry))
-				continue;
+			if (dirEntry.is_regular_file() && ScanFile(dirEntry))
+				foundPaths.insert(dirEntry.path());
+		}
 
-			bool excluded = false;
+		// Anything left in the index that wasn't found has been removed while we weren't watching
+		std::vector<Path> removedPaths;
 
-			if (!m_SearchOptions.ExclusionPaths.empty())
-			{
-				// Check if this path matches anything in the exclusion list
-				for (const auto& path : m_SearchOptions.ExclusionPaths)
-				{
-					auto pathCompare = std::filesystem::relative(dirEntry, path);
-					if (!pathCompare.empty() && pathCompare.native()[0] != '.')
-					{
-						excluded = true;
-						break;
-					}
-				}
-			}
+		for (auto& [path, indexEntry] : m_Index)
+		{
+			if (!foundPaths.contains(path))
+				removedPaths.push_back(path);
+		}
 
-			// Skip if this path should be excluded
-			if (excluded)
-				continue;
+		for (const Path& path : removedPaths)
+			RemoveAsset(path);
+	}
 
-			auto path = dirEntry.path();
-			auto extension = path.extension();
+	bool AssetDatabase::ScanFile(const std::filesystem::directory_entry& dirEntry)
+	{
+		const Path& path = dirEntry.path();
+		std::string extension = path.extension().string();
 
-			if (dirEntry.is_regular_file())
-			{
-				for (const auto& searchExt : m_SearchOptions.Extensions)
-				{
-					// Check if this is a valid extension
-					if (extension == searchExt)
-					{
-						AssetDeserializer deserializer(path);
-						if (deserializer.IsValid())
-						{
-							SerializationNode root = deserializer.GetRoot();
-
-							// Deserialize the asset's metadata
-							GUID guid;
-							std::string type, name;
-							root.ReadData("m_GUID", guid.Ref());
-							root.ReadData("m_Type", type);
-							root.ReadData("m_Name", name);
-
-							AddAsset(guid, path, name, type, false);
-						}
-					}
-				}
-			}
+		// Check if this is a valid extension
+		bool sourceAsset = m_SearchOptions.SourceExtensionsMap.contains(extension);
+		if (!sourceAsset && !Odyssey::Contains(m_SearchOptions.Extensions, extension))
+			return false;
+
+		// Skip if this path should be excluded
+		if (IsExcluded(path))
+			return false;
+
+		std::error_code timeError, sizeError;
+		int64_t writeTime = dirEntry.last_write_time(timeError).time_since_epoch().count();
+		uint64_t fileSize = dirEntry.file_size(sizeError);
+
+		if (timeError || sizeError)
+			return false;
+
+		auto indexIter = m_Index.find(path);
+		auto pathIter = m_AssetPathToGUID.find(path);
+
+		// Files that haven't changed since the last scan are never opened
+		if (indexIter != m_Index.end() && indexIter->second.WriteTime == writeTime && indexIter->second.FileSize == fileSize)
+		{
+			const IndexEntry& indexEntry = indexIter->second;
+
+			if (pathIter == m_AssetPathToGUID.end())
+				InsertAsset(indexEntry.Guid, path, indexEntry.Name, indexEntry.Type, indexEntry.IsSourceAsset);
+
+			return true;
+		}
+
+		IndexEntry indexEntry;
+		indexEntry.WriteTime = writeTime;
+		indexEntry.FileSize = fileSize;
+		indexEntry.IsSourceAsset = sourceAsset;
+
+		if (indexIter == m_Index.end() && pathIter != m_AssetPathToGUID.end() && m_GUIDToMetadata.contains(pathIter->second))
+		{
+			// Registered assets we haven't indexed yet are trusted as-is
+			const AssetMetadata& metadata = m_GUIDToMetadata[pathIter->second];
+			indexEntry.Guid = pathIter->second;
+			indexEntry.Name = metadata.AssetName;
+			indexEntry.Type = metadata.AssetType;
 		}
+		else if (sourceAsset)
+		{
+			indexEntry.Name = path.filename().replace_extension("").string();
+			indexEntry.Type = m_SearchOptions.SourceExtensionsMap[extension];
+
+			// Source assets keep the guid they were first given
+			if (pathIter != m_AssetPathToGUID.end())
+				indexEntry.Guid = pathIter->second;
+			else if (indexIter != m_Index.end())
+				indexEntry.Guid = indexIter->second.Guid;
+			else
+				indexEntry.Guid = GUID::New();
+		}
+		else
+		{
+			AssetDeserializer deserializer(path);
+			if (!deserializer.IsValid())
+				return false;
+
+			// Deserialize the asset's metadata
+			SerializationNode root = deserializer.GetRoot();
+			root.ReadData("m_GUID", indexEntry.Guid.Ref());
+			root.ReadData("m_Type", indexEntry.Type);
+			root.ReadData("m_Name", indexEntry.Name);
+		}
+
+		// The file now holds a different asset than the one we had registered
+		if (pathIter != m_AssetPathToGUID.end() && pathIter->second != indexEntry.Guid)
+			RemoveAsset(path);
+
+		InsertAsset(indexEntry.Guid, path, indexEntry.Name, indexEntry.Type, indexEntry.IsSourceAsset);
+
+		m_Index[path] = indexEntry;
+		m_IndexDirty = true;
+
+		return true;
 	}
 
-	void AssetDatabase::ScanForSourceAssets()
+	void AssetDatabase::RemoveAsset(const Path& path)
 	{
-		for (const auto& dirEntry : std::filesystem::recursive_directory_iterator(m_SearchOptions.Root))
+		if (m_Index.erase(path) > 0)
+			m_IndexDirty = true;
+
+		auto pathIter = m_AssetPathToGUID.find(path);
+		if (pathIter == m_AssetPathToGUID.end())
+			return;
+
+		GUID guid = pathIter->second;
+		m_AssetPathToGUID.erase(pathIter);
+
+		// Only drop the metadata if it still belongs to this path
+		auto metadataIter = m_GUIDToMetadata.find(guid);
+		if (metadataIter != m_GUIDToMetadata.end() && metadataIter->second.AssetPath == path)
 		{
-			// Skip assets we are already tracking
-			if (m_AssetPathToGUID.contains(dirEntry))
-				continue;
+			std::erase(m_AssetTypeToGUIDs[metadataIter->second.AssetType], guid);
+			m_GUIDToMetadata.erase(metadataIter);
 
-			auto assetPath = dirEntry.path();
-			auto extension = assetPath.extension().string();
+			m_ProjectRegistry.RemoveAsset(guid);
+			m_RegistryDirty = true;
+		}
+	}
 
-			// Check if the file extension is a valid source asset
-			if (dirEntry.is_regular_file() && m_SearchOptions.SourceExtensionsMap.contains(extension))
-			{
-				std::string name = assetPath.filename().replace_extension("").string();
-				std::string type = m_SearchOptions.SourceExtensionsMap[extension];
+	void AssetDatabase::MoveAsset(const Path& oldPath, const Path& newPath)
+	{
+		auto pathIter = m_AssetPathToGUID.find(oldPath);
+		if (pathIter == m_AssetPathToGUID.end())
+		{
+			// We never knew about the old path, treat it as a new file
+			ScanFile(std::filesystem::directory_entry(newPath));
+			return;
+		}
 
-				// Add the source asset to the database
-				GUID guid = GUID::New();
-				AddAsset(guid, assetPath, name, type, true);
-			}
+		GUID guid = pathIter->second;
+		m_AssetPathToGUID.erase(pathIter);
+		m_AssetPathToGUID[newPath] = guid;
+
+		if (auto metadataIter = m_GUIDToMetadata.find(guid); metadataIter != m_GUIDToMetadata.end())
+			metadataIter->second.AssetPath = newPath;
+
+		// The registry tracks its own moves, we only need to re-key the index
+		auto indexNode = m_Index.extract(oldPath);
+		if (!indexNode.empty())
+		{
+			indexNode.key() = newPath;
+			m_Index.insert(std::move(indexNode));
+			m_IndexDirty = true;
 		}
 	}
 
-	void AssetDatabase::AddAsset(GUID guid, const Path& path, const std::string& assetName, const std::string& assetType, bool sourceAsset)
+	std::vector<Path> AssetDatabase::GetPathsInDirectory(const Path& directory)
 	{
-		if (!m_GUIDToMetadata.contains(guid))
-			m_GUIDToMetadata[guid] = AssetMetadata(path, assetName, assetType, sourceAsset);
+		// Paths compare element by element so everything inside the directory sorts right after it
+		auto IsInDirectory = [&directory](const Path& path)
+			{
+				auto [directoryIter, pathIter] = std::mismatch(directory.begin(), directory.end(), path.begin(), path.end());
+				return directoryIter == directory.end() && pathIter != path.end();
+			};
 
-		if (!path.empty() && !m_AssetPathToGUID.contains(path))
-			m_AssetPathToGUID[path] = guid;
+		std::set<Path> paths;
 
-		// No contains check since we are storing multiple guids per asset type
-		m_AssetTypeToGUIDs[assetType].push_back(guid);
+		for (auto iter = m_Index.upper_bound(directory); iter != m_Index.end() && IsInDirectory(iter->first); ++iter)
+			paths.insert(iter->first);
 
-		if (guid && !path.empty() && !assetName.empty() && !assetType.empty())
+		for (auto iter = m_AssetPathToGUID.upper_bound(directory); iter != m_AssetPathToGUID.end() && IsInDirectory(iter->first); ++iter)
+			paths.insert(iter->first);
+
+		return std::vector<Path>(paths.begin(), paths.end());
+	}
+
+	bool AssetDatabase::IsExcluded(const Path& path)
+	{
+		// Check if this path matches anything in the exclusion list
+		for (const auto& exclusionPath : m_SearchOptions.ExclusionPaths)
 		{
-			Path relativePath = std::filesystem::relative(path, m_ProjectRegistry.RootDirectory);
-			m_ProjectRegistry.AddAsset(assetName, assetType, relativePath, guid);
-			m_ProjectRegistry.Save();
+			auto pathCompare = std::filesystem::relative(path, exclusionPath);
+			if (!pathCompare.empty() && pathCompare.native()[0] != '.')
+				return true;
 		}
+
+		return false;
+	}
+
+	void AssetDatabase::AddAsset(GUID guid, const Path& path, const std::string& assetName, const std::string& assetType, bool sourceAsset)
+	{
+		m_Lock.Lock(LockState::Write);
+		InsertAsset(guid, path, assetName, assetType, sourceAsset);
+		SaveChanges();
+		m_Lock.Unlock(LockState::Write);
 	}
 
 	bool AssetDatabase::Contains(GUID& guid)
 	{
-		return m_GUIDToMetadata.contains(guid);
+		m_Lock.Lock(LockState::Read);
+		bool contains = m_GUIDToMetadata.contains(guid);
+		m_Lock.Unlock(LockState::Read);
+
+		return contains;
 	}
 
 	bool AssetDatabase::Contains(const Path& path)
 	{
-		return m_AssetPathToGUID.contains(path);
+		m_Lock.Lock(LockState::Read);
+		bool contains = m_AssetPathToGUID.contains(path);
+		m_Lock.Unlock(LockState::Read);
+
+		return contains;
 	}
 
 	bool AssetDatabase::IsSourceAsset(const Path& path)
 	{
+		bool sourceAsset = false;
+
+		m_Lock.Lock(LockState::Read);
+
 		if (m_AssetPathToGUID.contains(path) && m_GUIDToMetadata.contains(m_AssetPathToGUID[path]))
-			return m_GUIDToMetadata[m_AssetPathToGUID[path]].IsSourceAsset;
+			sourceAsset = m_GUIDToMetadata[m_AssetPathToGUID[path]].IsSourceAsset;
 
-		return false;
+		m_Lock.Unlock(LockState::Read);
+
+		return sourceAsset;
+	}
+
+	void AssetDatabase::InsertAsset(GUID guid, const Path& path, const std::string& assetName, const std::string& assetType, bool sourceAsset)
+	{
+		if (!m_GUIDToMetadata.contains(guid))
+			m_GUIDToMetadata[guid] = AssetMetadata(path, assetName, assetType, sourceAsset);
+
+		if (!path.empty() && !m_AssetPathToGUID.contains(path))
+			m_AssetPathToGUID[path] = guid;
+
+		// No contains check since we are storing multiple guids per asset type
+		m_AssetTypeToGUIDs[assetType].push_back(guid);
+
+		if (guid && !path.empty() && !assetName.empty() && !assetType.empty())
+		{
+			// The registry is saved once the whole batch has been added
+			Path relativePath = path.lexically_relative(m_ProjectRegistry.RootDirectory);
+			m_ProjectRegistry.AddAsset(assetName, assetType, relativePath, guid);
+			m_RegistryDirty = true;
+		}
 	}
 
 	void AssetDatabase::UpdateAssetName(GUID guid, const std::string& name)
 	{
+		m_Lock.Lock(LockState::Write);
+
 		if (m_GUIDToMetadata.contains(guid))
 		{
 			m_GUIDToMetadata[guid].AssetName = name;
 			m_ProjectRegistry.UpdateAssetName(guid, name);
 		}
+
+		m_Lock.Unlock(LockState::Write);
 	}
 
 	void AssetDatabase::UpdateAssetPath(GUID guid, const Path& path)
 	{
+		m_Lock.Lock(LockState::Write);
+
 		if (m_GUIDToMetadata.contains(guid))
 		{
 			// Cache the old path so we can remove it
-			const Path& oldPath = m_GUIDToMetadata[guid].AssetPath;
+			Path oldPath = m_GUIDToMetadata[guid].AssetPath;
 
 			// Update the path in our lookups
 			m_GUIDToMetadata[guid].AssetPath = path;
@@ -208,54 +362,104 @@ namespace Odyssey
 			// Remove the old path
 			m_AssetPathToGUID.erase(oldPath);
 
+			// Re-key the index so the move doesn't look like a new file on the next scan
+			auto indexNode = m_Index.extract(oldPath);
+			if (!indexNode.empty())
+			{
+				indexNode.key() = path;
+				m_Index.insert(std::move(indexNode));
+				SaveIndex();
+			}
+
 			// Update the project registry
 			m_ProjectRegistry.UpdateAssetPath(guid, path);
 		}
+
+		m_Lock.Unlock(LockState::Write);
 	}
 
 	Path AssetDatabase::GUIDToAssetPath(GUID guid)
 	{
-		if (m_GUIDToMetadata.contains(guid))
-			return m_GUIDToMetadata[guid].AssetPath;
+		Path assetPath;
+
+		m_Lock.Lock(LockState::Read);
 
-		return std::filesystem::path();
+		if (auto iter = m_GUIDToMetadata.find(guid); iter != m_GUIDToMetadata.end())
+			assetPath = iter->second.AssetPath;
+
+		m_Lock.Unlock(LockState::Read);
+
+		return assetPath;
 	}
 
 	std::string AssetDatabase::GUIDToAssetName(GUID guid)
 	{
-		if (m_GUIDToMetadata.contains(guid))
-			return m_GUIDToMetadata[guid].AssetName;
+		std::string assetName;
+
+		m_Lock.Lock(LockState::Read);
+
+		if (auto iter = m_GUIDToMetadata.find(guid); iter != m_GUIDToMetadata.end())
+			assetName = iter->second.AssetName;
 
-		return std::string();
+		m_Lock.Unlock(LockState::Read);
+
+		return assetName;
 	}
 
 	std::string AssetDatabase::GUIDToAssetType(GUID guid)
 	{
-		if (m_GUIDToMetadata.contains(guid))
-			return m_GUIDToMetadata[guid].AssetType;
+		std::string assetType;
+
+		m_Lock.Lock(LockState::Read);
 
-		return std::string();
+		if (auto iter = m_GUIDToMetadata.find(guid); iter != m_GUIDToMetadata.end())
+			assetType = iter->second.AssetType;
+
+		m_Lock.Unlock(LockState::Read);
+
+		return assetType;
 	}
 
 	GUID AssetDatabase::AssetPathToGUID(const Path& assetPath)
 	{
-		if (m_AssetPathToGUID.contains(assetPath))
-			return m_AssetPathToGUID[assetPath];
+		GUID guid = GUID::Empty();
+
+		m_Lock.Lock(LockState::Read);
 
-		return GUID::Empty();
+		if (auto iter = m_AssetPathToGUID.find(assetPath); iter != m_AssetPathToGUID.end())
+			guid = iter->second;
+
+		m_Lock.Unlock(LockState::Read);
+
+		return guid;
 	}
 
 	std::vector<GUID> AssetDatabase::GetGUIDsOfAssetType(const std::string& assetType)
 	{
-		if (m_AssetTypeToGUIDs.contains(assetType))
-			return m_AssetTypeToGUIDs[assetType];
+		std::vector<GUID> guids;
+
+		m_Lock.Lock(LockState::Read);
 
-		return std::vector<GUID>();
+		if (auto iter = m_AssetTypeToGUIDs.find(assetType); iter != m_AssetTypeToGUIDs.end())
+			guids = iter->second;
+
+		m_Lock.Unlock(LockState::Read);
+
+		return guids;
 	}
 
-	const AssetMetadata& AssetDatabase::GetMetadata(GUID guid)
+	AssetMetadata AssetDatabase::GetMetadata(GUID guid)
 	{
-		return m_GUIDToMetadata[guid];
+		AssetMetadata metadata;
+
+		m_Lock.Lock(LockState::Read);
+
+		if (auto iter = m_GUIDToMetadata.find(guid); iter != m_GUIDToMetadata.end())
+			metadata = iter->second;
+
+		m_Lock.Unlock(LockState::Read);
+
+		return metadata;
 	}
 
 	void AssetDatabase::AddRegistryAsset(GUID guid, const Path& path, const std::string& assetName, const std::string& assetType, bool sourceAsset)
@@ -272,7 +476,167 @@ namespace Odyssey
 
 	void AssetDatabase::OnFileAction(const Path& oldFilename, const Path& newFilename, FileActionType fileAction)
 	{
-		if (fileAction != FileActionType::None && fileAction != FileActionType::Modified)
-			Scan();
+		m_Lock.Lock(LockState::Write);
+
+		if (std::filesystem::is_directory(newFilename))
+		{
+			// Directory changes don't report the files inside them, the index keeps this rescan cheap
+			if (fileAction != FileActionType::Modified)
+				ScanForAssets();
+		}
+		else
+		{
+			// Only the file that changed is touched
+			switch (fileAction)
+			{
+				case FileActionType::Add:
+				case FileActionType::Modified:
+				{
+					std::error_code error;
+					std::filesystem::directory_entry dirEntry(newFilename, error);
+					if (!error && dirEntry.is_regular_file())
+						ScanFile(dirEntry);
+					break;
+				}
+				case FileActionType::Delete:
+				{
+					// A deleted directory is gone before we hear about it, so drop everything that was inside it
+					if (m_Index.contains(newFilename) || m_AssetPathToGUID.contains(newFilename))
+					{
+						RemoveAsset(newFilename);
+					}
+					else
+					{
+						for (const Path& path : GetPathsInDirectory(newFilename))
+							RemoveAsset(path);
+					}
+					break;
+				}
+				case FileActionType::Moved:
+				{
+					// Same for a renamed directory that has changed again before we hear about it
+					if (m_Index.contains(oldFilename) || m_AssetPathToGUID.contains(oldFilename))
+					{
+						MoveAsset(oldFilename, newFilename);
+					}
+					else
+					{
+						for (const Path& path : GetPathsInDirectory(oldFilename))
+							MoveAsset(path, newFilename / std::filesystem::relative(path, oldFilename));
+					}
+					break;
+				}
+				default:
+					break;
+			}
+		}
+
+		SaveChanges();
+		m_Lock.Unlock(LockState::Write);
+	}
+
+	void AssetDatabase::SaveChanges()
+	{
+		if (m_RegistryDirty)
+		{
+			m_ProjectRegistry.Save();
+			m_RegistryDirty = false;
+		}
+
+		if (m_IndexDirty)
+		{
+			SaveIndex();
+			m_IndexDirty = false;
+		}
+	}
+
+	void AssetDatabase::LoadIndex()
+	{
+		m_Index.clear();
+
+		if (m_SearchOptions.IndexPath.empty())
+			return;
+
+		std::ifstream file(m_SearchOptions.IndexPath, std::ios::binary);
+		if (!file.is_open())
+			return;
+
+		auto readString = [&file](std::string& str)
+			{
+				uint32_t length = 0;
+				file.read((char*)&length, sizeof(uint32_t));
+				str.resize(length);
+				file.read(str.data(), length);
+			};
+
+		// A stale or foreign index is simply rebuilt by the next scan
+		uint32_t magic = 0, version = 0, entryCount = 0;
+		file.read((char*)&magic, sizeof(uint32_t));
+		file.read((char*)&version, sizeof(uint32_t));
+		file.read((char*)&entryCount, sizeof(uint32_t));
+
+		if (!file || magic != Index_Magic || version != Index_Version)
+			return;
+
+		for (uint32_t i = 0; i < entryCount && file; i++)
+		{
+			std::string relativePath;
+			IndexEntry indexEntry;
+			uint8_t sourceAsset = 0;
+
+			readString(relativePath);
+			file.read((char*)&indexEntry.Guid.Ref(), sizeof(uint64_t));
+			file.read((char*)&indexEntry.WriteTime, sizeof(int64_t));
+			file.read((char*)&indexEntry.FileSize, sizeof(uint64_t));
+			file.read((char*)&sourceAsset, sizeof(uint8_t));
+			readString(indexEntry.Name);
+			readString(indexEntry.Type);
+
+			indexEntry.IsSourceAsset = sourceAsset != 0;
+
+			if (file)
+				m_Index[m_SearchOptions.Root / relativePath] = indexEntry;
+		}
+	}
+
+	void AssetDatabase::SaveIndex()
+	{
+		if (m_SearchOptions.IndexPath.empty())
+			return;
+
+		std::error_code error;
+		std::filesystem::create_directories(m_SearchOptions.IndexPath.parent_path(), error);
+
+		std::ofstream file(m_SearchOptions.IndexPath, std::ios::trunc | std::ios::binary);
+		if (!file.is_open())
+		{
+			Log::Error("[AssetDatabase] Unable to write asset index: " + m_SearchOptions.IndexPath.string());
+			return;
+		}
+
+		auto writeString = [&file](const std::string& str)
+			{
+				uint32_t length = (uint32_t)str.size();
+				file.write((char*)&length, sizeof(uint32_t));
+				file.write(str.data(), length);
+			};
+
+		uint32_t entryCount = (uint32_t)m_Index.size();
+		file.write((char*)&Index_Magic, sizeof(uint32_t));
+		file.write((char*)&Index_Version, sizeof(uint32_t));
+		file.write((char*)&entryCount, sizeof(uint32_t));
+
+		for (auto& [path, indexEntry] : m_Index)
+		{
+			// Paths are stored relative to the root so the project can be moved
+			uint8_t sourceAsset = indexEntry.IsSourceAsset ? 1 : 0;
+			writeString(path.lexically_relative(m_SearchOptions.Root).generic_string());
+			file.write((char*)&indexEntry.Guid.CRef(), sizeof(uint64_t));
+			file.write((char*)&indexEntry.WriteTime, sizeof(int64_t));
+			file.write((char*)&indexEntry.FileSize, sizeof(uint64_t));
+			file.write((char*)&sourceAsset, sizeof(uint8_t));
+			writeString(indexEntry.Name);
+			writeString(indexEntry.Type);
+		}
 	}
 }
\ No newline at end of file
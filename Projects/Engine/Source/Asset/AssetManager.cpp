@@ -12,6 +12,7 @@
 #include "AnimationClip.h"
 #include "AssetRegistry.h"
 #include "Project.h"
+#include "ShaderCache.h"
 
 namespace Odyssey
 {
@@ -32,8 +33,64 @@ namespace Odyssey
 		assetSearch.ExclusionPaths = { };
 		assetSearch.Extensions = settings.AssetExtensions;
 		assetSearch.SourceExtensionsMap = settings.SourceAssetExtensionMap;
+		assetSearch.IndexPath = Project::GetActiveCacheDirectory() / "AssetDatabase.index";
 
 		s_AssetDatabase = std::make_unique<AssetDatabase>(assetSearch, Project::GetActiveAssetRegistry(), registries);
+		s_BinaryCache = std::make_unique<BinaryCache>(Project::GetActiveCacheDirectory());
+		ShaderCache::Init(Project::GetActiveCacheDirectory());
+	}
+
+	BinaryBuffer AssetManager::LoadBinaryData(GUID guid)
+	{
+		if (s_BinaryCache)
+			return s_BinaryCache->LoadBinaryData(guid);
+
+		return BinaryBuffer();
+	}
+
+	void AssetManager::SaveBinaryData(GUID guid, BinaryBuffer& buffer)
+	{
+		if (s_BinaryCache)
+			s_BinaryCache->SaveBinaryData(guid, buffer);
+	}
+
+	void AssetManager::FinalizeAsyncLoads()
+	{
+		std::vector<std::shared_ptr<AssetLoadState>> decodedLoads;
+
+		s_AssetLock.Lock(LockState::Read);
+
+		for (auto& [guid, loadState] : s_PendingLoads)
+		{
+			if (loadState->IsDecoded())
+				decodedLoads.push_back(loadState);
+		}
+
+		s_AssetLock.Unlock(LockState::Read);
+
+		// Batch the uploads for everything that finished decoding this frame
+		for (auto& loadState : decodedLoads)
+			CompleteLoad(loadState);
+	}
+
+	Ref<Asset> AssetManager::CompleteLoad(std::shared_ptr<AssetLoadState> loadState)
+	{
+		// Finalizing may already have happened through another future or a dependency
+		if (loadState->Finalized)
+			return loadState->Result;
+
+		loadState->WaitForDecode();
+		loadState->Result = loadState->Finalize();
+		loadState->Finalized = true;
+
+		s_AssetLock.Lock(LockState::Write);
+		s_LoadedAssets.insert(loadState->Guid);
+		s_Assets.push_back(loadState->Result);
+		s_GUIDToIndex[loadState->Guid] = s_Assets.size() - 1;
+		s_PendingLoads.erase(loadState->Guid);
+		s_AssetLock.Unlock(LockState::Write);
+
+		return loadState->Result;
 	}
 
 	std::vector<GUID> AssetManager::GetAssetsOfType(const std::string& assetType)
@@ -50,6 +107,14 @@ namespace Odyssey
 		return GUID::Empty();
 	}
 
+	Path AssetManager::GUIDToPath(GUID guid)
+	{
+		if (s_AssetDatabase->Contains(guid))
+			return s_AssetDatabase->GUIDToAssetPath(guid);
+
+		return Path();
+	}
+
 	std::string AssetManager::GUIDToName(GUID guid)
 	{
 		// Start with the asset database
@@ -24,17 +24,32 @@ namespace Odyssey
 	void AssetRegistry::AddAsset(const std::string& name, const std::string& type, const Path& path, GUID guid)
 	{
 		// Make sure this isn't a dupe
-		for (auto& entry : Entries)
-		{
-			if (entry.Guid == guid || entry.Path == path)
-				return;
-		}
+		if (m_GUIDs.contains(guid) || m_Paths.contains(path))
+			return;
 
 		AssetEntry& entry = Entries.emplace_back();
 		entry.Name = name;
 		entry.Type = type;
 		entry.Path = path;
 		entry.Guid = guid;
+
+		m_GUIDs.insert(guid);
+		m_Paths.insert(path);
+	}
+
+	void AssetRegistry::RemoveAsset(GUID guid)
+	{
+		// Saving is left to the caller so removals can be batched
+		for (size_t i = 0; i < Entries.size(); i++)
+		{
+			if (Entries[i].Guid == guid)
+			{
+				m_GUIDs.erase(guid);
+				m_Paths.erase(Entries[i].Path);
+				Entries.erase(Entries.begin() + i);
+				break;
+			}
+		}
 	}
 
 	void AssetRegistry::UpdateAssetName(GUID guid, const std::string& name)
@@ -56,6 +71,8 @@ namespace Odyssey
 		{
 			if (entry.Guid == guid)
 			{
+				m_Paths.erase(entry.Path);
+				m_Paths.insert(path);
 				entry.Path = path;
 				Save();
 				break;
@@ -69,6 +86,8 @@ namespace Odyssey
 		{
 			if (entry.Path == oldPath)
 			{
+				m_Paths.erase(entry.Path);
+				m_Paths.insert(newPath);
 				entry.Path = newPath;
 				Save();
 				break;
@@ -107,6 +126,8 @@ namespace Odyssey
 	void AssetRegistry::Load()
 	{
 		Entries.clear();
+		m_GUIDs.clear();
+		m_Paths.clear();
 
 		AssetDeserializer deserializer(RegistryPath);
 		if (deserializer.IsValid())
@@ -130,6 +151,9 @@ namespace Odyssey
 				entryNode.ReadData("Path", path);
 				entryNode.ReadData("GUID", entry.Guid.Ref());
 				entry.Path = path;
+
+				m_GUIDs.insert(entry.Guid);
+				m_Paths.insert(entry.Path);
 			}
 
 			PruneEntries();
@@ -146,6 +170,8 @@ namespace Odyssey
 
 			if (!std::filesystem::exists(RootDirectory / entry.Path))
 			{
+				m_GUIDs.erase(entry.Guid);
+				m_Paths.erase(entry.Path);
 				Entries.erase(Entries.begin() + i);
 				removed++;
 				continue;
@@ -165,7 +191,8 @@ namespace Odyssey
 			// Validate the new file name has a supported asset extension
 			if (Contains(Preferences::GetAssetExtensions(), extension) || Contains(Preferences::GetSourceExtensions(), extension))
 			{
-				UpdateAssetPath(oldFilename, newFilename);
+				// Entries are stored relative to the registry
+				UpdateAssetPath(oldFilename.lexically_relative(RootDirectory), newFilename.lexically_relative(RootDirectory));
 			}
 		}
 	}
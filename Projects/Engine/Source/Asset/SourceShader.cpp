@@ -22,32 +22,34 @@ namespace Odyssey
 	{
 		bool compile = true;
 
-		for (auto [shaderType, shaderCode] : m_ShaderCode)
+		for (ShaderType shaderType : GetShaderTypes())
 		{
 			BinaryBuffer tempBuffer;
-			ShaderCompiler::CompilerSettings options;
-			options.ShaderName = Name;
-			options.ShaderLanguage = m_ShaderLanguage == "hlsl" ? ShaderLanguage::HLSL : ShaderLanguage::GLSL;
-			options.ShaderType = shaderType;
-			options.ShaderCode = shaderCode;
-			options.Optimize = false;
-			compile = compile && ShaderCompiler::Compile(options, tempBuffer);
+			compile = compile && Compile(shaderType, tempBuffer);
 		}
 
 		return compile;
 	}
 
 	bool SourceShader::Compile(ShaderType shaderType, BinaryBuffer& codeBuffer)
+	{
+		ShaderCompiler::CompilerSettings options;
+		if (GetCompilerSettings(shaderType, options))
+			return ShaderCompiler::Compile(options, codeBuffer);
+
+		return false;
+	}
+
+	bool SourceShader::GetCompilerSettings(ShaderType shaderType, ShaderCompiler::CompilerSettings& settings)
 	{
 		if (m_ShaderCode.contains(shaderType))
 		{
-			ShaderCompiler::CompilerSettings options;
-			options.ShaderName = Name;
-			options.ShaderLanguage = m_ShaderLanguage == "hlsl" ? ShaderLanguage::HLSL : ShaderLanguage::GLSL;
-			options.ShaderType = shaderType;
-			options.ShaderCode = m_ShaderCode[shaderType];
-			options.Optimize = false;
-			return ShaderCompiler::Compile(options, codeBuffer);
+			settings.ShaderName = Name;
+			settings.ShaderLanguage = m_ShaderLanguage == "hlsl" ? ShaderLanguage::HLSL : ShaderLanguage::GLSL;
+			settings.ShaderType = shaderType;
+			settings.ShaderCode = m_ShaderCode[shaderType];
+			settings.Optimize = false;
+			return true;
 		}
 
 		return false;
@@ -0,0 +1,309 @@
+#include "DynamicTree.h"
+
+namespace Odyssey
+{
+	uint32_t DynamicTree::CreateProxy(const BoundingBox& bounds, uint32_t userData)
+	{
+		uint32_t proxy = AllocateNode();
+
+		Node& node = m_Nodes[proxy];
+		node.Bounds = BoundingBox(bounds.Min - float3(Bounds_Margin), bounds.Max + float3(Bounds_Margin));
+		node.UserData = userData;
+		node.Height = 0;
+
+		InsertLeaf(proxy);
+		return proxy;
+	}
+
+	void DynamicTree::DestroyProxy(uint32_t proxy)
+	{
+		assert(m_Nodes[proxy].IsLeaf());
+
+		RemoveLeaf(proxy);
+		FreeNode(proxy);
+	}
+
+	bool DynamicTree::MoveProxy(uint32_t proxy, const BoundingBox& bounds)
+	{
+		assert(m_Nodes[proxy].IsLeaf());
+
+		BoundingBox fatBounds = BoundingBox(bounds.Min - float3(Bounds_Margin), bounds.Max + float3(Bounds_Margin));
+		const BoundingBox& treeBounds = m_Nodes[proxy].Bounds;
+
+		if (Contains(treeBounds, bounds))
+		{
+			// Still inside the fat bounds, unless the proxy shrank enough that the fat bounds are no longer useful
+			BoundingBox hugeBounds = BoundingBox(fatBounds.Min - float3(4.0f * Bounds_Margin), fatBounds.Max + float3(4.0f * Bounds_Margin));
+			if (Contains(hugeBounds, treeBounds))
+				return false;
+		}
+
+		RemoveLeaf(proxy);
+		m_Nodes[proxy].Bounds = fatBounds;
+		InsertLeaf(proxy);
+		return true;
+	}
+
+	void DynamicTree::Clear()
+	{
+		m_Nodes.clear();
+		m_Root = Null_Node;
+		m_FreeList = Null_Node;
+	}
+
+	bool DynamicTree::RayIntersects(const BoundingBox& bounds, float3 origin, float3 inverseDirection, float maxDistance, float& entry)
+	{
+		// Slab test, the ray starts at 0 so origins inside the box enter immediately
+		float3 t1 = (bounds.Min - origin) * inverseDirection;
+		float3 t2 = (bounds.Max - origin) * inverseDirection;
+		float3 tMin = glm::min(t1, t2);
+		float3 tMax = glm::max(t1, t2);
+
+		float enter = std::max(std::max(tMin.x, tMin.y), std::max(tMin.z, 0.0f));
+		float exit = std::min(std::min(tMax.x, tMax.y), std::min(tMax.z, maxDistance));
+
+		entry = enter;
+		return enter <= exit;
+	}
+
+	uint32_t DynamicTree::AllocateNode()
+	{
+		if (m_FreeList == Null_Node)
+		{
+			m_Nodes.emplace_back();
+			return (uint32_t)(m_Nodes.size() - 1);
+		}
+
+		// Free nodes reuse Parent as the next link
+		uint32_t node = m_FreeList;
+		m_FreeList = m_Nodes[node].Parent;
+		m_Nodes[node] = Node();
+		return node;
+	}
+
+	void DynamicTree::FreeNode(uint32_t node)
+	{
+		m_Nodes[node].Parent = m_FreeList;
+		m_Nodes[node].Height = -1;
+		m_FreeList = node;
+	}
+
+	void DynamicTree::InsertLeaf(uint32_t leaf)
+	{
+		if (m_Root == Null_Node)
+		{
+			m_Root = leaf;
+			m_Nodes[leaf].Parent = Null_Node;
+			return;
+		}
+
+		// Walk down to the cheapest sibling using the surface area heuristic
+		const BoundingBox leafBounds = m_Nodes[leaf].Bounds;
+		uint32_t index = m_Root;
+
+		while (!m_Nodes[index].IsLeaf())
+		{
+			const Node& node = m_Nodes[index];
+			float area = SurfaceArea(node.Bounds);
+			float combinedArea = SurfaceArea(Combine(node.Bounds, leafBounds));
+
+			// Cost of creating a new parent for this node and the new leaf
+			float cost = 2.0f * combinedArea;
+
+			// Minimum cost of pushing the leaf further down the tree
+			float inheritanceCost = 2.0f * (combinedArea - area);
+
+			auto descendCost = [&](uint32_t child)
+				{
+					const Node& childNode = m_Nodes[child];
+					float childCost = SurfaceArea(Combine(leafBounds, childNode.Bounds));
+					if (!childNode.IsLeaf())
+						childCost -= SurfaceArea(childNode.Bounds);
+
+					return childCost + inheritanceCost;
+				};
+
+			float cost1 = descendCost(node.Child1);
+			float cost2 = descendCost(node.Child2);
+
+			if (cost < cost1 && cost < cost2)
+				break;
+
+			index = cost1 < cost2 ? node.Child1 : node.Child2;
+		}
+
+		uint32_t sibling = index;
+
+		// Create a new parent in place of the sibling
+		uint32_t oldParent = m_Nodes[sibling].Parent;
+		uint32_t newParent = AllocateNode();
+
+		Node& parentNode = m_Nodes[newParent];
+		parentNode.Parent = oldParent;
+		parentNode.Bounds = Combine(leafBounds, m_Nodes[sibling].Bounds);
+		parentNode.Height = m_Nodes[sibling].Height + 1;
+		parentNode.Child1 = sibling;
+		parentNode.Child2 = leaf;
+
+		if (oldParent != Null_Node)
+		{
+			if (m_Nodes[oldParent].Child1 == sibling)
+				m_Nodes[oldParent].Child1 = newParent;
+			else
+				m_Nodes[oldParent].Child2 = newParent;
+		}
+		else
+		{
+			m_Root = newParent;
+		}
+
+		m_Nodes[sibling].Parent = newParent;
+		m_Nodes[leaf].Parent = newParent;
+
+		Refit(newParent);
+	}
+
+	void DynamicTree::RemoveLeaf(uint32_t leaf)
+	{
+		if (leaf == m_Root)
+		{
+			m_Root = Null_Node;
+			return;
+		}
+
+		uint32_t parent = m_Nodes[leaf].Parent;
+		uint32_t grandParent = m_Nodes[parent].Parent;
+		uint32_t sibling = m_Nodes[parent].Child1 == leaf ? m_Nodes[parent].Child2 : m_Nodes[parent].Child1;
+
+		// The sibling takes the place of the parent
+		if (grandParent != Null_Node)
+		{
+			if (m_Nodes[grandParent].Child1 == parent)
+				m_Nodes[grandParent].Child1 = sibling;
+			else
+				m_Nodes[grandParent].Child2 = sibling;
+
+			m_Nodes[sibling].Parent = grandParent;
+			FreeNode(parent);
+
+			Refit(grandParent);
+		}
+		else
+		{
+			m_Root = sibling;
+			m_Nodes[sibling].Parent = Null_Node;
+			FreeNode(parent);
+		}
+	}
+
+	void DynamicTree::Refit(uint32_t index)
+	{
+		// Rebalance and refit every ancestor up to the root
+		while (index != Null_Node)
+		{
+			index = Balance(index);
+
+			Node& node = m_Nodes[index];
+			const Node& child1 = m_Nodes[node.Child1];
+			const Node& child2 = m_Nodes[node.Child2];
+
+			node.Height = 1 + std::max(child1.Height, child2.Height);
+			node.Bounds = Combine(child1.Bounds, child2.Bounds);
+
+			index = node.Parent;
+		}
+	}
+
+	uint32_t DynamicTree::Balance(uint32_t indexA)
+	{
+		// Rotates B or C up when the subtree of A is out of balance, returns the new root of the subtree
+		Node& A = m_Nodes[indexA];
+		if (A.IsLeaf() || A.Height < 2)
+			return indexA;
+
+		uint32_t indexB = A.Child1;
+		uint32_t indexC = A.Child2;
+		Node& B = m_Nodes[indexB];
+		Node& C = m_Nodes[indexC];
+
+		int32_t balance = C.Height - B.Height;
+
+		auto rotate = [&](uint32_t indexUp, uint32_t indexOther, bool upIsChild2)
+			{
+				Node& up = m_Nodes[indexUp];
+				uint32_t indexF = up.Child1;
+				uint32_t indexG = up.Child2;
+				Node& F = m_Nodes[indexF];
+				Node& G = m_Nodes[indexG];
+				Node& other = m_Nodes[indexOther];
+
+				// The rotated node takes A's place
+				up.Child1 = indexA;
+				up.Parent = A.Parent;
+				A.Parent = indexUp;
+
+				if (up.Parent != Null_Node)
+				{
+					if (m_Nodes[up.Parent].Child1 == indexA)
+						m_Nodes[up.Parent].Child1 = indexUp;
+					else
+						m_Nodes[up.Parent].Child2 = indexUp;
+				}
+				else
+				{
+					m_Root = indexUp;
+				}
+
+				// The taller grandchild stays with the rotated node, the shorter one moves under A
+				uint32_t indexTall = F.Height > G.Height ? indexF : indexG;
+				uint32_t indexShort = F.Height > G.Height ? indexG : indexF;
+				Node& tall = m_Nodes[indexTall];
+				Node& shortNode = m_Nodes[indexShort];
+
+				up.Child2 = indexTall;
+
+				if (upIsChild2)
+					A.Child2 = indexShort;
+				else
+					A.Child1 = indexShort;
+
+				shortNode.Parent = indexA;
+
+				A.Bounds = Combine(other.Bounds, shortNode.Bounds);
+				up.Bounds = Combine(A.Bounds, tall.Bounds);
+
+				A.Height = 1 + std::max(other.Height, shortNode.Height);
+				up.Height = 1 + std::max(A.Height, tall.Height);
+			};
+
+		if (balance > 1)
+		{
+			rotate(indexC, indexB, true);
+			return indexC;
+		}
+
+		if (balance < -1)
+		{
+			rotate(indexB, indexC, false);
+			return indexB;
+		}
+
+		return indexA;
+	}
+
+	BoundingBox DynamicTree::Combine(const BoundingBox& a, const BoundingBox& b)
+	{
+		return BoundingBox(glm::min(a.Min, b.Min), glm::max(a.Max, b.Max));
+	}
+
+	float DynamicTree::SurfaceArea(const BoundingBox& bounds)
+	{
+		float3 size = bounds.Max - bounds.Min;
+		return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+	}
+
+	bool DynamicTree::Contains(const BoundingBox& outer, const BoundingBox& inner)
+	{
+		return glm::all(glm::lessThanEqual(outer.Min, inner.Min)) && glm::all(glm::greaterThanEqual(outer.Max, inner.Max));
+	}
+}
@@ -0,0 +1,79 @@
+#include "FrameAllocator.h"
+#include "Log.h"
+
+namespace Odyssey
+{
+	FrameAllocator::Arena::~Arena()
+	{
+		for (Page& page : Pages)
+		{
+			for (Block& block : page.Blocks)
+				::operator delete(block.Data);
+		}
+	}
+
+	void FrameAllocator::Reset()
+	{
+		s_LastFrameUsage = s_FrameUsage.exchange(0, std::memory_order_relaxed);
+
+		if (s_LastFrameUsage > s_PeakUsage)
+		{
+			s_PeakUsage = s_LastFrameUsage;
+
+			if (s_ReportPeakUsage)
+				Log::Info("[FrameAllocator] New peak frame usage: " + std::to_string(s_PeakUsage / 1024) + " KB");
+		}
+
+		// Each thread rewinds its own page lazily on the first allocation of the new frame
+		s_Frame.fetch_add(1, std::memory_order_release);
+	}
+
+	void* FrameAllocator::Allocate(size_t size, size_t alignment)
+	{
+		Page& page = GetPage();
+
+		while (true)
+		{
+			if (page.BlockIndex < page.Blocks.size())
+			{
+				Block& block = page.Blocks[page.BlockIndex];
+				uintptr_t base = (uintptr_t)block.Data;
+				uintptr_t aligned = (base + page.Offset + alignment - 1) & ~(uintptr_t)(alignment - 1);
+				size_t offset = aligned - base;
+
+				if (offset + size <= block.Size)
+				{
+					page.Offset = offset + size;
+					s_FrameUsage.fetch_add(size, std::memory_order_relaxed);
+					return block.Data + offset;
+				}
+
+				// Move on to the next retained block
+				page.BlockIndex++;
+				page.Offset = 0;
+				continue;
+			}
+
+			// Only grows until the arena has seen its busiest frame, the blocks are kept across resets
+			size_t blockSize = std::max(Block_Size, size + alignment);
+			page.Blocks.push_back({ (uint8_t*)::operator new(blockSize), blockSize });
+		}
+	}
+
+	FrameAllocator::Page& FrameAllocator::GetPage()
+	{
+		thread_local Arena arena;
+
+		uint64_t frame = s_Frame.load(std::memory_order_acquire);
+		Page& page = arena.Pages[frame % Frames_In_Flight];
+
+		if (page.Frame != frame)
+		{
+			page.Frame = frame;
+			page.BlockIndex = 0;
+			page.Offset = 0;
+		}
+
+		return page;
+	}
+}
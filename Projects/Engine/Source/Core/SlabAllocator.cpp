@@ -0,0 +1,44 @@
+#include "SlabAllocator.h"
+
+namespace Odyssey
+{
+	SlabAllocator::SlabAllocator(size_t slotSize, size_t slotAlignment, size_t slotsPerSlab)
+	{
+		m_SlotAlignment = std::max(slotAlignment, alignof(void*));
+		m_SlotSize = std::max(slotSize, sizeof(void*));
+		m_SlotSize = (m_SlotSize + m_SlotAlignment - 1) & ~(m_SlotAlignment - 1);
+		m_SlotsPerSlab = slotsPerSlab;
+	}
+
+	SlabAllocator::~SlabAllocator()
+	{
+		for (void* slab : m_Slabs)
+			::operator delete(slab, std::align_val_t(m_SlotAlignment));
+	}
+
+	void* SlabAllocator::Allocate()
+	{
+		if (!m_FreeHead)
+			AddSlab();
+
+		void* slot = m_FreeHead;
+		m_FreeHead = *(void**)slot;
+		return slot;
+	}
+
+	void SlabAllocator::Free(void* slot)
+	{
+		*(void**)slot = m_FreeHead;
+		m_FreeHead = slot;
+	}
+
+	void SlabAllocator::AddSlab()
+	{
+		uint8_t* slab = (uint8_t*)::operator new(m_SlotSize * m_SlotsPerSlab, std::align_val_t(m_SlotAlignment));
+		m_Slabs.push_back(slab);
+
+		// Link the new slots in order so allocations walk the slab front to back
+		for (size_t i = m_SlotsPerSlab; i > 0; i--)
+			Free(slab + (i - 1) * m_SlotSize);
+	}
+}
@@ -0,0 +1,56 @@
+#include "ThreadPool.h"
+
+namespace Odyssey
+{
+	ThreadPool::ThreadPool()
+	{
+		// Leave a core free for the main thread
+		uint32_t hardwareThreads = std::thread::hardware_concurrency();
+		uint32_t workerCount = hardwareThreads > 2 ? hardwareThreads - 1 : 1;
+
+		for (uint32_t i = 0; i < workerCount; i++)
+			m_Workers.emplace_back([this](std::stop_token stopToken) { WorkerLoop(stopToken); });
+	}
+
+	void ThreadPool::Submit(std::function<void()> job)
+	{
+		ThreadPool& pool = Get();
+
+		{
+			std::scoped_lock lock(pool.m_Mutex);
+			pool.m_Jobs.push(std::move(job));
+		}
+
+		pool.m_Condition.notify_one();
+	}
+
+	uint32_t ThreadPool::GetWorkerCount()
+	{
+		return (uint32_t)Get().m_Workers.size();
+	}
+
+	ThreadPool& ThreadPool::Get()
+	{
+		static ThreadPool s_Instance;
+		return s_Instance;
+	}
+
+	void ThreadPool::WorkerLoop(std::stop_token stopToken)
+	{
+		while (true)
+		{
+			std::function<void()> job;
+
+			{
+				std::unique_lock lock(m_Mutex);
+				if (!m_Condition.wait(lock, stopToken, [this]() { return !m_Jobs.empty(); }))
+					return;
+
+				job = std::move(m_Jobs.front());
+				m_Jobs.pop();
+			}
+
+			job();
+		}
+	}
+}
@@ -38,6 +38,7 @@ namespace Odyssey
 		componentNode.WriteData("Animation Rig", rigGUID.CRef());
 		componentNode.WriteData("Animation Blueprint", blueprintGUID.CRef());
 		componentNode.WriteData("Rig Root", m_RigRootGUID.CRef());
+		componentNode.WriteData("Expose Bones", m_ExposeBones);
 	}
 
 	void Animator::Deserialize(SerializationNode& node)
@@ -49,6 +50,7 @@ namespace Odyssey
 		node.ReadData("Animation Rig", rigGUID.Ref());
 		node.ReadData("Animation Blueprint", blueprintGUID.Ref());
 		node.ReadData("Rig Root", m_RigRootGUID.Ref());
+		node.ReadData("Expose Bones", m_ExposeBones);
 
 		if (rigGUID)
 			SetRig(rigGUID);
@@ -70,17 +72,76 @@ namespace Odyssey
 					CreateBoneGameObjects();
 			}
 
-			ProcessKeys();
+			BeginUpdate();
+			EvaluatePose();
+			ApplyPose();
 		}
 	}
 
 	void Animator::Update()
 	{
-		if (m_BoneGameObjects.size() == 0)
-			CreateBoneGameObjects();
+		BeginUpdate();
+		EvaluatePose();
+		ApplyPose();
+	}
+
+	void Animator::BeginUpdate()
+	{
+		m_PoseEvaluated = false;
+
+		if (!m_Rig)
+			return;
+
+		// Bone game objects are only driven at runtime when they have been requested for attachments
+		if (m_ExposeBones && m_BoneGameObjects.size() == 0)
+		{
+			if (m_RigRootGUID)
+				CatalogBoneGameObjects();
+			else
+				CreateBoneGameObjects();
+		}
+
+		// Cache the rig root so the pose can be evaluated without touching the scene
+		if (Transform* rigRootTransform = m_RigRoot.IsValid() ? m_RigRoot.TryGetComponent<Transform>() : nullptr)
+			m_RigRootMatrix = rigRootTransform->GetLocalMatrix();
+	}
+
+	void Animator::EvaluatePose()
+	{
+		// Note: This only touches the animator, its blueprint instance and the rig
+		if (!m_Enabled || !m_Rig || !m_Blueprint)
+			return;
+
+		m_Blueprint->Update();
+		m_LocalPose = m_Blueprint->GetKeyframe(m_Rig);
 
-		if (m_Enabled && m_Blueprint)
-			ProcessKeys();
+		const std::vector<Bone>& bones = m_Rig->GetBones();
+
+		// Parents are always evaluated before their children so this is a single pass
+		for (uint32_t boneIndex : m_Rig->GetEvaluationOrder())
+		{
+			const BlendKey& key = m_LocalPose[boneIndex];
+			const Bone& bone = bones[boneIndex];
+
+			glm::mat4 t = glm::translate(glm::mat4(1.0f), key.Position);
+			glm::mat4 r = glm::toMat4(key.Rotation);
+			glm::mat4 s = glm::scale(glm::mat4(1.0f), key.Scale);
+
+			const glm::mat4& parentPose = bone.ParentIndex > -1 ? m_ModelPoses[bone.ParentIndex] : m_RigRootMatrix;
+			m_ModelPoses[boneIndex] = parentPose * t * r * s;
+			m_FinalPoses[boneIndex] = m_ModelPoses[boneIndex] * bone.InverseBindpose;
+		}
+
+		m_PoseEvaluated = true;
+	}
+
+	void Animator::ApplyPose()
+	{
+		if (!m_Rig)
+			return;
+
+		if (m_PoseEvaluated)
+			ApplyKeys();
 		else
 			ProcessTransforms();
 	}
@@ -91,6 +152,15 @@ namespace Odyssey
 		ResetToBindpose();
 	}
 
+	void Animator::SetExposeBones(bool expose)
+	{
+		m_ExposeBones = expose;
+
+		// Tear down the bone hierarchy so the pose buffer becomes the only output
+		if (!m_ExposeBones)
+			DestroyBoneGameObjects();
+	}
+
 	void Animator::SetFloat(const std::string& propertyName, float value)
 	{
 		m_Blueprint->SetFloat(propertyName, value);
@@ -132,9 +202,12 @@ namespace Odyssey
 
 		m_Rig = AssetManager::LoadAsset<AnimationRig>(guid);
 
-		// Resize our final poses to match the bone count
+		// Resize our poses to match the bone count
+		m_ModelPoses.clear();
+		m_ModelPoses.resize(m_Rig->GetBones().size());
 		m_FinalPoses.clear();
 		m_FinalPoses.resize(m_Rig->GetBones().size());
+		m_RigRootMatrix = m_Rig->GetGlobalMatrix();
 	}
 
 	void Animator::SetBlueprint(GUID guid)
@@ -214,6 +287,7 @@ namespace Odyssey
 		// Destroy the rig root
 		m_RigRoot.Destroy();
 		m_BoneGameObjects.clear();
+		m_BoneCatalog.clear();
 		m_RigRootGUID = GUID::Empty();
 	}
 
@@ -224,67 +298,62 @@ namespace Odyssey
 		std::vector<GameObject> children = m_RigRoot.GetAllChildren();
 		const std::vector<Bone>& bones = m_Rig->GetBones();
 
-		for (const Bone& bone : bones)
+		// Keep the bone game objects aligned with the rig's bone indices
+		m_BoneGameObjects.resize(bones.size());
+
+		for (size_t i = 0; i < bones.size(); i++)
 		{
 			for (GameObject& child : children)
 			{
-				if (child.GetName() == bone.Name)
+				if (child.GetName() == bones[i].Name)
 				{
-					m_BoneGameObjects.push_back(child);
-					m_BoneCatalog[bone.Name] = child;
+					m_BoneGameObjects[i] = child;
+					m_BoneCatalog[bones[i].Name] = child;
+					break;
 				}
 			}
 		}
 	}
 
-	void Animator::ProcessKeys()
+	void Animator::ApplyKeys()
 	{
-		const std::vector<Bone>& bones = m_Rig->GetBones();
-
-		float time = m_Playing ? Time::DeltaTime() : 0.0f;
-
-		m_Blueprint->Update();
-		auto boneKeys = m_Blueprint->GetKeyframe();
-
-		glm::mat4 animatorInverse = glm::inverse(m_GameObject.GetComponent<Transform>().GetWorldMatrix());
-		for (size_t i = 0; i < bones.size(); i++)
+		// Push the evaluated pose onto the bone game objects
+		for (size_t i = 0; i < m_BoneGameObjects.size(); i++)
 		{
-			// Get the key for this bone
-			const std::string& boneName = bones[i].Name;
-			BlendKey& blendKey = boneKeys[boneName];
+			const BlendKey& blendKey = m_LocalPose[i];
 
-			Transform& boneTransform = m_BoneCatalog[boneName].GetComponent<Transform>();
+			Transform& boneTransform = m_BoneGameObjects[i].GetComponent<Transform>();
 			boneTransform.SetPosition(blendKey.Position);
 			boneTransform.SetRotation(blendKey.Rotation);
 			boneTransform.SetScale(blendKey.Scale);
-
-			glm::mat4 key = animatorInverse * boneTransform.GetWorldMatrix();
-			m_FinalPoses[i] = key * bones[i].InverseBindpose;
 		}
 	}
 
 	void Animator::ProcessTransforms()
 	{
-		const std::vector<Bone>& bones = m_Rig->GetBones();
-
-		for (size_t i = 0; i < bones.size(); i++)
+		// Without bone game objects the last evaluated pose is kept
+		for (size_t i = 0; i < m_BoneGameObjects.size(); i++)
 		{
-			const std::string& boneName = bones[i].Name;
-
-			Transform& boneTransform = m_BoneCatalog[boneName].GetComponent<Transform>();
+			Transform& boneTransform = m_BoneGameObjects[i].GetComponent<Transform>();
 			m_FinalPoses[i] = m_Rig->GetRotationOffset() * boneTransform.GetWorldMatrix();
 		}
 	}
 
 	void Animator::ResetToBindpose()
 	{
-		const std::vector<Bone>& bones = m_Rig->GetBones();
+		if (!m_Rig)
+			return;
 
-		for (size_t i = 0; i < bones.size(); i++)
+		// The bind pose is an identity skinning matrix per bone
+		if (m_BoneGameObjects.size() == 0)
 		{
-			const std::string& boneName = bones[i].Name;
+			std::fill(m_FinalPoses.begin(), m_FinalPoses.end(), glm::mat4(1.0f));
+			return;
+		}
 
-			Transform& boneTransform = m_BoneCatalog[boneName].GetComponent<Transform>();
+		for (size_t i = 0; i < m_BoneGameObjects.size(); i++)
+		{
+			Transform& boneTransform = m_BoneGameObjects[i].GetComponent<Transform>();
 			boneTransform.SetLocalMatrix(mat4(1.0f));
 
 			glm::mat4 key = m_Rig->GetRotationOffset() * boneTransform.GetWorldMatrix();
@@ -294,6 +363,20 @@ namespace Odyssey
 
 	void Animator::DebugDraw()
 	{
+		// Draw straight from the pose buffer when the bones are not exposed
+		if (m_BoneCatalog.size() == 0)
+		{
+			Transform* transform = m_GameObject.TryGetComponent<Transform>();
+			glm::mat4 worldMatrix = transform ? transform->GetWorldMatrix() : glm::mat4(1.0f);
+
+			for (const glm::mat4& modelPose : m_ModelPoses)
+			{
+				glm::vec3 translation = glm::vec3(worldMatrix * modelPose[3]);
+				DebugRenderer::AddSphere(translation, 0.025f, glm::vec4(0, 1, 0, 1));
+			}
+			return;
+		}
+
 		for (auto& [boneName, boneObject] : m_BoneCatalog)
 		{
 			Transform& boneTransform = boneObject.GetComponent<Transform>();
@@ -87,6 +87,11 @@ namespace Odyssey
 		return viewPos;
 	}
 
+	Frustum Camera::GetFrustum()
+	{
+		return Frustum(GetProjection() * GetInverseView());
+	}
+
 	float Camera::GetNearClip()
 	{
 		return Renderer::ReverseDepthEnabled() ? m_FarClip : m_NearClip;
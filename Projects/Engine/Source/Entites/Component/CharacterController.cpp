@@ -78,7 +78,7 @@ namespace Odyssey
 		Vec3 lastVerticalVelocity = lastVelocity.Dot(m_Character->GetUp()) * m_Character->GetUp();
 
 		// What the user input for velocity
-		Vec3 inputVelocity = m_Character->GetLinearVelocity();
+		Vec3 inputVelocity = ToJoltVec3(m_InputVelocity);
 		Vec3 inputHorizontalVelocity = Vec3(inputVelocity.GetX(), 0.0f, inputVelocity.GetZ());
 		Vec3 inputVerticalVelocity = Vec3(0.0f, inputVelocity.GetY(), 0.0f);
 
@@ -119,12 +119,12 @@ namespace Odyssey
 
 	void CharacterController::SetLinearVelocity(float3 velocity)
 	{
-		m_Character->SetLinearVelocity(ToJoltVec3(velocity));
+		m_InputVelocity = velocity;
 	}
 
 	float3 CharacterController::GetLinearVelocity()
 	{
-		return ToFloat3(m_Character->GetLinearVelocity());
+		return m_InputVelocity;
 	}
 
 	void CharacterController::SetDebugEnabled(bool enabled)
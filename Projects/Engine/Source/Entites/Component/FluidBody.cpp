@@ -1,6 +1,5 @@
 #include "FluidBody.h"
 #include "Transform.h"
-#include "OdysseyTime.h"
 #include "DebugRenderer.h"
 
 namespace Odyssey
@@ -72,6 +71,8 @@ namespace Odyssey
 			m_SurfacePosition = ToJoltVec3(position + m_Center + vec3(0.0f, 1.0f, 0.0f));
 			m_SurfaceNormal = ToJoltVec3(transform->Up());
 
+			m_Hits.clear();
+
 			// Calculate the AABB
 			Vec3 extents = ToJoltVec3(m_Extents);
 			AABox aabb(-extents, extents);
@@ -81,19 +82,31 @@ namespace Odyssey
 		}
 	}
 
-	void FluidBody::AddHit(const BodyID& inBodyID)
+	void FluidBody::ApplyBuoyancy(const BodyLockInterface& lockInterface, float deltaTime)
 	{
-		BodyLockWrite* lock = PhysicsSystem::Instance().GetBodyLock(inBodyID);
-		Body& body = lock->GetBody();
+		if (m_Hits.size() == 0)
+			return;
 
-		if (body.IsActive() && !body.IsKinematic())
+		Vec3 gravity = PhysicsSystem::Instance().GetGravity() * m_GravityFactor;
+		BodyLockMultiWrite lock(lockInterface, m_Hits.data(), (int)m_Hits.size());
+
+		for (int i = 0; i < (int)m_Hits.size(); i++)
 		{
-			body.ApplyBuoyancyImpulse(m_SurfacePosition, m_SurfaceNormal, m_Buoyancy, m_LinearDrag, m_AngularDrag,
-				ToJoltVec3(m_FluidVelocity), PhysicsSystem::Instance().GetGravity() * m_GravityFactor, Time::DeltaTime());
+			Body* body = lock.GetBody(i);
+
+			if (body && body->IsActive() && !body->IsKinematic())
+			{
+				body->ApplyBuoyancyImpulse(m_SurfacePosition, m_SurfaceNormal, m_Buoyancy, m_LinearDrag, m_AngularDrag,
+					ToJoltVec3(m_FluidVelocity), gravity, deltaTime);
+			}
 		}
 
-		delete lock;
-		lock = nullptr;
+		m_Hits.clear();
+	}
+
+	void FluidBody::AddHit(const BodyID& inBodyID)
+	{
+		m_Hits.push_back(inBodyID);
 	}
 
 	void FluidBody::SetDebugEnabled(bool enabled)
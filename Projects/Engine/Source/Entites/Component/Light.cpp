@@ -66,6 +66,11 @@ namespace Odyssey
 		return rotation;
 	}
 
+	Frustum Light::GetShadowFrustum(float3 sceneCenter, float sceneRadius)
+	{
+		return Frustum(CalculateViewProj(sceneCenter, sceneRadius, GetDirection()));
+	}
+
 	mat4 Light::CalculateViewProj(float3 sceneCenter, float sceneRadius, float3 lightDir)
 	{
 		float distance = -sceneRadius;
@@ -2,6 +2,7 @@
 #include "Mesh.h"
 #include "Material.h"
 #include "AssetManager.h"
+#include "Scene.h"
 
 namespace Odyssey
 {
@@ -58,6 +59,12 @@ namespace Odyssey
 	void MeshRenderer::SetEnabled(bool enabled)
 	{
 		m_Enabled = enabled;
+
+		if (Scene* scene = m_GameObject.GetScene())
+		{
+			scene->GetSpatialIndex().MarkDirty(m_GameObject);
+			scene->GetRenderChanges().MarkDirty(m_GameObject);
+		}
 	}
 
 	void MeshRenderer::SetMesh(GUID meshGUID)
@@ -66,6 +73,12 @@ namespace Odyssey
 			m_Mesh = AssetManager::LoadAsset<Mesh>(meshGUID);
 		else
 			m_Mesh.Reset();
+
+		if (Scene* scene = m_GameObject.GetScene())
+		{
+			scene->GetSpatialIndex().MarkDirty(m_GameObject);
+			scene->GetRenderChanges().MarkDirty(m_GameObject);
+		}
 	}
 
 	void MeshRenderer::SetMaterial(GUID materialGUID, size_t submesh)
@@ -77,6 +90,9 @@ namespace Odyssey
 			m_Materials[submesh] = AssetManager::LoadAsset<Material>(materialGUID);
 		else
 			m_Materials[submesh].Reset();
+
+		if (Scene* scene = m_GameObject.GetScene())
+			scene->GetRenderChanges().MarkDirty(m_GameObject);
 	}
 	void MeshRenderer::RemoveMaterial(int32_t index)
 	{
@@ -87,5 +103,8 @@ namespace Odyssey
 
 			m_Materials.erase(m_Materials.begin() + index);
 		}
+
+		if (Scene* scene = m_GameObject.GetScene())
+			scene->GetRenderChanges().MarkDirty(m_GameObject);
 	}
 }
\ No newline at end of file
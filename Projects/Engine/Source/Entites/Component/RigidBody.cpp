@@ -59,6 +59,12 @@ namespace Odyssey
 				m_Body = PhysicsSystem::Instance().RegisterCapsule(m_GameObject, center + position, rotation, radius, height, m_Properties, m_PhysicsLayer);
 				m_BodyID = m_Body->GetID();
 			}
+
+			// Start interpolating from where the body was registered
+			float3 position, scale;
+			quat rotation;
+			transform->DecomposeWorldMatrix(position, rotation, scale);
+			m_Pose.Reset(position, rotation);
 		}
 	}
 
@@ -67,6 +73,18 @@ namespace Odyssey
 
 	}
 
+	float3 RigidBody::GetColliderCenter()
+	{
+		if (BoxCollider* collider = m_GameObject.TryGetComponent<BoxCollider>())
+			return collider->GetCenter();
+		else if (SphereCollider* sphereCollider = m_GameObject.TryGetComponent<SphereCollider>())
+			return sphereCollider->GetCenter();
+		else if (CapsuleCollider* capsuleCollider = m_GameObject.TryGetComponent<CapsuleCollider>())
+			return capsuleCollider->GetCenter();
+
+		return float3(0.0f);
+	}
+
 	void RigidBody::OnDestroy()
 	{
 		PhysicsSystem::Instance().Deregister(m_Body);
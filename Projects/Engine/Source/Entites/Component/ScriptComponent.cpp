@@ -42,6 +42,12 @@ namespace Odyssey
 			m_Handle.Invoke("Update");
 	}
 
+	void ScriptComponent::FixedUpdate()
+	{
+		if (m_Handle.IsValid())
+			m_Handle.Invoke("FixedUpdate");
+	}
+
 	void ScriptComponent::OnDestroy()
 	{
 		if (m_Handle.IsValid())
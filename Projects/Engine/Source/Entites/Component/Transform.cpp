@@ -1,4 +1,6 @@
 #include "Transform.h"
+#include "Scene.h"
+#include "SceneGraph.h"
 #include <Log.h>
 #include <glm.h>
 #include <Yaml.h>
@@ -9,6 +11,10 @@ namespace Odyssey
 		: m_GameObject(gameObject)
 	{
 		Reset();
+
+		// New transforms start dirty, record them so the next update computes their world matrix
+		if (Scene* scene = m_GameObject.GetScene())
+			scene->AddDirtyTransform(m_GameObject);
 	}
 
 	Transform::Transform(const GameObject& gameObject, SerializationNode& node)
@@ -16,12 +22,28 @@ namespace Odyssey
 	{
 		Reset();
 		Deserialize(node);
+
+		if (Scene* scene = m_GameObject.GetScene())
+			scene->AddDirtyTransform(m_GameObject);
+	}
+
+	Transform::Transform(const GameObject& gameObject, float3 position, quat rotation, float3 scale)
+		: m_GameObject(gameObject), m_Position(position), m_Rotation(rotation), m_Scale(scale)
+	{
+		// Used by loaders, the transform starts dirty so it is recorded once instead of going through each setter
+		m_EulerRotation = glm::eulerAngles(m_Rotation);
+		m_LocalMatrix = mat4(1.0f);
+		m_WorldMatrix = mat4(1.0f);
+
+		if (Scene* scene = m_GameObject.GetScene())
+			scene->AddDirtyTransform(m_GameObject);
 	}
 
 	void Transform::SetPosition(float3 position)
 	{
 		m_Position = position;
 		m_Dirty = true;
+		SetWorldDirty();
 	}
 
 	void Transform::SetPosition(float x, float y, float z)
@@ -30,6 +52,7 @@ namespace Odyssey
 		m_Position.y = y;
 		m_Position.z = z;
 		m_Dirty = true;
+		SetWorldDirty();
 	}
 
 	void Transform::SetRotation(float3 eulerAngles, bool radians)
@@ -41,6 +64,7 @@ namespace Odyssey
 		// Assign the quaternion rotation
 		m_Rotation = quat(m_EulerRotation);
 		m_Dirty = true;
+		SetWorldDirty();
 	}
 
 	void Transform::SetRotation(quat orientation)
@@ -48,6 +72,7 @@ namespace Odyssey
 		m_Rotation = orientation;
 		SetEulerRotation(glm::eulerAngles(m_Rotation));
 		m_Dirty = true;
+		SetWorldDirty();
 	}
 
 	void Transform::SetScale(float3 scale)
@@ -56,6 +81,7 @@ namespace Odyssey
 		{
 			m_Scale = scale;
 			m_Dirty = true;
+			SetWorldDirty();
 		}
 	}
 
@@ -72,6 +98,7 @@ namespace Odyssey
 		float3 skew;
 		float4 perspective;
 		glm::decompose(localMatrix, scale, m_Rotation, m_Position, skew, perspective);
+		SetWorldDirty();
 	}
 
 	float3 Transform::GetWorldPosition()
@@ -115,22 +142,57 @@ namespace Odyssey
 
 	mat4 Transform::GetWorldMatrix()
 	{
-		ComposeLocalMatrix();
-		mat4 worldMatrix = m_LocalMatrix;
-
-		GameObject parent = m_GameObject.GetParent();
-		while (parent.IsValid())
+		// The cached world matrix is valid as long as neither we nor any parent has changed
+		if (m_WorldDirty)
 		{
-			if (Transform* parentTransform = parent.TryGetComponent<Transform>())
+			ComposeLocalMatrix();
+			m_WorldMatrix = m_LocalMatrix;
+
+			GameObject parent = m_GameObject.GetParent();
+			if (parent.IsValid())
 			{
-				worldMatrix = parentTransform->GetLocalMatrix() * worldMatrix;
-				parent = parent.GetParent();
+				if (Transform* parentTransform = parent.TryGetComponent<Transform>())
+					m_WorldMatrix = parentTransform->GetWorldMatrix() * m_LocalMatrix;
 			}
-			else
-				break;
+
+			m_WorldDirty = false;
 		}
 
-		return worldMatrix;
+		return m_WorldMatrix;
+	}
+
+	void Transform::SetWorldDirty()
+	{
+		// Our children are already marked dirty if we are
+		if (m_WorldDirty)
+			return;
+
+		MarkWorldDirty();
+
+		// Only the topmost dirty transform is recorded, the scene update walks down from it
+		if (Scene* scene = m_GameObject.GetScene())
+			scene->AddDirtyTransform(m_GameObject);
+	}
+
+	void Transform::MarkWorldDirty()
+	{
+		m_WorldDirty = true;
+
+		if (Scene* scene = m_GameObject.GetScene())
+		{
+			scene->GetSpatialIndex().MarkDirty(m_GameObject);
+			scene->GetRenderChanges().MarkDirty(m_GameObject);
+
+			if (Ref<SceneNode> node = scene->GetSceneGraph().GetNode(m_GameObject))
+			{
+				for (Ref<SceneNode>& child : node->Children)
+				{
+					Transform* childTransform = child->Entity.TryGetComponent<Transform>();
+					if (childTransform && !childTransform->m_WorldDirty)
+						childTransform->MarkWorldDirty();
+				}
+			}
+		}
 	}
 
 	void Transform::SetLocalSpace()
@@ -147,6 +209,7 @@ namespace Odyssey
 				float4 perspective;
 				glm::decompose(m_LocalMatrix, m_Scale, m_Rotation, m_Position, skew, perspective);
 				m_EulerRotation = glm::eulerAngles(m_Rotation);
+				SetWorldDirty();
 			}
 		}
 
@@ -262,6 +325,7 @@ namespace Odyssey
 		ComposeLocalMatrix();
 
 		m_Dirty = true;
+		m_WorldDirty = true;
 	}
 
 	void Transform::Serialize(SerializationNode& node)
@@ -281,6 +345,8 @@ namespace Odyssey
 		node.ReadData("Scale", m_Scale);
 
 		m_EulerRotation = glm::eulerAngles(m_Rotation);
+		m_Dirty = true;
 		ComposeLocalMatrix();
+		SetWorldDirty();
 	}
 }
\ No newline at end of file
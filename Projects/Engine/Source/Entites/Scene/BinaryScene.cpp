@@ -0,0 +1,411 @@
+#include "BinaryScene.h"
+#include "AssetSerializer.h"
+#include "Log.h"
+#include "MappedFile.h"
+#include "PropertiesComponent.h"
+#include "Scene.h"
+#include "Transform.h"
+#include <bit>
+#include <span>
+
+namespace Odyssey
+{
+	static_assert(std::endian::native == std::endian::little, "Binary scenes are stored little-endian");
+
+	enum class SceneChunkType : uint32_t
+	{
+		None = 0,
+		Environment = 1,
+		GameObjects = 2,
+		Transforms = 3,
+		Strings = 4,
+		Count = 5,
+	};
+
+	struct SceneFileHeader
+	{
+		uint32_t Magic;
+		uint32_t Version;
+		uint32_t ChunkCount;
+		uint32_t Reserved;
+	};
+
+	struct SceneChunkHeader
+	{
+		SceneChunkType Type;
+		uint32_t Count;
+		uint64_t Size;
+	};
+
+	struct StringRecord
+	{
+		uint32_t Offset;
+		uint32_t Length;
+	};
+
+	struct EnvironmentRecord
+	{
+		uint64_t GUID;
+		uint64_t Skybox;
+		StringRecord Name;
+		float AmbientColor[3];
+		float SceneCenter[3];
+		float SceneRadius;
+		float Exposure;
+		float GammaCorrection;
+		uint32_t Reserved;
+	};
+
+	struct GameObjectRecord
+	{
+		uint64_t GUID;
+		int64_t SortOrder;
+		int32_t Parent;
+		uint32_t Reserved;
+		StringRecord Name;
+
+		// Components that have no binary layout are kept as an embedded yaml block
+		StringRecord Components;
+	};
+
+	struct TransformRecord
+	{
+		uint32_t GameObject;
+		float Position[3];
+		float Rotation[4];
+		float Scale[3];
+	};
+
+	// The on-disk layout is fixed, any change to these requires a version bump
+	static_assert(sizeof(SceneFileHeader) == 16 && sizeof(SceneChunkHeader) == 16);
+	static_assert(sizeof(EnvironmentRecord) == 64 && std::is_trivially_copyable_v<EnvironmentRecord>);
+	static_assert(sizeof(GameObjectRecord) == 40 && std::is_trivially_copyable_v<GameObjectRecord>);
+	static_assert(sizeof(TransformRecord) == 44 && std::is_trivially_copyable_v<TransformRecord>);
+
+	inline static constexpr uint64_t Chunk_Alignment = 8;
+
+	inline static uint64_t AlignChunkSize(uint64_t size)
+	{
+		return (size + Chunk_Alignment - 1) & ~(Chunk_Alignment - 1);
+	}
+
+	struct BinarySceneWriter
+	{
+	public:
+		StringRecord AddString(std::string_view str)
+		{
+			StringRecord record{ (uint32_t)Strings.size(), (uint32_t)str.size() };
+			Strings.insert(Strings.end(), str.begin(), str.end());
+			return record;
+		}
+
+		void WriteNode(Ref<SceneNode>& node)
+		{
+			GameObject gameObject = node->Entity;
+			PropertiesComponent& properties = gameObject.GetComponent<PropertiesComponent>();
+
+			if (properties.Serialize)
+			{
+				uint32_t index = (uint32_t)GameObjects.size();
+				Indices[gameObject] = index;
+
+				GameObjectRecord& record = GameObjects.emplace_back();
+				record.GUID = properties.GUID;
+				record.SortOrder = properties.SortOrder;
+				record.Parent = -1;
+				record.Reserved = 0;
+				record.Name = AddString(properties.Name);
+				record.Components = StringRecord{ 0, 0 };
+
+				// Parents are always written before their children
+				if (node->Parent && node->Parent.Get() != Root)
+				{
+					auto iter = Indices.find(node->Parent->Entity);
+					if (iter != Indices.end())
+						record.Parent = (int32_t)iter->second;
+				}
+
+				if (Transform* transform = gameObject.TryGetComponent<Transform>())
+				{
+					float3 position = transform->GetPosition();
+					quat rotation = transform->GetRotation();
+					float3 scale = transform->GetScale();
+
+					Transforms.push_back(TransformRecord
+						{
+							index,
+							{ position.x, position.y, position.z },
+							{ rotation.x, rotation.y, rotation.z, rotation.w },
+							{ scale.x, scale.y, scale.z }
+						});
+				}
+
+				WriteComponents(gameObject, record);
+			}
+
+			for (Ref<SceneNode>& childNode : node->Children)
+				WriteNode(childNode);
+		}
+
+		void WriteComponents(GameObject& gameObject, GameObjectRecord& record)
+		{
+			AssetSerializer serializer;
+			SerializationNode root = serializer.GetRoot();
+			gameObject.Serialize(root);
+
+			// The transform lives in its own chunk so strip it from the yaml block
+			SerializationNode componentsNode = root.GetNode("Components");
+			for (size_t i = 0; i < componentsNode.ChildCount(); i++)
+			{
+				std::string componentType;
+				componentsNode.GetChild(i).ReadData("Type", componentType);
+
+				if (componentType == Transform::Type)
+				{
+					componentsNode.RemoveChild(i);
+					break;
+				}
+			}
+
+			// Game objects with only a transform need no yaml at all
+			if (componentsNode.ChildCount() > 0)
+				record.Components = AddString(serializer.WriteToString());
+		}
+
+	public:
+		SceneNode* Root = nullptr;
+		std::vector<GameObjectRecord> GameObjects;
+		std::vector<TransformRecord> Transforms;
+		std::vector<char> Strings;
+		std::unordered_map<entt::entity, uint32_t> Indices;
+	};
+
+	template<typename T>
+	inline static void WriteChunk(std::ofstream& file, SceneChunkType type, const std::vector<T>& records)
+	{
+		SceneChunkHeader header{ type, (uint32_t)records.size(), records.size() * sizeof(T) };
+		file.write((const char*)&header, sizeof(SceneChunkHeader));
+		file.write((const char*)records.data(), header.Size);
+
+		// Pad so the next chunk's records stay aligned inside the mapped file
+		const char padding[Chunk_Alignment] = { };
+		file.write(padding, AlignChunkSize(header.Size) - header.Size);
+	}
+
+	template<typename T>
+	inline static std::span<const T> ReadChunk(const uint8_t* data, const SceneChunkHeader* chunk)
+	{
+		if (!chunk || chunk->Size != (uint64_t)chunk->Count * sizeof(T))
+			return { };
+
+		return std::span<const T>((const T*)((const uint8_t*)chunk + sizeof(SceneChunkHeader)), chunk->Count);
+	}
+
+	inline static std::string_view ReadString(std::span<const char> strings, StringRecord record)
+	{
+		if ((uint64_t)record.Offset + record.Length > strings.size())
+			return { };
+
+		return std::string_view(strings.data() + record.Offset, record.Length);
+	}
+
+	bool BinaryScene::IsBinaryScene(const Path& path)
+	{
+		std::ifstream file(path, std::ios::binary);
+		if (!file.is_open())
+			return false;
+
+		uint32_t magic = 0;
+		file.read((char*)&magic, sizeof(uint32_t));
+		return file.gcount() == sizeof(uint32_t) && magic == Magic;
+	}
+
+	void BinaryScene::Save(Scene* scene, const Path& path)
+	{
+		EnvironmentSettings& settings = scene->m_EnvironmentSettings;
+
+		BinarySceneWriter writer;
+
+		EnvironmentRecord environment{ };
+		environment.GUID = scene->m_GUID;
+		environment.Skybox = settings.Skybox ? (uint64_t)settings.Skybox->GetGUID() : 0;
+		environment.Name = writer.AddString(scene->m_Name);
+		environment.AmbientColor[0] = settings.AmbientColor.x;
+		environment.AmbientColor[1] = settings.AmbientColor.y;
+		environment.AmbientColor[2] = settings.AmbientColor.z;
+		environment.SceneCenter[0] = settings.SceneCenter.x;
+		environment.SceneCenter[1] = settings.SceneCenter.y;
+		environment.SceneCenter[2] = settings.SceneCenter.z;
+		environment.SceneRadius = settings.SceneRadius;
+		environment.Exposure = settings.Exposure;
+		environment.GammaCorrection = settings.GammaCorrection;
+
+		// Walk the sorted hierarchy so parents are always written first
+		Ref<SceneNode>& sceneRoot = scene->m_SceneGraph.GetSceneRoot();
+		sceneRoot->SortChildren(true);
+		writer.Root = sceneRoot.Get();
+
+		for (Ref<SceneNode>& sceneNode : sceneRoot->Children)
+			writer.WriteNode(sceneNode);
+
+		auto parentPath = path.parent_path();
+		if (!parentPath.empty() && !std::filesystem::exists(parentPath))
+			std::filesystem::create_directories(parentPath);
+
+		std::ofstream file(path, std::ios::trunc | std::ios::binary);
+		if (!file.is_open())
+		{
+			Log::Error("[BinaryScene] Unable to open scene file: " + path.string());
+			return;
+		}
+
+		SceneFileHeader header{ Magic, Version, 4, 0 };
+		file.write((const char*)&header, sizeof(SceneFileHeader));
+
+		WriteChunk(file, SceneChunkType::Environment, std::vector<EnvironmentRecord>{ environment });
+		WriteChunk(file, SceneChunkType::GameObjects, writer.GameObjects);
+		WriteChunk(file, SceneChunkType::Transforms, writer.Transforms);
+		WriteChunk(file, SceneChunkType::Strings, writer.Strings);
+
+		file.close();
+	}
+
+	bool BinaryScene::Load(Scene* scene, const Path& path)
+	{
+		MappedFile file(path);
+		if (!file || file.GetSize() < sizeof(SceneFileHeader))
+			return false;
+
+		const uint8_t* data = file.GetData();
+		const SceneFileHeader* header = (const SceneFileHeader*)data;
+
+		if (header->Magic != Magic || header->Version != Version)
+		{
+			Log::Error("[BinaryScene] Unsupported scene version: " + path.string());
+			return false;
+		}
+
+		// Index the chunks up front so they can be consumed in dependency order
+		std::array<const SceneChunkHeader*, (size_t)SceneChunkType::Count> chunks{ };
+		uint64_t offset = sizeof(SceneFileHeader);
+
+		for (uint32_t i = 0; i < header->ChunkCount; i++)
+		{
+			if (offset + sizeof(SceneChunkHeader) > file.GetSize())
+				return false;
+
+			const SceneChunkHeader* chunk = (const SceneChunkHeader*)(data + offset);
+			offset += sizeof(SceneChunkHeader);
+
+			if (offset + chunk->Size > file.GetSize())
+				return false;
+
+			// Unknown chunks are skipped so newer writers stay readable
+			if (chunk->Type < SceneChunkType::Count)
+				chunks[(size_t)chunk->Type] = chunk;
+
+			offset += AlignChunkSize(chunk->Size);
+		}
+
+		std::span<const EnvironmentRecord> environments = ReadChunk<EnvironmentRecord>(data, chunks[(size_t)SceneChunkType::Environment]);
+		std::span<const GameObjectRecord> records = ReadChunk<GameObjectRecord>(data, chunks[(size_t)SceneChunkType::GameObjects]);
+		std::span<const TransformRecord> transforms = ReadChunk<TransformRecord>(data, chunks[(size_t)SceneChunkType::Transforms]);
+		std::span<const char> strings = ReadChunk<char>(data, chunks[(size_t)SceneChunkType::Strings]);
+
+		if (environments.size() != 1)
+		{
+			Log::Error("[BinaryScene] Missing environment chunk: " + path.string());
+			return false;
+		}
+
+		const EnvironmentRecord& environment = environments[0];
+		EnvironmentSettings& settings = scene->m_EnvironmentSettings;
+
+		scene->m_Name = ReadString(strings, environment.Name);
+		scene->m_GUID = environment.GUID;
+		settings.AmbientColor = float3(environment.AmbientColor[0], environment.AmbientColor[1], environment.AmbientColor[2]);
+		settings.SceneCenter = float3(environment.SceneCenter[0], environment.SceneCenter[1], environment.SceneCenter[2]);
+		settings.SceneRadius = environment.SceneRadius;
+		settings.Exposure = environment.Exposure;
+		settings.GammaCorrection = environment.GammaCorrection;
+
+		if (environment.Skybox)
+			settings.SetSkybox(environment.Skybox);
+
+		entt::registry& registry = scene->m_Registry;
+
+		// Create every entity in one go
+		std::vector<entt::entity> entities(records.size());
+		registry.create(entities.begin(), entities.end());
+
+		std::vector<GameObject> gameObjects(records.size());
+		std::vector<int32_t> parents(records.size());
+
+		for (size_t i = 0; i < records.size(); i++)
+		{
+			const GameObjectRecord& record = records[i];
+
+			GameObject& gameObject = gameObjects[i];
+			gameObject = GameObject(scene, entities[i]);
+
+			PropertiesComponent& properties = registry.emplace<PropertiesComponent>(entities[i], gameObject,
+				GUID(record.GUID), std::string(ReadString(strings, record.Name)));
+			properties.SortOrder = record.SortOrder;
+
+			scene->m_GUIDToGameObject[properties.GUID] = gameObject;
+
+			// Anything that does not point at an earlier record is treated as a root
+			parents[i] = record.Parent >= 0 && (size_t)record.Parent < i ? record.Parent : -1;
+		}
+
+		// Transforms are plain data so each one is built straight from its record and marked dirty once
+		for (const TransformRecord& record : transforms)
+		{
+			if (record.GameObject >= gameObjects.size())
+				continue;
+
+			registry.emplace<Transform>(entities[record.GameObject], gameObjects[record.GameObject],
+				float3(record.Position[0], record.Position[1], record.Position[2]),
+				quat(record.Rotation[3], record.Rotation[0], record.Rotation[1], record.Rotation[2]),
+				float3(record.Scale[0], record.Scale[1], record.Scale[2]));
+		}
+
+		// Only the components without a binary layout go through the yaml path
+		for (size_t i = 0; i < records.size(); i++)
+		{
+			std::string_view components = ReadString(strings, records[i].Components);
+
+			if (!components.empty())
+			{
+				AssetDeserializer deserializer(components.data(), components.size());
+				gameObjects[i].Deserialize(deserializer.GetRoot());
+			}
+		}
+
+		scene->m_SceneGraph.Build(gameObjects, parents);
+
+		EventSystem::Queue<SceneModifiedEvent>(scene, SceneModifiedEvent::Modification::CreateGameObject);
+		return true;
+	}
+
+	bool BinaryScene::ConvertToBinary(const Path& yamlPath, const Path& binaryPath)
+	{
+		if (!std::filesystem::exists(yamlPath) || IsBinaryScene(yamlPath))
+			return false;
+
+		Scene scene(yamlPath);
+		Save(&scene, binaryPath);
+		return true;
+	}
+
+	bool BinaryScene::ConvertToYaml(const Path& binaryPath, const Path& yamlPath)
+	{
+		if (!IsBinaryScene(binaryPath))
+			return false;
+
+		// Loading detects the binary header, saving to a non-binary extension writes yaml
+		Scene scene(binaryPath);
+		scene.SaveTo(yamlPath);
+		return true;
+	}
+}
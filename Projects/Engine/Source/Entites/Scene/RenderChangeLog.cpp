@@ -0,0 +1,63 @@
+#include "RenderChangeLog.h"
+
+namespace Odyssey
+{
+	RenderChangeLog::RenderChangeLog()
+		: m_ID(s_NextID++)
+	{
+	}
+
+	void RenderChangeLog::MarkDirty(entt::entity entity)
+	{
+		uint32_t slot = (uint32_t)entt::to_entity(entity);
+		if (slot >= m_Logged.size())
+			m_Logged.resize(slot + 1);
+
+		// Every reader that hasn't read the earlier entry yet will still see it
+		LoggedEntity& logged = m_Logged[slot];
+		if (logged.Entity == entity && logged.Position >= m_ReadEnd && logged.Position >= m_Start)
+			return;
+
+		if (m_Changes.size() == 0)
+			m_Changes.resize(Max_Changes);
+
+		// Overwrite the oldest change, readers that still needed it rebuild
+		if (m_End - m_Start == Max_Changes)
+			m_Start++;
+
+		m_Changes[m_End & (Max_Changes - 1)] = entity;
+		logged.Entity = entity;
+		logged.Position = m_End++;
+	}
+
+	void RenderChangeLog::Clear()
+	{
+		// Past the end, so even readers that were caught up rebuild
+		m_End++;
+		m_Start = m_End;
+		m_Logged.clear();
+	}
+
+	bool RenderChangeLog::Read(uint64_t& cursor, std::vector<entt::entity>& changes)
+	{
+		m_ReadEnd = m_End;
+
+		if (cursor < m_Start)
+		{
+			cursor = m_End;
+			return false;
+		}
+
+		for (uint64_t position = cursor; position < m_End; position++)
+			changes.push_back(m_Changes[position & (Max_Changes - 1)]);
+
+		cursor = m_End;
+		return true;
+	}
+
+	void RenderChangeLog::Skip(uint64_t& cursor)
+	{
+		m_ReadEnd = m_End;
+		cursor = m_End;
+	}
+}
@@ -1,11 +1,14 @@
 #include "Scene.h"
+#include "AssetManager.h"
 #include "AssetSerializer.h"
+#include "BinaryScene.h"
 #include "GameObject.h"
 #include "ScriptingManager.h"
 #include "ParticleBatcher.h"
 #include "EventSystem.h"
 #include "Events.h"
 #include "Components.h"
+#include "Mesh.h"
 
 namespace Odyssey
 {
@@ -13,16 +16,30 @@ namespace Odyssey
 for (auto entity : m_Registry.view<ComponentType>()) GameObject(this, entity).GetComponent<ComponentType>().Func();
 
 	Scene::Scene()
+		: m_SpatialIndex(this)
 	{
+		m_Registry.on_construct<ParticleEmitter>().connect<&Scene::OnParticleEmitterCreate>(this);
+		m_Registry.on_destroy<ParticleEmitter>().connect<&Scene::OnParticleEmitterDestroy>(this);
 
+		// Transform changes are reported by the transform itself when it becomes dirty
+		m_Registry.on_construct<Transform>().connect<&Scene::OnSpatialComponentChanged>(this);
+		m_Registry.on_destroy<Transform>().connect<&Scene::OnSpatialComponentChanged>(this);
+		m_Registry.on_construct<MeshRenderer>().connect<&Scene::OnSpatialComponentChanged>(this);
+		m_Registry.on_destroy<MeshRenderer>().connect<&Scene::OnSpatialComponentChanged>(this);
+
+		// Render proxies follow the same components, plus animators which decide if an object is skinned
+		m_Registry.on_construct<Transform>().connect<&Scene::OnRenderComponentChanged>(this);
+		m_Registry.on_destroy<Transform>().connect<&Scene::OnRenderComponentChanged>(this);
+		m_Registry.on_construct<MeshRenderer>().connect<&Scene::OnRenderComponentChanged>(this);
+		m_Registry.on_destroy<MeshRenderer>().connect<&Scene::OnRenderComponentChanged>(this);
+		m_Registry.on_construct<Animator>().connect<&Scene::OnRenderComponentChanged>(this);
+		m_Registry.on_destroy<Animator>().connect<&Scene::OnRenderComponentChanged>(this);
 	}
 
 	Scene::Scene(const Path& assetPath)
-		: m_Path(assetPath)
+		: Scene()
 	{
-		m_Registry.on_construct<ParticleEmitter>().connect<&Scene::OnParticleEmitterCreate>(this);
-		m_Registry.on_destroy<ParticleEmitter>().connect<&Scene::OnParticleEmitterDestroy>(this);
-
+		m_Path = assetPath;
 		LoadFromDisk(m_Path);
 	}
 
@@ -38,7 +55,8 @@ for (auto entity : m_Registry.view<ComponentType>()) GameObject(this, entity).Ge
 		m_GUIDToGameObject[gameObject.GetGUID()] = gameObject;
 		m_SceneGraph.AddEntity(gameObject);
 
-		EventSystem::Dispatch<SceneModifiedEvent>(this, SceneModifiedEvent::Modification::CreateGameObject);
+		// Queued so creating many objects in a frame only notifies the listeners once
+		EventSystem::Queue<SceneModifiedEvent>(this, SceneModifiedEvent::Modification::CreateGameObject);
 		return gameObject;
 	}
 
@@ -47,7 +65,7 @@ for (auto entity : m_Registry.view<ComponentType>()) GameObject(this, entity).Ge
 		// Create the backing entity
 		const auto entity = m_Registry.create();
 
-		EventSystem::Dispatch<SceneModifiedEvent>(this, SceneModifiedEvent::Modification::CreateGameObject);
+		EventSystem::Queue<SceneModifiedEvent>(this, SceneModifiedEvent::Modification::CreateGameObject);
 
 		// Return a game object wrapper
 		return GameObject(this, entity);
@@ -73,12 +91,16 @@ for (auto entity : m_Registry.view<ComponentType>()) GameObject(this, entity).Ge
 
 	void Scene::Clear()
 	{
-		for (auto entity : m_Registry.view<PropertiesComponent>())
-		{
-			DestroyGameObject(GameObject(this, entity));
-		}
+		// Tear down the whole graph at once rather than destroying each subtree individually
+		m_SceneGraph.Clear();
+		m_GUIDToGameObject.clear();
 		m_Registry.clear();
+		m_SpatialIndex.Clear();
+		m_DirtyTransforms.clear();
+		m_RenderChanges.Clear();
 
+		// Removals stay immediate so nothing keeps drawing the destroyed objects for the rest of the frame
+		// Creations still queued are delivered ahead of it, see EventSystem::Dispatch
 		EventSystem::Dispatch<SceneModifiedEvent>(this, SceneModifiedEvent::Modification::DeleteGameObject);
 	}
 
@@ -115,6 +137,7 @@ for (auto entity : m_Registry.view<ComponentType>()) GameObject(this, entity).Ge
 	void Scene::OnEditorUpdate()
 	{
 		EXECUTE_ON_COMPONENTS(Animator, OnEditorUpdate);
+		UpdateTransforms();
 	}
 
 	void Scene::Update()
@@ -122,8 +145,14 @@ for (auto entity : m_Registry.view<ComponentType>()) GameObject(this, entity).Ge
 		m_State = SceneState::Update;
 
 		EXECUTE_ON_COMPONENTS(ScriptComponent, Update);
-		EXECUTE_ON_COMPONENTS(Animator, Update);
+		UpdateAnimators();
 		EXECUTE_ON_COMPONENTS(RigidBody, Update);
+		UpdateTransforms();
+	}
+
+	void Scene::FixedUpdate()
+	{
+		EXECUTE_ON_COMPONENTS(ScriptComponent, FixedUpdate);
 	}
 
 	void Scene::OnDestroy()
@@ -153,6 +182,67 @@ for (auto entity : m_Registry.view<ComponentType>()) GameObject(this, entity).Ge
 		LoadFromDisk(m_Path);
 	}
 
+	void Scene::UpdateAnimators()
+	{
+		auto view = m_Registry.view<Animator>();
+
+		std::vector<Animator*> animators;
+		animators.reserve(view.size());
+
+		// Bone creation touches the scene so it stays on this thread
+		for (auto entity : view)
+		{
+			Animator& animator = view.get<Animator>(entity);
+			animator.BeginUpdate();
+			animators.push_back(&animator);
+		}
+
+		// Pose evaluation is self-contained per animator so fan it out across cores
+		std::for_each(std::execution::par, animators.begin(), animators.end(),
+			[](Animator* animator) { animator->EvaluatePose(); });
+
+		// Write the poses back to the bone game objects
+		for (Animator* animator : animators)
+			animator->ApplyPose();
+	}
+
+	void UpdateWorldMatrices(Ref<SceneNode>& sceneNode)
+	{
+		// Parents are visited before their children so each dirty world matrix is a single multiply
+		if (Transform* transform = sceneNode->Entity.TryGetComponent<Transform>())
+		{
+			if (transform->m_WorldDirty)
+				transform->GetWorldMatrix();
+		}
+
+		for (Ref<SceneNode>& childNode : sceneNode->Children)
+			UpdateWorldMatrices(childNode);
+	}
+
+	void Scene::UpdateTransforms()
+	{
+		for (entt::entity entity : m_DirtyTransforms)
+		{
+			if (!m_Registry.valid(entity))
+				continue;
+
+			// Already recomputed as part of a parent recorded earlier, or read since it was recorded
+			Transform* transform = m_Registry.try_get<Transform>(entity);
+			if (!transform || !transform->m_WorldDirty)
+				continue;
+
+			if (Ref<SceneNode> sceneNode = m_SceneGraph.GetNode(transform->m_GameObject))
+				UpdateWorldMatrices(sceneNode);
+			else
+				transform->GetWorldMatrix();
+		}
+
+		m_DirtyTransforms.clear();
+
+		// Refit the bounds of everything that moved now that the world matrices are current
+		m_SpatialIndex.Update();
+	}
+
 	void SerializeSceneNode(SerializationNode& serializationNode, Ref<SceneNode>& sceneNode)
 	{
 		GameObject gameObject = sceneNode->Entity;
@@ -174,6 +264,12 @@ for (auto entity : m_Registry.view<ComponentType>()) GameObject(this, entity).Ge
 
 	void Scene::SaveToDisk(const Path& assetPath)
 	{
+		if (assetPath.extension() == BinaryScene::Extension)
+		{
+			BinaryScene::Save(this, assetPath);
+			return;
+		}
+
 		AssetSerializer serializer;
 		SerializationNode root = serializer.GetRoot();
 
@@ -204,6 +300,25 @@ for (auto entity : m_Registry.view<ComponentType>()) GameObject(this, entity).Ge
 
 	void Scene::LoadFromDisk(const Path& assetPath)
 	{
+		// Binary scenes are detected by their header so they can keep any extension
+		if (BinaryScene::IsBinaryScene(assetPath))
+		{
+			if (BinaryScene::Load(this, assetPath))
+				return;
+
+			// Fall back to the yaml scene the binary was cooked from when it sits next to it
+			Path yamlPath = Path(assetPath).replace_extension(".scene");
+			if (yamlPath == assetPath || !std::filesystem::exists(yamlPath) || BinaryScene::IsBinaryScene(yamlPath))
+			{
+				Log::Error("[Scene] Failed to load binary scene: " + assetPath.string());
+				return;
+			}
+
+			Log::Warning("[Scene] Failed to load binary scene, loading " + yamlPath.string() + " instead");
+			LoadFromDisk(yamlPath);
+			return;
+		}
+
 		AssetDeserializer deserializer(assetPath);
 
 		if (deserializer.IsValid())
@@ -227,6 +342,9 @@ for (auto entity : m_Registry.view<ComponentType>()) GameObject(this, entity).Ge
 			assert(gameObjectsNode.IsSequence());
 			assert(gameObjectsNode.HasChildren());
 
+			// Start decoding the referenced assets before the components ask for them
+			PrefetchAssets(gameObjectsNode);
+
 			for (size_t i = 0; i < gameObjectsNode.ChildCount(); i++)
 			{
 				SerializationNode gameObjectNode = gameObjectsNode.GetChild(i);
@@ -250,6 +368,38 @@ for (auto entity : m_Registry.view<ComponentType>()) GameObject(this, entity).Ge
 		}
 	}
 
+	void Scene::PrefetchAssets(SerializationNode& gameObjectsNode)
+	{
+		for (size_t i = 0; i < gameObjectsNode.ChildCount(); i++)
+		{
+			SerializationNode componentsNode;
+			if (!gameObjectsNode.GetChild(i).TryGetNode("Components", componentsNode))
+				continue;
+
+			for (size_t c = 0; c < componentsNode.ChildCount(); c++)
+			{
+				SerializationNode componentNode = componentsNode.GetChild(c);
+
+				std::string componentType;
+				componentNode.ReadData("Type", componentType);
+
+				if (componentType != MeshRenderer::Type)
+					continue;
+
+				GUID mesh;
+				std::vector<uint64_t> materials;
+				componentNode.ReadData("Mesh", mesh.Ref());
+				componentNode.ReadData("Materials", materials);
+
+				if (mesh)
+					AssetManager::LoadAssetAsync<Mesh>(mesh);
+
+				for (uint64_t material : materials)
+					AssetManager::LoadAssetAsync<Material>(GUID(material));
+			}
+		}
+	}
+
 	void Scene::OnParticleEmitterCreate(entt::registry& registry, entt::entity entity)
 	{
 		GameObject gameObject(this, entity);
@@ -263,4 +413,14 @@ for (auto entity : m_Registry.view<ComponentType>()) GameObject(this, entity).Ge
 		ParticleEmitter& emitter = gameObject.GetComponent<ParticleEmitter>();
 		ParticleBatcher::DeregisterEmtter(&emitter);
 	}
+
+	void Scene::OnSpatialComponentChanged(entt::registry& registry, entt::entity entity)
+	{
+		m_SpatialIndex.MarkDirty(entity);
+	}
+
+	void Scene::OnRenderComponentChanged(entt::registry& registry, entt::entity entity)
+	{
+		m_RenderChanges.MarkDirty(entity);
+	}
 }
\ No newline at end of file
@@ -1,37 +1,22 @@
 #include "SceneGraph.h"
 #include "PropertiesComponent.h"
 #include "Scene.h"
+#include "Transform.h"
 
 namespace Odyssey
 {
 	SceneGraph::SceneGraph()
 	{
-		m_Root = new SceneNode();
+		m_Root = MakeRef<SceneNode>();
 	}
 
 	void SceneGraph::Serialize(Scene* scene, SerializationNode& serializationNode)
 	{
 		SerializationNode sceneGraphNode = serializationNode.CreateSequenceNode("Scene Graph Nodes");
 
-		for (Ref<SceneNode>& node : m_Nodes)
-		{
-			// Skip game objects who dont' want to be serialized
-			PropertiesComponent properties = node->Entity.GetComponent<PropertiesComponent>();
-			if (!properties.Serialize)
-				continue;
-
-			SerializationNode sceneNode = sceneGraphNode.AppendChild();
-			sceneNode.SetMap();
-
-			sceneNode.WriteData("Entity", node->Entity.GetGUID());
-
-			GUID parent;
-
-			if (node->Parent && node->Parent->Entity.IsValid())
-				parent = node->Parent->Entity.GetGUID();
-
-			sceneNode.WriteData("Parent", parent);
-		}
+		// Walk the hierarchy from the root so the node order is deterministic
+		for (Ref<SceneNode>& node : m_Root->Children)
+			SerializeNode(sceneGraphNode, node);
 	}
 
 	void SceneGraph::Deserialize(Scene* scene, SerializationNode& serializationNode)
@@ -53,7 +38,7 @@ namespace Odyssey
 
 			assert(sceneNode.IsMap());
 
-			Ref<SceneNode> node = m_Nodes.emplace_back(new SceneNode());
+			Ref<SceneNode> node = MakeRef<SceneNode>();
 			NodeConnection& connection = connections.emplace_back();
 			connection.Node = node;
 
@@ -62,7 +47,10 @@ namespace Odyssey
 			sceneNode.ReadData("Parent", connection.Parent.Ref());
 
 			if (entity)
+			{
 				node->Entity = scene->GetGameObject(entity);
+				m_Nodes[node->Entity] = node;
+			}
 		}
 
 		for (auto& connection : connections)
@@ -71,7 +59,7 @@ namespace Odyssey
 			{
 				GameObject parent = scene->GetGameObject(connection.Parent);
 				connection.Node->Parent = GetNode(parent);
-				connection.Node->Parent->Children.push_back(connection.Node);
+				connection.Node->Parent->AddChild(connection.Node);
 
 				PropertiesComponent& properties = connection.Node->Entity.GetComponent<PropertiesComponent>();
 				if (properties.SortOrder == -1)
@@ -80,7 +68,7 @@ namespace Odyssey
 			else
 			{
 				connection.Node->Parent = m_Root;
-				m_Root->Children.push_back(connection.Node);
+				m_Root->AddChild(connection.Node);
 
 				PropertiesComponent& properties = connection.Node->Entity.GetComponent<PropertiesComponent>();
 				if (properties.SortOrder == -1)
@@ -94,12 +82,12 @@ namespace Odyssey
 	void SceneGraph::AddEntity(const GameObject& entity)
 	{
 		// Create a new scenenode
-		Ref<SceneNode> node = new SceneNode(entity);
+		Ref<SceneNode> node = MakeRef<SceneNode>(entity);
 
 		// Set the node's parent as the root and add to the root's children
 		node->Parent = m_Root;
-		m_Nodes.push_back(node);
-		m_Root->Children.push_back(node);
+		m_Nodes[entity] = node;
+		m_Root->AddChild(node);
 
 		// Apply default sort order logic if non is set
 		PropertiesComponent& properties = node->Entity.GetComponent<PropertiesComponent>();
@@ -110,6 +98,31 @@ namespace Odyssey
 		m_Root->SortChildren();
 	}
 
+	void SceneGraph::Build(const std::vector<GameObject>& entities, const std::vector<int32_t>& parentIndices)
+	{
+		// Note: Parent indices must refer to earlier entities, -1 attaches to the root
+		std::vector<Ref<SceneNode>> nodes(entities.size());
+		m_Nodes.reserve(m_Nodes.size() + entities.size());
+
+		for (size_t i = 0; i < entities.size(); i++)
+		{
+			nodes[i] = MakeRef<SceneNode>(entities[i]);
+			m_Nodes[entities[i]] = nodes[i];
+
+			Ref<SceneNode>& parent = parentIndices[i] > -1 ? nodes[parentIndices[i]] : m_Root;
+			nodes[i]->Parent = parent;
+			parent->AddChild(nodes[i]);
+		}
+
+		m_Root->SortChildren(true);
+	}
+
+	void SceneGraph::Clear()
+	{
+		m_Nodes.clear();
+		m_Root->Children.clear();
+	}
+
 	void SceneGraph::RemoveEntityAndChildren(const GameObject& entity)
 	{
 		if (Ref<SceneNode> node = GetNode(entity))
@@ -119,17 +132,16 @@ namespace Odyssey
 				RemoveChildNode(node->Parent, node);
 
 			// Get all children under the entity
-			std::vector<GameObject> children = GetAllChildren(entity);
+			std::vector<GameObject> children;
+			GetAllChildren(node, children);
 
 			// Remove the node
 			RemoveNode(node);
 
 			// Remove all children from the scene graph
+			// Note: The whole subtree is going away so there is no need to detach them from their parents
 			for (size_t i = 0; i < children.size(); i++)
-			{
-				if (Ref<SceneNode> childNode = GetNode(children[i]))
-					RemoveNode(childNode);
-			}
+				m_Nodes.erase(children[i]);
 		}
 	}
 
@@ -142,7 +154,7 @@ namespace Odyssey
 		{
 			RemoveParent(node);
 			node->Parent = parentNode;
-			node->Parent->Children.push_back(node);
+			parentNode->AddChild(node);
 
 			// Change the node's sort order to the bottom of the children
 			PropertiesComponent& properties = node->Entity.GetComponent<PropertiesComponent>();
@@ -158,7 +170,7 @@ namespace Odyssey
 
 			// Re-child the node to the root
 			node->Parent = m_Root;
-			m_Root->Children.push_back(node);
+			m_Root->AddChild(node);
 		}
 	}
 
@@ -182,7 +194,7 @@ namespace Odyssey
 		{
 			RemoveParent(childNode);
 			childNode->Parent = node;
-			node->Children.push_back(childNode);
+			node->AddChild(childNode);
 
 			// Change the node's sort order to the bottom of the children
 			PropertiesComponent& properties = childNode->Entity.GetComponent<PropertiesComponent>();
@@ -208,6 +220,8 @@ namespace Odyssey
 
 		if (Ref<SceneNode> node = GetNode(entity))
 		{
+			children.reserve(node->Children.size());
+
 			for (size_t i = 0; i < node->Children.size(); i++)
 			{
 				children.push_back(node->Children[i]->Entity);
@@ -220,77 +234,95 @@ namespace Odyssey
 	std::vector<GameObject> SceneGraph::GetAllChildren(const GameObject& entity)
 	{
 		std::vector<GameObject> children;
-		GetAllChildren(entity, children);
+
+		if (Ref<SceneNode> node = GetNode(entity))
+			GetAllChildren(node, children);
+
 		return children;
 	}
 
 	Ref<SceneNode> SceneGraph::GetNode(const GameObject& entity)
 	{
-		for (size_t i = 0; i < m_Nodes.size(); i++)
-		{
-			if (m_Nodes[i]->Entity.Equals(entity))
-				return m_Nodes[i];
-		}
+		auto iter = m_Nodes.find(entity);
+		if (iter != m_Nodes.end())
+			return iter->second;
 
 		return nullptr;
 	}
 
-	void SceneGraph::RemoveNode(Ref<SceneNode> node)
+	void SceneGraph::SerializeNode(SerializationNode& sceneGraphNode, Ref<SceneNode>& node)
 	{
-		for (size_t i = 0; i < m_Nodes.size(); i++)
+		// Skip game objects who dont' want to be serialized
+		PropertiesComponent& properties = node->Entity.GetComponent<PropertiesComponent>();
+		if (properties.Serialize)
 		{
-			if (m_Nodes[i]->Entity.Equals(node->Entity))
-			{
-				m_Nodes.erase(m_Nodes.begin() + i);
-				break;
-			}
+			SerializationNode sceneNode = sceneGraphNode.AppendChild();
+			sceneNode.SetMap();
+
+			sceneNode.WriteData("Entity", node->Entity.GetGUID());
+
+			GUID parent;
+
+			if (node->Parent && node->Parent->Entity.IsValid())
+				parent = node->Parent->Entity.GetGUID();
+
+			sceneNode.WriteData("Parent", parent);
 		}
+
+		for (Ref<SceneNode>& childNode : node->Children)
+			SerializeNode(sceneGraphNode, childNode);
 	}
 
-	void SceneGraph::RemoveParent(Ref<SceneNode> node)
+	void SceneGraph::RemoveNode(const Ref<SceneNode>& node)
 	{
-		auto parent = node->Parent;
+		m_Nodes.erase(node->Entity);
+	}
 
-		if (parent)
-		{
-			auto& children = parent->Children;
-			for (size_t i = 0; i < children.size(); i++)
-			{
-				if (children[i]->Entity.Equals(node->Entity))
-				{
-					children.erase(children.begin() + i);
-					break;
-				}
-			}
-		}
+	void SceneGraph::RemoveParent(Ref<SceneNode>& node)
+	{
+		if (node->Parent)
+			RemoveChildNode(node->Parent, node);
 
+		// The world matrix is relative to the parent so it needs to be recomputed
+		GameObject entity = node->Entity;
+		if (Transform* transform = entity.TryGetComponent<Transform>())
+			transform->SetWorldDirty();
 	}
 
-	void SceneGraph::RemoveChildNode(Ref<SceneNode> parentNode, Ref<SceneNode> childNode)
+	void SceneGraph::RemoveChildNode(Ref<SceneNode>& parentNode, Ref<SceneNode>& childNode)
 	{
-		auto& children = parentNode->Children;
+		std::vector<Ref<SceneNode>>& children = parentNode->Children;
+		uint32_t index = childNode->ChildIndex;
+
+		// Not a child of this parent
+		if (index >= children.size() || children[index] != childNode)
+			return;
 
-		for (size_t i = 0; i < children.size(); i++)
+		// Move the last child into the hole, the order between siblings is kept by their sort order
+		if (index != children.size() - 1)
 		{
-			if (children[i]->Entity.Equals(childNode->Entity))
-			{
-				children.erase(children.begin() + i);
-				break;
-			}
+			children[index] = std::move(children.back());
+			children[index]->ChildIndex = index;
 		}
+
+		children.pop_back();
 	}
 
-	void SceneGraph::GetAllChildren(const GameObject& entity, std::vector<GameObject>& children)
+	void SceneGraph::GetAllChildren(const Ref<SceneNode>& node, std::vector<GameObject>& children)
 	{
-		std::vector<GameObject> entityChildren = GetChildren(entity);
-		children.insert(children.end(), entityChildren.begin(), entityChildren.end());
-
-		for (size_t i = 0; i < entityChildren.size(); i++)
+		for (const Ref<SceneNode>& childNode : node->Children)
 		{
-			GetAllChildren(entityChildren[i], children);
+			children.push_back(childNode->Entity);
+			GetAllChildren(childNode, children);
 		}
 	}
 
+	void SceneNode::AddChild(Ref<SceneNode>& child)
+	{
+		child->ChildIndex = (uint32_t)Children.size();
+		Children.push_back(child);
+	}
+
 	void SceneNode::SortChildren(bool recursive)
 	{
 		struct CustomSort
@@ -306,6 +338,9 @@ namespace Odyssey
 
 		std::sort(Children.begin(), Children.end(), customSort);
 
+		for (size_t i = 0; i < Children.size(); i++)
+			Children[i]->ChildIndex = (uint32_t)i;
+
 		if (recursive)
 		{
 			for (size_t i = 0; i < Children.size(); i++)
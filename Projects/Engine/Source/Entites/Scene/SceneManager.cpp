@@ -8,6 +8,9 @@ namespace Odyssey
 {
 	void SceneManager::LoadScene(const Path& filename)
 	{
+		// Deliver the outgoing scene's modifications before its listeners move on to the new scene
+		EventSystem::Flush();
+
 		if (activeScene != -1)
 		{
 			scenes[activeScene]->OnDestroy();
@@ -15,8 +18,27 @@ namespace Odyssey
 
 		}
 
-		scenes.push_back(std::make_shared<Scene>(filename));
+		SetActiveScene(std::make_shared<Scene>(filename));
+	}
+
+	Scene* SceneManager::CreateScene()
+	{
+		EventSystem::Flush();
 
+		if (activeScene != -1)
+		{
+			scenes[activeScene]->OnDestroy();
+			scenes[activeScene]->Clear();
+		}
+
+		// An empty scene with no backing file, filled in at runtime
+		SetActiveScene(std::make_shared<Scene>());
+		return scenes[activeScene].get();
+	}
+
+	void SceneManager::SetActiveScene(std::shared_ptr<Scene> scene)
+	{
+		scenes.push_back(scene);
 		activeScene = (int)scenes.size() - 1;
 
 		// TODO: Send a copy of the scene, so the GUI manager can use the game objects to reload the inspectors
@@ -0,0 +1,247 @@
+#include "SpatialIndex.h"
+#include "Scene.h"
+#include "Transform.h"
+#include "MeshRenderer.h"
+#include "Mesh.h"
+
+namespace Odyssey
+{
+	SpatialIndex::SpatialIndex(Scene* scene)
+		: m_Scene(scene)
+	{
+	}
+
+	void SpatialIndex::MarkDirty(entt::entity entity)
+	{
+		Entry& entry = GetEntry(entity);
+
+		// The slot belonged to a destroyed entity that was never flushed
+		if (entry.Entity != entity)
+		{
+			RemoveProxy(entry);
+			entry.Entity = entity;
+			entry.Queued = false;
+		}
+
+		if (!entry.Queued)
+		{
+			entry.Queued = true;
+			m_Dirty.push_back(entity);
+		}
+	}
+
+	void SpatialIndex::Update()
+	{
+		for (entt::entity entity : m_Dirty)
+		{
+			Entry& entry = GetEntry(entity);
+			if (entry.Entity != entity)
+				continue;
+
+			entry.Queued = false;
+
+			BoundingBox bounds;
+			if (!ComputeBounds(entity, bounds))
+			{
+				RemoveProxy(entry);
+				continue;
+			}
+
+			entry.Bounds = bounds;
+
+			if (entry.Proxy == DynamicTree::Null_Node)
+			{
+				entry.Proxy = m_Tree.CreateProxy(bounds, (uint32_t)entt::to_entity(entity));
+				m_ProxyCount++;
+			}
+			else
+			{
+				m_Tree.MoveProxy(entry.Proxy, bounds);
+			}
+		}
+
+		m_Dirty.clear();
+	}
+
+	void SpatialIndex::Clear()
+	{
+		m_Tree.Clear();
+		m_Entries.clear();
+		m_Dirty.clear();
+		m_ProxyCount = 0;
+	}
+
+	bool SpatialIndex::Raycast(float3 origin, float3 direction, float maxDistance, RaycastHit& hit)
+	{
+		Update();
+
+		float length = glm::length(direction);
+		if (length <= 0.0f)
+			return false;
+
+		direction /= length;
+		float3 inverseDirection = 1.0f / direction;
+		float closest = maxDistance;
+		bool found = false;
+
+		m_Tree.RayCast(origin, direction, maxDistance,
+			[&](uint32_t proxy, float)
+			{
+				const Entry& entry = m_Entries[m_Tree.GetUserData(proxy)];
+
+				float distance = 0.0f;
+				if (DynamicTree::RayIntersects(entry.Bounds, origin, inverseDirection, closest, distance))
+				{
+					closest = distance;
+					hit.Object = GameObject(m_Scene, entry.Entity);
+					hit.Distance = distance;
+					hit.Point = origin + direction * distance;
+					found = true;
+				}
+
+				return closest;
+			});
+
+		return found;
+	}
+
+	void SpatialIndex::Raycast(float3 origin, float3 direction, float maxDistance, std::vector<RaycastHit>& hits)
+	{
+		Update();
+
+		float length = glm::length(direction);
+		if (length <= 0.0f)
+			return;
+
+		direction /= length;
+		float3 inverseDirection = 1.0f / direction;
+		size_t start = hits.size();
+
+		m_Tree.RayCast(origin, direction, maxDistance,
+			[&](uint32_t proxy, float)
+			{
+				const Entry& entry = m_Entries[m_Tree.GetUserData(proxy)];
+
+				float distance = 0.0f;
+				if (DynamicTree::RayIntersects(entry.Bounds, origin, inverseDirection, maxDistance, distance))
+					hits.push_back(RaycastHit{ GameObject(m_Scene, entry.Entity), distance, origin + direction * distance });
+
+				return maxDistance;
+			});
+
+		std::sort(hits.begin() + start, hits.end(),
+			[](const RaycastHit& a, const RaycastHit& b) { return a.Distance < b.Distance; });
+	}
+
+	bool BoxOverlapsBox(const BoundingBox& a, const BoundingBox& b)
+	{
+		return glm::all(glm::lessThanEqual(a.Min, b.Max)) && glm::all(glm::lessThanEqual(b.Min, a.Max));
+	}
+
+	bool BoxOverlapsSphere(const BoundingBox& bounds, float3 center, float radiusSquared)
+	{
+		float3 closest = glm::clamp(center, bounds.Min, bounds.Max);
+		float3 offset = closest - center;
+		return glm::dot(offset, offset) <= radiusSquared;
+	}
+
+	void SpatialIndex::QueryBox(const BoundingBox& bounds, std::vector<GameObject>& results)
+	{
+		Update();
+
+		m_Tree.Query([&](const BoundingBox& nodeBounds) { return BoxOverlapsBox(nodeBounds, bounds); },
+			[&](uint32_t proxy)
+			{
+				const Entry& entry = m_Entries[m_Tree.GetUserData(proxy)];
+				if (BoxOverlapsBox(entry.Bounds, bounds))
+					results.push_back(GameObject(m_Scene, entry.Entity));
+
+				return true;
+			});
+	}
+
+	void SpatialIndex::QuerySphere(float3 center, float radius, std::vector<GameObject>& results)
+	{
+		Update();
+
+		float radiusSquared = radius * radius;
+
+		m_Tree.Query([&](const BoundingBox& nodeBounds) { return BoxOverlapsSphere(nodeBounds, center, radiusSquared); },
+			[&](uint32_t proxy)
+			{
+				const Entry& entry = m_Entries[m_Tree.GetUserData(proxy)];
+				if (BoxOverlapsSphere(entry.Bounds, center, radiusSquared))
+					results.push_back(GameObject(m_Scene, entry.Entity));
+
+				return true;
+			});
+	}
+
+	void SpatialIndex::QueryFrustum(const Frustum& frustum, std::vector<GameObject>& results)
+	{
+		Update();
+
+		m_Tree.Query([&](const BoundingBox& nodeBounds) { return frustum.Intersects(nodeBounds); },
+			[&](uint32_t proxy)
+			{
+				const Entry& entry = m_Entries[m_Tree.GetUserData(proxy)];
+				if (frustum.Intersects(entry.Bounds))
+					results.push_back(GameObject(m_Scene, entry.Entity));
+
+				return true;
+			});
+	}
+
+	SpatialIndex::Entry& SpatialIndex::GetEntry(entt::entity entity)
+	{
+		size_t index = (size_t)entt::to_entity(entity);
+		if (index >= m_Entries.size())
+			m_Entries.resize(index + 1);
+
+		return m_Entries[index];
+	}
+
+	bool SpatialIndex::ComputeBounds(entt::entity entity, BoundingBox& bounds)
+	{
+		GameObject gameObject(m_Scene, entity);
+		if (!gameObject.IsValid())
+			return false;
+
+		Transform* transform = gameObject.TryGetComponent<Transform>();
+		MeshRenderer* meshRenderer = gameObject.TryGetComponent<MeshRenderer>();
+		if (!transform || !meshRenderer || !meshRenderer->IsEnabled())
+			return false;
+
+		Ref<Mesh> mesh = meshRenderer->GetMesh();
+		if (!mesh)
+			return false;
+
+		// Merge in object space so the world transform is only applied once
+		BoundingBox localBounds;
+		for (size_t i = 0; i < mesh->GetSubmeshCount(); i++)
+		{
+			const BoundingBox& submeshBounds = mesh->GetSubmesh(i)->Bounds;
+			if (submeshBounds.IsValid())
+			{
+				localBounds.Encapsulate(submeshBounds.Min);
+				localBounds.Encapsulate(submeshBounds.Max);
+			}
+		}
+
+		if (!localBounds.IsValid())
+			return false;
+
+		bounds = localBounds.Transform(transform->GetWorldMatrix());
+		return true;
+	}
+
+	void SpatialIndex::RemoveProxy(Entry& entry)
+	{
+		if (entry.Proxy != DynamicTree::Null_Node)
+		{
+			m_Tree.DestroyProxy(entry.Proxy);
+			entry.Proxy = DynamicTree::Null_Node;
+			m_ProxyCount--;
+		}
+	}
+}
@@ -2,4 +2,21 @@
 
 namespace Odyssey
 {
-}
\ No newline at end of file
+	void EventSystem::Flush()
+	{
+		// A listener flushing again would swap the arrays being iterated
+		if (s_Flushing)
+			return;
+
+		s_Flushing = true;
+
+		// Arrays that receive events while flushing are picked up by the next flush
+		std::swap(s_QueuedArrays, s_FlushingArrays);
+
+		for (IEventListenerArray* listeners : s_FlushingArrays)
+			listeners->Flush();
+
+		s_FlushingArrays.clear();
+		s_Flushing = false;
+	}
+}
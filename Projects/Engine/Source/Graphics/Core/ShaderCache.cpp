@@ -0,0 +1,210 @@
+#include "ShaderCache.h"
+#include "Log.h"
+
+namespace Odyssey
+{
+	struct ShaderCacheHeader
+	{
+		uint32_t Magic;
+		uint32_t Version;
+		uint64_t Key;
+		uint64_t CodeSize;
+		uint32_t BindingCount;
+		uint32_t PropertyCount;
+		uint64_t VertexAttributesSize;
+		uint64_t MaterialBufferSize;
+	};
+
+	inline static constexpr uint64_t FNV_Offset_Basis = 0xcbf29ce484222325;
+	inline static constexpr uint64_t FNV_Prime = 0x100000001b3;
+
+	inline static uint64_t HashBytes(uint64_t hash, const void* data, size_t size)
+	{
+		const uint8_t* bytes = (const uint8_t*)data;
+		for (size_t i = 0; i < size; i++)
+		{
+			hash ^= bytes[i];
+			hash *= FNV_Prime;
+		}
+
+		return hash;
+	}
+
+	inline static void WriteString(std::ofstream& file, const std::string& value)
+	{
+		uint32_t length = (uint32_t)value.size();
+		file.write((char*)&length, sizeof(uint32_t));
+		file.write(value.data(), length);
+	}
+
+	inline static bool ReadString(std::ifstream& file, std::string& value)
+	{
+		uint32_t length = 0;
+		if (!file.read((char*)&length, sizeof(uint32_t)))
+			return false;
+
+		value.resize(length);
+		return (bool)file.read(value.data(), length);
+	}
+
+	void ShaderCache::Init(const Path& cacheDirectory)
+	{
+		s_Path = cacheDirectory / "Shaders";
+
+		if (!std::filesystem::exists(s_Path))
+			std::filesystem::create_directories(s_Path);
+	}
+
+	void ShaderCache::Clear()
+	{
+		if (s_Path.empty())
+			return;
+
+		std::error_code error;
+		std::filesystem::remove_all(s_Path, error);
+		std::filesystem::create_directories(s_Path, error);
+
+		if (error)
+			Log::Error("[ShaderCache] Unable to clear cache directory: " + s_Path.string());
+	}
+
+	uint64_t ShaderCache::GenerateKey(const ShaderCompiler::CompilerSettings& settings)
+	{
+		// Note: No includer is registered with shaderc so shaders cannot #include other files and the code is the whole source
+		// Supporting includes means hashing every resolved include here as well, or edits to them would hit stale entries
+		uint64_t hash = FNV_Offset_Basis;
+		hash = HashBytes(hash, &Version, sizeof(Version));
+		hash = HashBytes(hash, &settings.ShaderType, sizeof(settings.ShaderType));
+		hash = HashBytes(hash, &settings.ShaderLanguage, sizeof(settings.ShaderLanguage));
+		hash = HashBytes(hash, &settings.Optimize, sizeof(settings.Optimize));
+		hash = HashBytes(hash, settings.ShaderCode.data(), settings.ShaderCode.size());
+		return hash;
+	}
+
+	bool ShaderCache::Load(uint64_t key, BinaryBuffer& codeBuffer, ShaderReflection& reflection)
+	{
+		if (s_Path.empty())
+			return false;
+
+		Path cachePath = GetCachePath(key);
+
+		std::ifstream file(cachePath, std::ios::binary);
+		if (!file.is_open())
+			return false;
+
+		ShaderCacheHeader header{ };
+		file.read((char*)&header, sizeof(ShaderCacheHeader));
+
+		if (!file || header.Magic != Magic || header.Version != Version || header.Key != key)
+			return false;
+
+		std::vector<uint8_t> code(header.CodeSize);
+		std::vector<uint8_t> vertexAttributes(header.VertexAttributesSize);
+		file.read((char*)code.data(), code.size());
+		file.read((char*)vertexAttributes.data(), vertexAttributes.size());
+
+		reflection.Bindings.resize(header.BindingCount);
+		for (ShaderBinding& binding : reflection.Bindings)
+		{
+			ReadString(file, binding.Name);
+			file.read((char*)&binding.DescriptorType, sizeof(binding.DescriptorType));
+			file.read((char*)&binding.Index, sizeof(binding.Index));
+		}
+
+		reflection.MaterialProperties.resize(header.PropertyCount);
+		for (MaterialProperty& materialProperty : reflection.MaterialProperties)
+		{
+			ReadString(file, materialProperty.Name);
+			file.read((char*)&materialProperty.Offset, sizeof(materialProperty.Offset));
+			file.read((char*)&materialProperty.Size, sizeof(materialProperty.Size));
+			file.read((char*)&materialProperty.Type, sizeof(materialProperty.Type));
+		}
+
+		// A truncated entry is treated as a miss and gets recompiled
+		if (!file)
+		{
+			Log::Warning("[ShaderCache] Discarding corrupt cache entry: " + cachePath.string());
+			return false;
+		}
+
+		codeBuffer.WriteData(code);
+		if (vertexAttributes.size() > 0)
+			reflection.VertexAttributes.WriteData(vertexAttributes);
+		reflection.MaterialBufferSize = header.MaterialBufferSize;
+		return true;
+	}
+
+	void ShaderCache::Save(uint64_t key, BinaryBuffer& codeBuffer, const ShaderReflection& reflection)
+	{
+		if (s_Path.empty())
+			return;
+
+		Path cachePath = GetCachePath(key);
+
+		// Batch compiles can save the same key from several threads, so each writes its own file and renames it into place
+		std::stringstream tempName;
+		tempName << cachePath.filename().string() << "." << std::this_thread::get_id() << ".tmp";
+		Path tempPath = cachePath.parent_path() / tempName.str();
+
+		std::error_code error;
+		if (!WriteEntry(tempPath, key, codeBuffer, reflection))
+		{
+			Log::Error("[ShaderCache] Unable to write cache file: " + tempPath.string());
+			std::filesystem::remove(tempPath, error);
+			return;
+		}
+
+		// Whichever thread renames last wins, both wrote the same contents
+		std::filesystem::rename(tempPath, cachePath, error);
+		if (error)
+			std::filesystem::remove(tempPath, error);
+	}
+
+	bool ShaderCache::WriteEntry(const Path& path, uint64_t key, BinaryBuffer& codeBuffer, const ShaderReflection& reflection)
+	{
+		std::ofstream file(path, std::ios::trunc | std::ios::binary);
+		if (!file.is_open())
+			return false;
+
+		BinaryBuffer vertexAttributes = reflection.VertexAttributes;
+
+		ShaderCacheHeader header{ };
+		header.Magic = Magic;
+		header.Version = Version;
+		header.Key = key;
+		header.CodeSize = codeBuffer.GetSize();
+		header.BindingCount = (uint32_t)reflection.Bindings.size();
+		header.PropertyCount = (uint32_t)reflection.MaterialProperties.size();
+		header.VertexAttributesSize = vertexAttributes.GetSize();
+		header.MaterialBufferSize = reflection.MaterialBufferSize;
+
+		file.write((char*)&header, sizeof(ShaderCacheHeader));
+		file.write((char*)codeBuffer.GetData().data(), codeBuffer.GetSize());
+		file.write((char*)vertexAttributes.GetData().data(), vertexAttributes.GetSize());
+
+		for (const ShaderBinding& binding : reflection.Bindings)
+		{
+			WriteString(file, binding.Name);
+			file.write((char*)&binding.DescriptorType, sizeof(binding.DescriptorType));
+			file.write((char*)&binding.Index, sizeof(binding.Index));
+		}
+
+		for (const MaterialProperty& materialProperty : reflection.MaterialProperties)
+		{
+			WriteString(file, materialProperty.Name);
+			file.write((char*)&materialProperty.Offset, sizeof(materialProperty.Offset));
+			file.write((char*)&materialProperty.Size, sizeof(materialProperty.Size));
+			file.write((char*)&materialProperty.Type, sizeof(materialProperty.Type));
+		}
+
+		file.close();
+		return !file.fail();
+	}
+
+	Path ShaderCache::GetCachePath(uint64_t key)
+	{
+		std::stringstream stream;
+		stream << std::hex << std::setw(16) << std::setfill('0') << key;
+		return s_Path / (stream.str() + ".spv");
+	}
+}
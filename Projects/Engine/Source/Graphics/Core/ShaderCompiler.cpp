@@ -3,13 +3,48 @@
 #include <fstream>
 #include <filesystem>
 #include "Log.h"
+#include "ThreadPool.h"
 
 namespace Odyssey
 {
+	struct CompileBatchState
+	{
+	public:
+		std::vector<ShaderCompiler::CompilerSettings> Settings;
+		std::vector<ShaderCompiler::Result> Results;
+		std::atomic<size_t> NextJob = 0;
+		size_t Completed = 0;
+		std::mutex Mutex;
+		std::condition_variable Condition;
+	};
+
+	shaderc::Compiler& GetThreadCompiler()
+	{
+		// shaderc compilers are not thread-safe, each thread gets its own instance
+		thread_local shaderc::Compiler compiler;
+		return compiler;
+	}
+
+	void RunCompileJobs(std::shared_ptr<CompileBatchState> state)
+	{
+		size_t jobCount = state->Settings.size();
+
+		// Helpers that start after the batch is finished find no work and exit
+		for (size_t i = state->NextJob++; i < jobCount; i = state->NextJob++)
+		{
+			ShaderCompiler::Result& result = state->Results[i];
+			result.Success = ShaderCompiler::Compile(state->Settings[i], result.CodeBuffer);
+
+			std::scoped_lock lock(state->Mutex);
+			if (++state->Completed == jobCount)
+				state->Condition.notify_all();
+		}
+	}
+
 	bool ShaderCompiler::Compile(const CompilerSettings settings, BinaryBuffer& codeBuffer)
 	{
 		// HLSL Shader
-		shaderc::Compiler compiler;
+		shaderc::Compiler& compiler = GetThreadCompiler();
 		shaderc::CompileOptions compilerOptions;
 
 		switch (settings.ShaderLanguage)
@@ -26,7 +61,7 @@ namespace Odyssey
 		default:
 			break;
 		}
-		if (s_Options.Optimize)
+		if (settings.Optimize)
 			compilerOptions.SetOptimizationLevel(shaderc_optimization_level_size);
 
 		auto type = settings.ShaderType == ShaderType::Vertex ? shaderc_vertex_shader : shaderc_fragment_shader;
@@ -53,4 +88,26 @@ namespace Odyssey
 		codeBuffer.WriteData(std::vector(result.begin(), result.end()));
 		return true;
 	}
-}
\ No newline at end of file
+
+	std::vector<ShaderCompiler::Result> ShaderCompiler::CompileBatch(const std::vector<CompilerSettings>& settings)
+	{
+		if (settings.size() == 0)
+			return { };
+
+		std::shared_ptr<CompileBatchState> state = std::make_shared<CompileBatchState>();
+		state->Settings = settings;
+		state->Results.resize(settings.size());
+
+		// The calling thread works through the batch as well so a busy pool can't stall it
+		size_t helperCount = std::min(settings.size() - 1, (size_t)ThreadPool::GetWorkerCount());
+		for (size_t i = 0; i < helperCount; i++)
+			ThreadPool::Submit([state]() { RunCompileJobs(state); });
+
+		RunCompileJobs(state);
+
+		std::unique_lock lock(state->Mutex);
+		state->Condition.wait(lock, [&state]() { return state->Completed == state->Settings.size(); });
+
+		return std::move(state->Results);
+	}
+}
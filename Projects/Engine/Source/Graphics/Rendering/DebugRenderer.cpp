@@ -1,4 +1,5 @@
 #include "DebugRenderer.h"
+#include "FrameAllocator.h"
 #include "Shader.h"
 #include "ResourceManager.h"
 #include "AssetManager.h"
@@ -18,7 +19,7 @@ namespace Odyssey
 		m_VertexBufferID = ResourceManager::Allocate<VulkanBuffer>(BufferType::Vertex, dataSize);
 
 		// Upload the vertex data
-		Ref<VulkanBuffer> vertexBuffer = ResourceManager::GetResource<VulkanBuffer>(m_VertexBufferID);
+		VulkanBuffer* vertexBuffer = ResourceManager::GetResource<VulkanBuffer>(m_VertexBufferID);
 		vertexBuffer->UploadData(m_Vertices.data(), dataSize);
 	}
 
@@ -63,8 +64,7 @@ namespace Odyssey
 	{
 		// Determine how many ring segments to add
 		size_t ringSegments = half ? (Ring_Segments / 2) + 1 : Ring_Segments;
-		std::vector<Vertex> vertices;
-		vertices.resize(ringSegments + 1);
+		FrameVector<Vertex> vertices(ringSegments + 1);
 
 		// The delta angle will always be measured using the full ring segments
 		constexpr float angleDelta = glm::two_pi<float>() / Ring_Segments;
@@ -92,9 +92,9 @@ namespace Odyssey
 
 		for (size_t i = 0; i < ringSegments; i++)
 		{
-			m_Vertices[m_VertexCount] = vertices[i];
+			m_Vertices[m_VertexCount] = PackedVertex(vertices[i]);
 			++m_VertexCount;
-			m_Vertices[m_VertexCount] = vertices[i + 1];
+			m_Vertices[m_VertexCount] = PackedVertex(vertices[i + 1]);
 			++m_VertexCount;
 		}
 	}
@@ -153,12 +153,10 @@ namespace Odyssey
 
 	void DebugRenderer::AddLine(float3 startPosition, float3 startColor, float3 endPosition, float3 endColor)
 	{
-		m_Vertices[m_VertexCount].Position = startPosition;
-		m_Vertices[m_VertexCount].Color = float4(startColor, 1.0f);
+		m_Vertices[m_VertexCount] = PackedVertex(Vertex(startPosition, float4(startColor, 1.0f)));
 		++m_VertexCount;
 
-		m_Vertices[m_VertexCount].Position = endPosition;
-		m_Vertices[m_VertexCount].Color = float4(endColor, 1.0f);
+		m_Vertices[m_VertexCount] = PackedVertex(Vertex(endPosition, float4(endColor, 1.0f)));
 		++m_VertexCount;
 	}
 
@@ -205,7 +203,7 @@ namespace Odyssey
 	{
 		// Upload the vertex data before returning the buffer ID
 		size_t dataSize = m_Vertices.size() * sizeof(m_Vertices[0]);
-		Ref<VulkanBuffer> vertexBuffer = ResourceManager::GetResource<VulkanBuffer>(m_VertexBufferID);
+		VulkanBuffer* vertexBuffer = ResourceManager::GetResource<VulkanBuffer>(m_VertexBufferID);
 		vertexBuffer->UploadData(m_Vertices.data(), dataSize);
 
 		return m_VertexBufferID;
@@ -0,0 +1,158 @@
+#include "Frustum.h"
+#include <xmmintrin.h>
+
+namespace Odyssey
+{
+	void BoundingBox::Encapsulate(float3 point)
+	{
+		Min = glm::min(Min, point);
+		Max = glm::max(Max, point);
+	}
+
+	BoundingBox BoundingBox::Transform(const mat4& matrix) const
+	{
+		// Transform the center and project the extents onto the new axes, tighter than transforming all eight corners
+		float3 center = (Min + Max) * 0.5f;
+		float3 extents = (Max - Min) * 0.5f;
+
+		float3 worldCenter = float3(matrix * float4(center, 1.0f));
+		float3 worldExtents = glm::abs(float3(matrix[0])) * extents.x +
+			glm::abs(float3(matrix[1])) * extents.y +
+			glm::abs(float3(matrix[2])) * extents.z;
+
+		return BoundingBox(worldCenter - worldExtents, worldCenter + worldExtents);
+	}
+
+	BoundingBox BoundingBox::Infinite()
+	{
+		return BoundingBox(float3(std::numeric_limits<float>::lowest()), float3(std::numeric_limits<float>::max()));
+	}
+
+	void BoundsArray::Clear()
+	{
+		MinX.clear();
+		MinY.clear();
+		MinZ.clear();
+		MaxX.clear();
+		MaxY.clear();
+		MaxZ.clear();
+	}
+
+	uint32_t BoundsArray::Add(const BoundingBox& bounds)
+	{
+		uint32_t index = (uint32_t)MinX.size();
+		MinX.push_back(bounds.Min.x);
+		MinY.push_back(bounds.Min.y);
+		MinZ.push_back(bounds.Min.z);
+		MaxX.push_back(bounds.Max.x);
+		MaxY.push_back(bounds.Max.y);
+		MaxZ.push_back(bounds.Max.z);
+		return index;
+	}
+
+	void BoundsArray::Set(uint32_t index, const BoundingBox& bounds)
+	{
+		MinX[index] = bounds.Min.x;
+		MinY[index] = bounds.Min.y;
+		MinZ[index] = bounds.Min.z;
+		MaxX[index] = bounds.Max.x;
+		MaxY[index] = bounds.Max.y;
+		MaxZ[index] = bounds.Max.z;
+	}
+
+	Frustum::Frustum(const mat4& viewProjection)
+	{
+		// Gribb/Hartmann extraction, the rows of the transpose are the rows of the view projection
+		mat4 rows = glm::transpose(viewProjection);
+
+		m_Planes[Left] = rows[3] + rows[0];
+		m_Planes[Right] = rows[3] - rows[0];
+		m_Planes[Bottom] = rows[3] + rows[1];
+		m_Planes[Top] = rows[3] - rows[1];
+
+		// Clip space depth is [0, 1], reversed depth only swaps which of these is the near plane
+		m_Planes[Near] = rows[2];
+		m_Planes[Far] = rows[3] - rows[2];
+
+		for (float4& plane : m_Planes)
+		{
+			float length = glm::length(float3(plane));
+			if (length > 0.0f)
+				plane /= length;
+		}
+	}
+
+	bool Frustum::Intersects(const BoundingBox& bounds) const
+	{
+		for (const float4& plane : m_Planes)
+		{
+			// Only the corner furthest along the normal needs testing
+			float3 corner = float3(plane.x >= 0.0f ? bounds.Max.x : bounds.Min.x,
+				plane.y >= 0.0f ? bounds.Max.y : bounds.Min.y,
+				plane.z >= 0.0f ? bounds.Max.z : bounds.Min.z);
+
+			if (glm::dot(float3(plane), corner) + plane.w < 0.0f)
+				return false;
+		}
+
+		return true;
+	}
+
+	void Frustum::Cull(const BoundsArray& bounds, std::vector<uint32_t>& visible) const
+	{
+		const size_t count = bounds.Size();
+
+		// The furthest corner only depends on the plane, so each plane reads whole arrays instead of blending per box
+		const float* cornerX[Plane::Count];
+		const float* cornerY[Plane::Count];
+		const float* cornerZ[Plane::Count];
+		__m128 planeX[Plane::Count];
+		__m128 planeY[Plane::Count];
+		__m128 planeZ[Plane::Count];
+		__m128 planeW[Plane::Count];
+
+		for (uint32_t p = 0; p < Plane::Count; p++)
+		{
+			const float4& plane = m_Planes[p];
+			cornerX[p] = plane.x >= 0.0f ? bounds.MaxX.data() : bounds.MinX.data();
+			cornerY[p] = plane.y >= 0.0f ? bounds.MaxY.data() : bounds.MinY.data();
+			cornerZ[p] = plane.z >= 0.0f ? bounds.MaxZ.data() : bounds.MinZ.data();
+			planeX[p] = _mm_set1_ps(plane.x);
+			planeY[p] = _mm_set1_ps(plane.y);
+			planeZ[p] = _mm_set1_ps(plane.z);
+			planeW[p] = _mm_set1_ps(plane.w);
+		}
+
+		const __m128 zero = _mm_setzero_ps();
+		size_t i = 0;
+
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 outside = zero;
+
+			for (uint32_t p = 0; p < Plane::Count; p++)
+			{
+				__m128 distance = _mm_add_ps(
+					_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(cornerX[p] + i), planeX[p]), _mm_mul_ps(_mm_loadu_ps(cornerY[p] + i), planeY[p])),
+					_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(cornerZ[p] + i), planeZ[p]), planeW[p]));
+
+				outside = _mm_or_ps(outside, _mm_cmplt_ps(distance, zero));
+			}
+
+			int insideMask = ~_mm_movemask_ps(outside) & 0xF;
+			for (uint32_t lane = 0; lane < 4; lane++)
+			{
+				if (insideMask & (1 << lane))
+					visible.push_back((uint32_t)(i + lane));
+			}
+		}
+
+		// Remainder that doesn't fill a full register
+		for (; i < count; i++)
+		{
+			BoundingBox box(float3(bounds.MinX[i], bounds.MinY[i], bounds.MinZ[i]), float3(bounds.MaxX[i], bounds.MaxY[i], bounds.MaxZ[i]));
+			if (Intersects(box))
+				visible.push_back((uint32_t)i);
+		}
+	}
+}
@@ -16,6 +16,40 @@ namespace Odyssey
 		LoadFromDisk(assetPath);
 	}
 
+	Material::Material(const Path& assetPath, LoadData& loadData)
+		: Asset(assetPath)
+	{
+		// The dependencies in the load data are already in flight and resolve through the asset manager
+		LoadFromDisk(assetPath);
+	}
+
+	void Material::Decode(const Path& assetPath, LoadData& loadData)
+	{
+		AssetDeserializer deserializer(assetPath);
+		if (deserializer.IsValid())
+		{
+			SerializationNode root = deserializer.GetRoot();
+			root.ReadData("m_Shader", loadData.Shader.Ref());
+
+			SerializationNode texturesNode = root.GetNode("Property Textures");
+			for (size_t i = 0; i < texturesNode.ChildCount(); i++)
+			{
+				GUID textureGUID;
+				texturesNode.GetChild(i).ReadData("Texture", textureGUID.Ref());
+
+				if (textureGUID)
+					loadData.Textures.push_back(textureGUID);
+			}
+		}
+
+		// Shared dependencies are only decoded once no matter how many materials request them
+		if (loadData.Shader)
+			AssetManager::LoadAssetAsync<Shader>(loadData.Shader);
+
+		for (GUID textureGUID : loadData.Textures)
+			AssetManager::LoadAssetAsync<Texture2D>(textureGUID);
+	}
+
 	void Material::Save()
 	{
 		if (!m_AssetPath.empty())
@@ -205,6 +239,8 @@ namespace Odyssey
 
 		if (m_Shader)
 			CreatePipeline();
+
+		m_Version++;
 	}
 
 	void Material::CreatePipeline()
@@ -226,6 +262,7 @@ namespace Odyssey
 	void Material::OnShaderModified()
 	{
 		m_RemakePipeline = true;
+		m_Version++;
 	}
 
 	ResourceID Material::GetPipeline()
@@ -243,7 +280,7 @@ namespace Odyssey
 	{
 		if (m_MaterialBuffer.IsValid() && m_UpdateBuffer)
 		{
-			Ref<VulkanBuffer> materialBuffer = ResourceManager::GetResource<VulkanBuffer>(m_MaterialBuffer);
+			VulkanBuffer* materialBuffer = ResourceManager::GetResource<VulkanBuffer>(m_MaterialBuffer);
 			materialBuffer->CopyData(m_MaterialData.Size, m_MaterialData.Buffer.GetData());
 		}
 
@@ -274,23 +311,27 @@ namespace Odyssey
 			m_MaterialBuffer = ResourceManager::Allocate<VulkanBuffer>(BufferType::Uniform, m_MaterialData.Size);
 
 		m_UpdateBuffer = true;
+		m_Version++;
 	}
 
 	void Material::SetTexture(std::string propertyName, GUID texture)
 	{
 		m_Textures[propertyName] = AssetManager::LoadAsset<Texture2D>(texture);
+		m_Version++;
 	}
 
 	void Material::SetBlendMode(BlendMode blendMode)
 	{
 		m_BlendMode = blendMode;
 		m_RemakePipeline = true;
+		m_Version++;
 	}
 
 	void Material::SetDepthWrite(bool write)
 	{
 		m_DepthWrite = write;
 		m_RemakePipeline = true;
+		m_Version++;
 	}
 
 	float Material::GetFloat(const std::string& propertyName)
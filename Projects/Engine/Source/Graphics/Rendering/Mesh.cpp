@@ -14,6 +14,12 @@ namespace Odyssey
 		Load();
 	}
 
+	Mesh::Mesh(const Path& assetPath, LoadData& loadData)
+		: Asset(assetPath)
+	{
+		Load(loadData);
+	}
+
 	Mesh::Mesh(const Path& assetPath, Ref<SourceModel> source, uint32_t meshIndex)
 		: Asset(assetPath)
 	{
@@ -29,15 +35,70 @@ namespace Odyssey
 
 	void Mesh::Load()
 	{
-		AssetDeserializer deserializer(m_AssetPath);
+		LoadData loadData;
+		Decode(m_AssetPath, loadData);
+		Load(loadData);
+	}
+
+	void Mesh::Decode(const Path& assetPath, LoadData& loadData)
+	{
+		GUID guid;
+		GUID sourceAsset;
+
+		AssetDeserializer deserializer(assetPath);
 		if (deserializer.IsValid())
 		{
 			SerializationNode root = deserializer.GetRoot();
-			root.ReadData("Mesh Index", m_MeshIndex);
+			root.ReadData("m_GUID", guid.Ref());
+			root.ReadData("m_SourceAsset", sourceAsset.Ref());
+			root.ReadData("Mesh Index", loadData.MeshIndex);
+			root.ReadData("Quantize Positions", loadData.QuantizePositions);
+		}
+
+		MeshCache::Settings settings = GetCacheSettings(sourceAsset, loadData.MeshIndex, loadData.QuantizePositions);
+
+		// The cooked mesh skips the model importer entirely
+		if (guid)
+		{
+			BinaryBuffer buffer = AssetManager::LoadBinaryData(guid);
+			if (buffer && MeshCache::Uncook(buffer, settings, loadData.Submeshes))
+				return;
+
+			loadData.Submeshes.clear();
 		}
 
-		if (Ref<SourceModel> source = AssetManager::LoadSourceAsset<SourceModel>(m_SourceAsset))
-			LoadFromSource(source);
+		if (Ref<SourceModel> source = AssetManager::LoadSourceAsset<SourceModel>(sourceAsset))
+		{
+			auto importer = source->GetImporter();
+			const MeshImportData& meshData = importer->GetMeshData(loadData.MeshIndex);
+
+			for (const SubmeshImportData& submeshData : meshData.Submeshes)
+				loadData.Submeshes.push_back({ PackedVertex::Pack(submeshData.Vertices), submeshData.Indices });
+
+			// Cook the imported data so the next load can skip the importer
+			if (guid)
+			{
+				BinaryBuffer buffer = MeshCache::Cook(meshData, settings);
+				AssetManager::SaveBinaryData(guid, buffer);
+			}
+		}
+	}
+
+	void Mesh::Load(LoadData& loadData)
+	{
+		m_MeshIndex = loadData.MeshIndex;
+		m_QuantizePositions = loadData.QuantizePositions;
+		m_SubMeshes.resize(loadData.Submeshes.size());
+
+		for (size_t i = 0; i < m_SubMeshes.size(); i++)
+		{
+			if (loadData.Submeshes[i].Vertices.size() > 0 &&
+				loadData.Submeshes[i].Indices.size() > 0)
+			{
+				SetVertices(loadData.Submeshes[i].Vertices, i);
+				SetIndices(loadData.Submeshes[i].Indices, i);
+			}
+		}
 	}
 
 	void Mesh::LoadFromSource(Ref<SourceModel> source)
@@ -60,6 +121,13 @@ namespace Odyssey
 				SetIndices(submeshData.Indices, i);
 			}
 		}
+
+		// Cook the imported data so the next load can skip the importer
+		if (m_GUID)
+		{
+			BinaryBuffer buffer = MeshCache::Cook(meshData, GetCacheSettings());
+			AssetManager::SaveBinaryData(m_GUID, buffer);
+		}
 	}
 
 	void Mesh::SaveToDisk(const Path& path)
@@ -71,9 +139,34 @@ namespace Odyssey
 		SerializeMetadata(serializer);
 
 		root.WriteData("Mesh Index", m_MeshIndex);
+		root.WriteData("Quantize Positions", m_QuantizePositions);
 		serializer.WriteToDisk(path);
 	}
 
+	MeshCache::Settings Mesh::GetCacheSettings()
+	{
+		return GetCacheSettings(m_SourceAsset, m_MeshIndex, m_QuantizePositions);
+	}
+
+	MeshCache::Settings Mesh::GetCacheSettings(GUID sourceAsset, size_t meshIndex, bool quantizePositions)
+	{
+		MeshCache::Settings settings;
+		settings.MeshIndex = (uint32_t)meshIndex;
+		settings.QuantizePositions = quantizePositions;
+
+		// Re-cook whenever the source model changes on disk
+		Path sourcePath = AssetManager::GUIDToPath(sourceAsset);
+		if (!sourcePath.empty())
+		{
+			std::error_code error;
+			auto writeTime = std::filesystem::last_write_time(sourcePath, error);
+			if (!error)
+				settings.SourceTimestamp = (uint64_t)writeTime.time_since_epoch().count();
+		}
+
+		return settings;
+	}
+
 	SubMesh* Mesh::GetSubmesh(size_t submeshIndex)
 	{
 		if (submeshIndex < m_SubMeshes.size())
@@ -83,23 +176,35 @@ namespace Odyssey
 	}
 
 	void Mesh::SetVertices(const std::vector<Vertex>& vertices, size_t submeshIndex)
+	{
+		SetVertices(PackedVertex::Pack(vertices), submeshIndex);
+	}
+
+	void Mesh::SetVertices(const std::vector<PackedVertex>& vertices, size_t submeshIndex)
 	{
 		assert(submeshIndex < m_SubMeshes.size());
 
+		// Note: No CPU copy is kept once the data is on the GPU
 		SubMesh& submesh = m_SubMeshes[submeshIndex];
-		submesh.Vertices = vertices;
-		submesh.VertexCount = (uint16_t)submesh.Vertices.size();
+		submesh.VertexCount = (uint32_t)vertices.size();
+
+		// Keep the bounds since the vertices aren't kept around
+		submesh.Bounds = BoundingBox();
+		for (const PackedVertex& vertex : vertices)
+			submesh.Bounds.Encapsulate(vertex.Position);
 
-		if (submesh.VertexBuffer)
+		if (submesh.VertexBuffer.IsValid())
 			ResourceManager::Destroy(submesh.VertexBuffer);
 
 		// Allocate the vertex buffer
-		size_t dataSize = submesh.Vertices.size() * sizeof(submesh.Vertices[0]);
+		size_t dataSize = vertices.size() * sizeof(PackedVertex);
 		submesh.VertexBuffer = ResourceManager::Allocate<VulkanBuffer>(BufferType::Vertex, dataSize);
 
 		// Upload the vertices to the GPU
-		Ref<VulkanBuffer> vertexBuffer = ResourceManager::GetResource<VulkanBuffer>(submesh.VertexBuffer);
+		VulkanBuffer* vertexBuffer = ResourceManager::GetResource<VulkanBuffer>(submesh.VertexBuffer);
 		vertexBuffer->UploadData(vertices.data(), dataSize);
+
+		m_Version++;
 	}
 
 	void Mesh::SetIndices(const std::vector<uint32_t>& indices, size_t submeshIndex)
@@ -107,15 +212,31 @@ namespace Odyssey
 		assert(submeshIndex < m_SubMeshes.size());
 
 		SubMesh& submesh = m_SubMeshes[submeshIndex];
-		submesh.Indices = indices;
 		submesh.IndexCount = (uint32_t)indices.size();
+		m_Version++;
 
-		if (submesh.IndexBuffer)
+		if (submesh.IndexBuffer.IsValid())
 			ResourceManager::Destroy(submesh.IndexBuffer);
 
-		size_t dataSize = submesh.Indices.size() * sizeof(submesh.Indices[0]);
-		submesh.IndexBuffer = ResourceManager::Allocate<VulkanBuffer>(BufferType::Index, dataSize);
-		Ref<VulkanBuffer> indexBuffer = ResourceManager::GetResource<VulkanBuffer>(submesh.IndexBuffer);
-		indexBuffer->UploadData(indices.data(), dataSize);
+		// Use 16-bit indices whenever every vertex is addressable with them
+		uint32_t maxIndex = indices.size() > 0 ? *std::max_element(indices.begin(), indices.end()) : 0;
+		submesh.IndexFormat = maxIndex <= std::numeric_limits<uint16_t>::max() ? IndexType::UInt16 : IndexType::UInt32;
+
+		if (submesh.IndexFormat == IndexType::UInt16)
+		{
+			std::vector<uint16_t> indices16(indices.begin(), indices.end());
+
+			size_t dataSize = indices16.size() * sizeof(uint16_t);
+			submesh.IndexBuffer = ResourceManager::Allocate<VulkanBuffer>(BufferType::Index, dataSize);
+			VulkanBuffer* indexBuffer = ResourceManager::GetResource<VulkanBuffer>(submesh.IndexBuffer);
+			indexBuffer->UploadData(indices16.data(), dataSize);
+		}
+		else
+		{
+			size_t dataSize = indices.size() * sizeof(uint32_t);
+			submesh.IndexBuffer = ResourceManager::Allocate<VulkanBuffer>(BufferType::Index, dataSize);
+			VulkanBuffer* indexBuffer = ResourceManager::GetResource<VulkanBuffer>(submesh.IndexBuffer);
+			indexBuffer->UploadData(indices.data(), dataSize);
+		}
 	}
 }
\ No newline at end of file
@@ -0,0 +1,462 @@
+#include "MeshCache.h"
+#include "ModelAssetImporter.h"
+#include "GeometryUtil.h"
+
+namespace Odyssey
+{
+	// Each attribute is stored as its own stream in the layout picked for that submesh
+	enum MeshCacheAttribute : uint32_t
+	{
+		Attribute_Normal = 1 << 0,
+		Attribute_Tangent = 1 << 1,
+		Attribute_Color = 1 << 2,
+		Attribute_BoneIndices8 = 1 << 3,
+		Attribute_BoneIndices16 = 1 << 4,
+		Attribute_BoneWeights = 1 << 5,
+		Attribute_QuantizedPosition = 1 << 6,
+		Attribute_Indices16 = 1 << 7,
+		Attribute_TexCoord0 = 1 << 8,  // One bit per channel, 8 channels
+		Attribute_HalfTexCoord0 = 1 << 16, // One bit per channel, 8 channels
+	};
+
+	struct MeshCacheHeader
+	{
+		uint32_t Magic;
+		uint32_t Version;
+		uint64_t SourceTimestamp;
+		uint32_t MeshIndex;
+		uint32_t SubmeshCount;
+		uint32_t QuantizePositions;
+		uint32_t Reserved;
+	};
+
+	struct SubmeshCacheHeader
+	{
+		uint32_t VertexCount;
+		uint32_t IndexCount;
+		uint32_t Attributes;
+		uint32_t Reserved;
+		float BoundsMin[3];
+		float BoundsMax[3];
+	};
+
+	inline static constexpr uint32_t TexCoord_Channels = 8;
+	inline static constexpr uint32_t Packed_TexCoord_Channels = 2;
+
+	// Half precision is only used when every uv in the channel survives the round trip
+	inline static constexpr float Half_TexCoord_Tolerance = 1.0f / 4096.0f;
+
+	inline static float2* GetTexCoord(Vertex& vertex, uint32_t channel)
+	{
+		return &vertex.TexCoord0 + channel;
+	}
+
+	inline static const float2* GetTexCoord(const Vertex& vertex, uint32_t channel)
+	{
+		return &vertex.TexCoord0 + channel;
+	}
+
+	inline static uint32_t* GetTexCoord(PackedVertex& vertex, uint32_t channel)
+	{
+		return &vertex.TexCoord0 + channel;
+	}
+
+	template<typename T>
+	inline static void WriteStream(std::vector<uint8_t>& data, const T* values, size_t count)
+	{
+		size_t offset = data.size();
+		data.resize(offset + sizeof(T) * count);
+		memcpy(data.data() + offset, values, sizeof(T) * count);
+	}
+
+	struct MeshCacheReader
+	{
+	public:
+		template<typename T>
+		bool Read(T* values, size_t count)
+		{
+			size_t size = sizeof(T) * count;
+			if (Offset + size > Size)
+				return false;
+
+			memcpy(values, Data + Offset, size);
+			Offset += size;
+			return true;
+		}
+
+		template<typename T>
+		bool Read(std::vector<T>& values, size_t count)
+		{
+			values.resize(count);
+			return Read(values.data(), count);
+		}
+
+	public:
+		const uint8_t* Data = nullptr;
+		size_t Size = 0;
+		size_t Offset = 0;
+	};
+
+	inline static uint32_t SelectAttributes(const std::vector<Vertex>& vertices, bool quantizePositions)
+	{
+		// Anything that never differs from the default vertex is left out of the layout entirely
+		const Vertex defaultVertex;
+		uint32_t attributes = quantizePositions ? Attribute_QuantizedPosition : 0;
+		uint32_t maxBoneIndex = 0;
+
+		for (const Vertex& vertex : vertices)
+		{
+			if (vertex.Normal != defaultVertex.Normal)
+				attributes |= Attribute_Normal;
+			if (vertex.Tangent != defaultVertex.Tangent)
+				attributes |= Attribute_Tangent;
+			if (vertex.Color != defaultVertex.Color)
+				attributes |= Attribute_Color;
+			if (vertex.BoneWeights != defaultVertex.BoneWeights)
+				attributes |= Attribute_BoneWeights;
+			if (vertex.BoneIndices != defaultVertex.BoneIndices)
+				maxBoneIndex = glm::max(maxBoneIndex, (uint32_t)glm::compMax(vertex.BoneIndices));
+
+			for (uint32_t channel = 0; channel < TexCoord_Channels; channel++)
+			{
+				if (*GetTexCoord(vertex, channel) != *GetTexCoord(defaultVertex, channel))
+					attributes |= Attribute_TexCoord0 << channel;
+			}
+		}
+
+		if (attributes & Attribute_BoneWeights)
+			attributes |= maxBoneIndex <= std::numeric_limits<uint8_t>::max() ? Attribute_BoneIndices8 : Attribute_BoneIndices16;
+
+		for (uint32_t channel = 0; channel < TexCoord_Channels; channel++)
+		{
+			if ((attributes & (Attribute_TexCoord0 << channel)) == 0)
+				continue;
+
+			bool halfPrecision = true;
+			for (size_t i = 0; i < vertices.size() && halfPrecision; i++)
+			{
+				float2 uv = *GetTexCoord(vertices[i], channel);
+				float2 roundTrip = glm::unpackHalf2x16(glm::packHalf2x16(uv));
+				halfPrecision = glm::all(glm::lessThanEqual(glm::abs(roundTrip - uv), float2(Half_TexCoord_Tolerance)));
+			}
+
+			if (halfPrecision)
+				attributes |= Attribute_HalfTexCoord0 << channel;
+		}
+
+		if (vertices.size() <= (size_t)std::numeric_limits<uint16_t>::max() + 1)
+			attributes |= Attribute_Indices16;
+
+		return attributes;
+	}
+
+	inline static void CookSubmesh(std::vector<uint8_t>& data, const SubmeshImportData& submeshData, bool quantizePositions)
+	{
+		const std::vector<Vertex>& vertices = submeshData.Vertices;
+		const std::vector<uint32_t>& indices = submeshData.Indices;
+		size_t vertexCount = vertices.size();
+
+		SubmeshCacheHeader header{ };
+		header.VertexCount = (uint32_t)vertexCount;
+		header.IndexCount = (uint32_t)indices.size();
+		header.Attributes = SelectAttributes(vertices, quantizePositions);
+
+		float3 boundsMin = vertexCount > 0 ? vertices[0].Position : float3(0.0f);
+		float3 boundsMax = boundsMin;
+		for (const Vertex& vertex : vertices)
+		{
+			boundsMin = glm::min(boundsMin, vertex.Position);
+			boundsMax = glm::max(boundsMax, vertex.Position);
+		}
+
+		memcpy(header.BoundsMin, &boundsMin, sizeof(float3));
+		memcpy(header.BoundsMax, &boundsMax, sizeof(float3));
+		WriteStream(data, &header, 1);
+
+		if (header.Attributes & Attribute_QuantizedPosition)
+		{
+			// 16-bit positions relative to the submesh bounds
+			float3 extents = glm::max(boundsMax - boundsMin, float3(std::numeric_limits<float>::epsilon()));
+			std::vector<glm::u16vec3> positions(vertexCount);
+			for (size_t i = 0; i < vertexCount; i++)
+				positions[i] = glm::u16vec3(glm::round((vertices[i].Position - boundsMin) / extents * 65535.0f));
+			WriteStream(data, positions.data(), vertexCount);
+		}
+		else
+		{
+			std::vector<float3> positions(vertexCount);
+			for (size_t i = 0; i < vertexCount; i++)
+				positions[i] = vertices[i].Position;
+			WriteStream(data, positions.data(), vertexCount);
+		}
+
+		if (header.Attributes & Attribute_Normal)
+		{
+			std::vector<uint32_t> normals(vertexCount);
+			for (size_t i = 0; i < vertexCount; i++)
+				normals[i] = glm::packSnorm2x16(GeometryUtil::OctahedralEncode(vertices[i].Normal));
+			WriteStream(data, normals.data(), vertexCount);
+		}
+
+		if (header.Attributes & Attribute_Tangent)
+		{
+			// Octahedral direction with the handedness kept in the last component
+			std::vector<glm::i16vec4> tangents(vertexCount);
+			for (size_t i = 0; i < vertexCount; i++)
+			{
+				const float4& tangent = vertices[i].Tangent;
+				float2 encoded = GeometryUtil::OctahedralEncode(float3(tangent));
+				tangents[i] = glm::i16vec4(glm::round(glm::clamp(float4(encoded, tangent.w, 0.0f), -1.0f, 1.0f) * 32767.0f));
+			}
+			WriteStream(data, tangents.data(), vertexCount);
+		}
+
+		if (header.Attributes & Attribute_Color)
+		{
+			std::vector<uint32_t> colors(vertexCount);
+			for (size_t i = 0; i < vertexCount; i++)
+				colors[i] = glm::packUnorm4x8(vertices[i].Color);
+			WriteStream(data, colors.data(), vertexCount);
+		}
+
+		for (uint32_t channel = 0; channel < TexCoord_Channels; channel++)
+		{
+			if ((header.Attributes & (Attribute_TexCoord0 << channel)) == 0)
+				continue;
+
+			if (header.Attributes & (Attribute_HalfTexCoord0 << channel))
+			{
+				std::vector<uint32_t> texCoords(vertexCount);
+				for (size_t i = 0; i < vertexCount; i++)
+					texCoords[i] = glm::packHalf2x16(*GetTexCoord(vertices[i], channel));
+				WriteStream(data, texCoords.data(), vertexCount);
+			}
+			else
+			{
+				std::vector<float2> texCoords(vertexCount);
+				for (size_t i = 0; i < vertexCount; i++)
+					texCoords[i] = *GetTexCoord(vertices[i], channel);
+				WriteStream(data, texCoords.data(), vertexCount);
+			}
+		}
+
+		if (header.Attributes & Attribute_BoneIndices8)
+		{
+			std::vector<glm::u8vec4> boneIndices(vertexCount);
+			for (size_t i = 0; i < vertexCount; i++)
+				boneIndices[i] = glm::u8vec4(vertices[i].BoneIndices);
+			WriteStream(data, boneIndices.data(), vertexCount);
+		}
+		else if (header.Attributes & Attribute_BoneIndices16)
+		{
+			std::vector<glm::u16vec4> boneIndices(vertexCount);
+			for (size_t i = 0; i < vertexCount; i++)
+				boneIndices[i] = glm::u16vec4(vertices[i].BoneIndices);
+			WriteStream(data, boneIndices.data(), vertexCount);
+		}
+
+		if (header.Attributes & Attribute_BoneWeights)
+		{
+			std::vector<uint64_t> boneWeights(vertexCount);
+			for (size_t i = 0; i < vertexCount; i++)
+				boneWeights[i] = glm::packUnorm4x16(vertices[i].BoneWeights);
+			WriteStream(data, boneWeights.data(), vertexCount);
+		}
+
+		if (header.Attributes & Attribute_Indices16)
+		{
+			std::vector<uint16_t> indices16(indices.begin(), indices.end());
+			WriteStream(data, indices16.data(), indices16.size());
+		}
+		else
+		{
+			WriteStream(data, indices.data(), indices.size());
+		}
+	}
+
+	inline static bool UncookSubmesh(MeshCacheReader& reader, MeshCache::Submesh& submesh)
+	{
+		SubmeshCacheHeader header;
+		if (!reader.Read(&header, 1))
+			return false;
+
+		size_t vertexCount = header.VertexCount;
+		submesh.Vertices.resize(vertexCount, PackedVertex());
+		submesh.Indices.resize(header.IndexCount);
+
+		// Normals, colors, half uvs and weights are cooked in the same format the GPU reads
+		std::vector<PackedVertex>& vertices = submesh.Vertices;
+
+		if (header.Attributes & Attribute_QuantizedPosition)
+		{
+			float3 boundsMin = float3(header.BoundsMin[0], header.BoundsMin[1], header.BoundsMin[2]);
+			float3 boundsMax = float3(header.BoundsMax[0], header.BoundsMax[1], header.BoundsMax[2]);
+			float3 extents = glm::max(boundsMax - boundsMin, float3(std::numeric_limits<float>::epsilon()));
+
+			std::vector<glm::u16vec3> positions;
+			if (!reader.Read(positions, vertexCount))
+				return false;
+
+			for (size_t i = 0; i < vertexCount; i++)
+				vertices[i].Position = boundsMin + float3(positions[i]) / 65535.0f * extents;
+		}
+		else
+		{
+			std::vector<float3> positions;
+			if (!reader.Read(positions, vertexCount))
+				return false;
+
+			for (size_t i = 0; i < vertexCount; i++)
+				vertices[i].Position = positions[i];
+		}
+
+		if (header.Attributes & Attribute_Normal)
+		{
+			std::vector<glm::i16vec2> normals;
+			if (!reader.Read(normals, vertexCount))
+				return false;
+
+			for (size_t i = 0; i < vertexCount; i++)
+				vertices[i].Normal = normals[i];
+		}
+
+		if (header.Attributes & Attribute_Tangent)
+		{
+			std::vector<glm::i16vec4> tangents;
+			if (!reader.Read(tangents, vertexCount))
+				return false;
+
+			// The GPU keeps the full direction so the handedness needs no extra decode
+			for (size_t i = 0; i < vertexCount; i++)
+			{
+				float4 tangent = float4(tangents[i]) / 32767.0f;
+				float3 direction = GeometryUtil::OctahedralDecode(float2(tangent));
+				vertices[i].Tangent = glm::i16vec4(glm::round(float4(direction, tangent.z) * 32767.0f));
+			}
+		}
+
+		if (header.Attributes & Attribute_Color)
+		{
+			std::vector<glm::u8vec4> colors;
+			if (!reader.Read(colors, vertexCount))
+				return false;
+
+			for (size_t i = 0; i < vertexCount; i++)
+				vertices[i].Color = colors[i];
+		}
+
+		for (uint32_t channel = 0; channel < TexCoord_Channels; channel++)
+		{
+			if ((header.Attributes & (Attribute_TexCoord0 << channel)) == 0)
+				continue;
+
+			// Channels past the packed vertex are still cooked but have nowhere to go on the GPU
+			bool packed = channel < Packed_TexCoord_Channels;
+
+			if (header.Attributes & (Attribute_HalfTexCoord0 << channel))
+			{
+				std::vector<uint32_t> texCoords;
+				if (!reader.Read(texCoords, vertexCount))
+					return false;
+
+				for (size_t i = 0; i < vertexCount && packed; i++)
+					*GetTexCoord(vertices[i], channel) = texCoords[i];
+			}
+			else
+			{
+				std::vector<float2> texCoords;
+				if (!reader.Read(texCoords, vertexCount))
+					return false;
+
+				for (size_t i = 0; i < vertexCount && packed; i++)
+					*GetTexCoord(vertices[i], channel) = glm::packHalf2x16(texCoords[i]);
+			}
+		}
+
+		if (header.Attributes & Attribute_BoneIndices8)
+		{
+			std::vector<glm::u8vec4> boneIndices;
+			if (!reader.Read(boneIndices, vertexCount))
+				return false;
+
+			for (size_t i = 0; i < vertexCount; i++)
+				vertices[i].BoneIndices = glm::u16vec4(boneIndices[i]);
+		}
+		else if (header.Attributes & Attribute_BoneIndices16)
+		{
+			std::vector<glm::u16vec4> boneIndices;
+			if (!reader.Read(boneIndices, vertexCount))
+				return false;
+
+			for (size_t i = 0; i < vertexCount; i++)
+				vertices[i].BoneIndices = boneIndices[i];
+		}
+
+		if (header.Attributes & Attribute_BoneWeights)
+		{
+			std::vector<glm::u16vec4> boneWeights;
+			if (!reader.Read(boneWeights, vertexCount))
+				return false;
+
+			for (size_t i = 0; i < vertexCount; i++)
+				vertices[i].BoneWeights = boneWeights[i];
+		}
+
+		if (header.Attributes & Attribute_Indices16)
+		{
+			std::vector<uint16_t> indices16;
+			if (!reader.Read(indices16, header.IndexCount))
+				return false;
+
+			std::copy(indices16.begin(), indices16.end(), submesh.Indices.begin());
+			return true;
+		}
+
+		return reader.Read(submesh.Indices.data(), header.IndexCount);
+	}
+
+	BinaryBuffer MeshCache::Cook(const MeshImportData& meshData, const Settings& settings)
+	{
+		std::vector<uint8_t> data;
+
+		MeshCacheHeader header{ };
+		header.Magic = Magic;
+		header.Version = Version;
+		header.SourceTimestamp = settings.SourceTimestamp;
+		header.MeshIndex = settings.MeshIndex;
+		header.SubmeshCount = (uint32_t)meshData.Submeshes.size();
+		header.QuantizePositions = settings.QuantizePositions;
+		WriteStream(data, &header, 1);
+
+		for (const SubmeshImportData& submeshData : meshData.Submeshes)
+			CookSubmesh(data, submeshData, settings.QuantizePositions);
+
+		return BinaryBuffer(std::move(data));
+	}
+
+	bool MeshCache::Uncook(BinaryBuffer& buffer, const Settings& settings, std::vector<Submesh>& submeshes)
+	{
+		MeshCacheReader reader;
+		reader.Data = buffer.GetData().data();
+		reader.Size = buffer.GetSize();
+
+		// Anything cooked from a different source or with different settings is stale
+		MeshCacheHeader header;
+		if (!reader.Read(&header, 1) ||
+			header.Magic != Magic || header.Version != Version ||
+			header.SourceTimestamp != settings.SourceTimestamp ||
+			header.MeshIndex != settings.MeshIndex ||
+			header.QuantizePositions != (uint32_t)settings.QuantizePositions)
+			return false;
+
+		submeshes.resize(header.SubmeshCount);
+
+		for (Submesh& submesh : submeshes)
+		{
+			if (!UncookSubmesh(reader, submesh))
+				return false;
+		}
+
+		return true;
+	}
+}
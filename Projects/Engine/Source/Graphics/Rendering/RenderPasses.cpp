@@ -23,13 +23,13 @@ namespace Odyssey
 {
 	void RenderPass::PrepareRendering(RenderPassParams& params)
 	{
-		Ref<VulkanCommandBuffer> commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(params.GraphicsCommandBuffer);
+		VulkanCommandBuffer* commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(params.GraphicsCommandBuffer);
 
 		m_Width = 0;
 		m_Height = 0;
 		attachments.clear();
 
-		Ref<RenderTarget> renderTarget = ResourceManager::GetResource<RenderTarget>(m_RenderTarget);
+		RenderTarget* renderTarget = ResourceManager::GetResource<RenderTarget>(m_RenderTarget);
 		ResourceID colorTextureID = renderTarget->GetColorTexture();
 
 		int32_t colorAttachmentIndex = -1;
@@ -38,8 +38,8 @@ namespace Odyssey
 		if (colorTextureID.IsValid())
 		{
 			// Get the color texture and resolve (if it has one)
-			Ref<VulkanTexture> colorTexture = ResourceManager::GetResource<VulkanTexture>(colorTextureID);
-			Ref<VulkanImage> colorImage = ResourceManager::GetResource<VulkanImage>(colorTexture->GetImage());
+			VulkanTexture* colorTexture = ResourceManager::GetResource<VulkanTexture>(colorTextureID);
+			VulkanImage* colorImage = ResourceManager::GetResource<VulkanImage>(colorTexture->GetImage());
 			ResourceID colorResolveTextureID = renderTarget->GetColorResolveTexture();
 
 			// Set the w/h
@@ -52,7 +52,7 @@ namespace Odyssey
 			// Transition the resolve texture
 			if (colorResolveTextureID.IsValid())
 			{
-				Ref<VulkanTexture> resolveTexture = ResourceManager::GetResource<VulkanTexture>(colorResolveTextureID);
+				VulkanTexture* resolveTexture = ResourceManager::GetResource<VulkanTexture>(colorResolveTextureID);
 				commandBuffer->TransitionLayouts(resolveTexture->GetImage(), m_ColorAttachment.BeginLayout);
 			}
 
@@ -67,8 +67,8 @@ namespace Odyssey
 			// Set the resolve image, if valid
 			if (colorResolveTextureID.IsValid())
 			{
-				Ref<VulkanTexture> resolveTexture = ResourceManager::GetResource<VulkanTexture>(colorResolveTextureID);
-				Ref<VulkanImage> resolveImage = ResourceManager::GetResource<VulkanImage>(resolveTexture->GetImage());
+				VulkanTexture* resolveTexture = ResourceManager::GetResource<VulkanTexture>(colorResolveTextureID);
+				VulkanImage* resolveImage = ResourceManager::GetResource<VulkanImage>(resolveTexture->GetImage());
 
 				colorAttachmentInfo.resolveMode = VK_RESOLVE_MODE_AVERAGE_BIT;
 				colorAttachmentInfo.resolveImageView = resolveImage->GetImageView();
@@ -90,8 +90,8 @@ namespace Odyssey
 		if (depthTextureID.IsValid())
 		{
 			// Get the depth texture, resolve texture and images
-			Ref<VulkanTexture> depthTexture = ResourceManager::GetResource<VulkanTexture>(depthTextureID);
-			Ref<VulkanImage> depthImage = ResourceManager::GetResource<VulkanImage>(depthTexture->GetImage());
+			VulkanTexture* depthTexture = ResourceManager::GetResource<VulkanTexture>(depthTextureID);
+			VulkanImage* depthImage = ResourceManager::GetResource<VulkanImage>(depthTexture->GetImage());
 			ResourceID depthResolveTextureID = renderTarget->GetDepthResolveTexture();
 
 			// Set the w/h
@@ -105,7 +105,7 @@ namespace Odyssey
 			// Transition the resolve texture
 			if (depthResolveTextureID.IsValid())
 			{
-				Ref<VulkanTexture> resolveTexture = ResourceManager::GetResource<VulkanTexture>(depthResolveTextureID);
+				VulkanTexture* resolveTexture = ResourceManager::GetResource<VulkanTexture>(depthResolveTextureID);
 				commandBuffer->TransitionLayouts(resolveTexture->GetImage(), m_DepthAttachment.BeginLayout);
 			}
 
@@ -118,8 +118,8 @@ namespace Odyssey
 
 			if (depthResolveTextureID.IsValid())
 			{
-				Ref<VulkanTexture> resolveTexture = ResourceManager::GetResource<VulkanTexture>(depthResolveTextureID);
-				Ref<VulkanImage> resolveImage = ResourceManager::GetResource<VulkanImage>(resolveTexture->GetImage());
+				VulkanTexture* resolveTexture = ResourceManager::GetResource<VulkanTexture>(depthResolveTextureID);
+				VulkanImage* resolveImage = ResourceManager::GetResource<VulkanImage>(resolveTexture->GetImage());
 				depthAttachmentInfo.resolveMode = VK_RESOLVE_MODE_MIN_BIT;
 				depthAttachmentInfo.resolveImageView = resolveImage->GetImageView();
 				depthAttachmentInfo.resolveImageLayout = m_DepthAttachment.BeginLayout;
@@ -197,7 +197,7 @@ namespace Odyssey
 		RenderSubPassData subPassData;
 
 		// Begin rendering
-		Ref<VulkanCommandBuffer> commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(params.GraphicsCommandBuffer);
+		VulkanCommandBuffer* commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(params.GraphicsCommandBuffer);
 		commandBuffer->BeginRendering(m_RenderingInfo);
 
 		// Execute the subpasses
@@ -215,11 +215,11 @@ namespace Odyssey
 		// End dynamic rendering
 		commandBuffer->EndRendering();
 
-		Ref<RenderTarget> renderTarget = ResourceManager::GetResource<RenderTarget>(m_RenderTarget);
+		RenderTarget* renderTarget = ResourceManager::GetResource<RenderTarget>(m_RenderTarget);
 		ResourceID colorTextureID = renderTarget->GetColorTexture();
 
 		// Transition the to a shader resource layout
-		Ref<VulkanTexture> colorTexture = ResourceManager::GetResource<VulkanTexture>(colorTextureID);
+		VulkanTexture* colorTexture = ResourceManager::GetResource<VulkanTexture>(colorTextureID);
 		commandBuffer->TransitionLayouts(colorTexture->GetImage(), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
 
 		params.BRDFLutTexture = colorTextureID;
@@ -237,7 +237,7 @@ namespace Odyssey
 		m_ColorAttachment.StoreOp = VK_ATTACHMENT_STORE_OP_STORE;
 
 		// Create an off-screen render target matching a slice of the irradiance cubemap
-		Ref<VulkanTexture> irradianceTexture = ResourceManager::GetResource<VulkanTexture>(irradianceCubemap);
+		VulkanTexture* irradianceTexture = ResourceManager::GetResource<VulkanTexture>(irradianceCubemap);
 
 		VulkanImageDescription imageDesc;
 		imageDesc.ImageType = ImageType::RenderTexture;
@@ -292,8 +292,8 @@ namespace Odyssey
 		};
 
 		ResourceID commandBufferID = params.GraphicsCommandBuffer;
-		Ref<VulkanCommandBuffer> commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(commandBufferID);
-		Ref<VulkanTexture> irradianceCubemap = ResourceManager::GetResource<VulkanTexture>(m_IrradianceCubemap);
+		VulkanCommandBuffer* commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(commandBufferID);
+		VulkanTexture* irradianceCubemap = ResourceManager::GetResource<VulkanTexture>(m_IrradianceCubemap);
 
 		commandBuffer->TransitionLayouts(irradianceCubemap->GetImage(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
 
@@ -318,7 +318,7 @@ namespace Odyssey
 				data.MVP = captureProjection * captureViews[face];
 
 				ResourceID uboID = m_UBOs[counter];
-				Ref<VulkanBuffer> buffer = ResourceManager::GetResource<VulkanBuffer>(uboID);
+				VulkanBuffer* buffer = ResourceManager::GetResource<VulkanBuffer>(uboID);
 				buffer->CopyData(sizeof(IrradianceData), &data);
 				++counter;
 
@@ -335,14 +335,14 @@ namespace Odyssey
 				commandBuffer->PushDescriptorsGraphics(&m_PushDescriptors, m_Pipeline);
 
 				commandBuffer->BindVertexBuffer(m_CubeMesh->GetVertexBuffer());
-				commandBuffer->BindIndexBuffer(m_CubeMesh->GetIndexBuffer());
+				commandBuffer->BindIndexBuffer(m_CubeMesh->GetIndexBuffer(), m_CubeMesh->GetIndexType());
 				commandBuffer->DrawIndexed(m_CubeMesh->GetIndexCount(), 1, 0, 0, 0);
 
 				// end render pass
 				commandBuffer->EndRendering();
 
-				Ref<RenderTarget> renderTarget = ResourceManager::GetResource<RenderTarget>(m_RenderTarget);
-				Ref<VulkanTexture> colorTexture = ResourceManager::GetResource<VulkanTexture>(renderTarget->GetColorTexture());
+				RenderTarget* renderTarget = ResourceManager::GetResource<RenderTarget>(m_RenderTarget);
+				VulkanTexture* colorTexture = ResourceManager::GetResource<VulkanTexture>(renderTarget->GetColorTexture());
 
 				commandBuffer->CopyImageToImage(colorTexture->GetImage(), 0, 0,
 					irradianceCubemap->GetImage(), mip, face, viewport.width, viewport.height);
@@ -370,7 +370,7 @@ namespace Odyssey
 		m_ColorAttachment.StoreOp = VK_ATTACHMENT_STORE_OP_STORE;
 
 		// Create an off-screen render target matching a slice of the irradiance cubemap
-		Ref<VulkanTexture> cubemap = ResourceManager::GetResource<VulkanTexture>(prefilteredCubemap);
+		VulkanTexture* cubemap = ResourceManager::GetResource<VulkanTexture>(prefilteredCubemap);
 
 		VulkanImageDescription imageDesc;
 		imageDesc.ImageType = ImageType::RenderTexture;
@@ -425,8 +425,8 @@ namespace Odyssey
 		};
 
 		ResourceID commandBufferID = params.GraphicsCommandBuffer;
-		Ref<VulkanCommandBuffer> commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(commandBufferID);
-		Ref<VulkanTexture> prefilteredCubemap = ResourceManager::GetResource<VulkanTexture>(m_PrefilteredCubemap);
+		VulkanCommandBuffer* commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(commandBufferID);
+		VulkanTexture* prefilteredCubemap = ResourceManager::GetResource<VulkanTexture>(m_PrefilteredCubemap);
 
 		commandBuffer->TransitionLayouts(prefilteredCubemap->GetImage(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
 
@@ -452,7 +452,7 @@ namespace Odyssey
 				data.MVP = captureProjection * captureViews[face];
 
 				ResourceID uboID = m_UBOs[counter];
-				Ref<VulkanBuffer> buffer = ResourceManager::GetResource<VulkanBuffer>(uboID);
+				VulkanBuffer* buffer = ResourceManager::GetResource<VulkanBuffer>(uboID);
 				buffer->CopyData(sizeof(PrefilteredData), &data);
 				++counter;
 
@@ -469,14 +469,14 @@ namespace Odyssey
 				commandBuffer->PushDescriptorsGraphics(&m_PushDescriptors, m_Pipeline);
 
 				commandBuffer->BindVertexBuffer(m_CubeMesh->GetVertexBuffer());
-				commandBuffer->BindIndexBuffer(m_CubeMesh->GetIndexBuffer());
+				commandBuffer->BindIndexBuffer(m_CubeMesh->GetIndexBuffer(), m_CubeMesh->GetIndexType());
 				commandBuffer->DrawIndexed(m_CubeMesh->GetIndexCount(), 1, 0, 0, 0);
 
 				// end render pass
 				commandBuffer->EndRendering();
 
-				Ref<RenderTarget> renderTarget = ResourceManager::GetResource<RenderTarget>(m_RenderTarget);
-				Ref<VulkanTexture> colorTexture = ResourceManager::GetResource<VulkanTexture>(renderTarget->GetColorTexture());
+				RenderTarget* renderTarget = ResourceManager::GetResource<RenderTarget>(m_RenderTarget);
+				VulkanTexture* colorTexture = ResourceManager::GetResource<VulkanTexture>(renderTarget->GetColorTexture());
 
 				commandBuffer->CopyImageToImage(colorTexture->GetImage(), 0, 0,
 					prefilteredCubemap->GetImage(), mip, face, viewport.width, viewport.height);
@@ -529,7 +529,7 @@ namespace Odyssey
 	void DepthPass::Execute(RenderPassParams& params)
 	{
 		// Begin rendering
-		Ref<VulkanCommandBuffer> commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(params.GraphicsCommandBuffer);
+		VulkanCommandBuffer* commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(params.GraphicsCommandBuffer);
 		commandBuffer->BeginRendering(m_RenderingInfo);
 
 		if (params.renderingData->renderScene->SetPasses.size() == 0)
@@ -552,7 +552,7 @@ namespace Odyssey
 		// End dynamic rendering
 		commandBuffer->EndRendering();
 
-		Ref<RenderTarget> renderTarget = ResourceManager::GetResource<RenderTarget>(m_RenderTarget);
+		RenderTarget* renderTarget = ResourceManager::GetResource<RenderTarget>(m_RenderTarget);
 		ResourceID depthTextureID = renderTarget->GetDepthTexture();
 
 		// Make sure the RT is valid
@@ -563,7 +563,7 @@ namespace Odyssey
 		}
 
 		// Transition the shadowmap for use in the fragment shader
-		Ref<VulkanTexture> depthTexture = ResourceManager::GetResource<VulkanTexture>(depthTextureID);
+		VulkanTexture* depthTexture = ResourceManager::GetResource<VulkanTexture>(depthTextureID);
 		commandBuffer->TransitionLayouts(depthTexture->GetImage(), VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL);
 
 		params.DepthTextures[m_Camera] = depthTextureID;
@@ -618,7 +618,7 @@ namespace Odyssey
 		std::shared_ptr<RenderScene> renderScene = params.renderingData->renderScene;
 
 		// Begin the render pass
-		Ref<VulkanCommandBuffer> commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(params.GraphicsCommandBuffer);
+		VulkanCommandBuffer* commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(params.GraphicsCommandBuffer);
 		commandBuffer->BeginRendering(m_RenderingInfo);
 
 		// Don't render if our camera is invalid
@@ -647,7 +647,7 @@ namespace Odyssey
 		// End the render pass
 		commandBuffer->EndRendering();
 
-		Ref<RenderTarget> renderTarget = ResourceManager::GetResource<RenderTarget>(m_RenderTarget);
+		RenderTarget* renderTarget = ResourceManager::GetResource<RenderTarget>(m_RenderTarget);
 		ResourceID colorTextureID = renderTarget->GetColorTexture();
 
 		// Make sure the RT is valid
@@ -658,13 +658,13 @@ namespace Odyssey
 		}
 
 		// Transition the backbuffer layout for presenting
-		Ref<VulkanTexture> colorTexture = ResourceManager::GetResource<VulkanTexture>(colorTextureID);
+		VulkanTexture* colorTexture = ResourceManager::GetResource<VulkanTexture>(colorTextureID);
 		commandBuffer->TransitionLayouts(colorTexture->GetImage(), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
 
 		ResourceID colorResolveTextureID = renderTarget->GetColorResolveTexture();
 		if (colorResolveTextureID.IsValid())
 		{
-			Ref<VulkanTexture> resolveTexture = ResourceManager::GetResource<VulkanTexture>(colorResolveTextureID);
+			VulkanTexture* resolveTexture = ResourceManager::GetResource<VulkanTexture>(colorResolveTextureID);
 			commandBuffer->TransitionLayouts(resolveTexture->GetImage(), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
 		}
 
@@ -712,19 +712,19 @@ namespace Odyssey
 	void TransparentObjectsPass::BeginPass(RenderPassParams& params)
 	{
 		ResourceID commandBufferID = params.GraphicsCommandBuffer;
-		Ref<VulkanCommandBuffer> commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(commandBufferID);
+		VulkanCommandBuffer* commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(commandBufferID);
 
-		Ref<RenderTarget> renderTarget = ResourceManager::GetResource<RenderTarget>(m_RenderTarget);
+		RenderTarget* renderTarget = ResourceManager::GetResource<RenderTarget>(m_RenderTarget);
 		ResourceID colorTextureID = renderTarget->GetColorTexture();
 
 		// Extract the render target and width/height
 		if (colorTextureID.IsValid())
 		{
-			Ref<VulkanTexture> rtColorTexture = ResourceManager::GetResource<VulkanTexture>(colorTextureID);
+			VulkanTexture* rtColorTexture = ResourceManager::GetResource<VulkanTexture>(colorTextureID);
 
 			if (m_CameraColorTexture.IsValid())
 			{
-				Ref<VulkanTexture> cameraColorTexture = ResourceManager::GetResource<VulkanTexture>(m_CameraColorTexture);
+				VulkanTexture* cameraColorTexture = ResourceManager::GetResource<VulkanTexture>(m_CameraColorTexture);
 				if (cameraColorTexture->GetWidth() != rtColorTexture->GetWidth() || cameraColorTexture->GetHeight() != rtColorTexture->GetHeight())
 				{
 					ResourceManager::Destroy(m_CameraColorTexture);
@@ -743,13 +743,13 @@ namespace Odyssey
 				m_CameraColorTexture = ResourceManager::Allocate<VulkanTexture>(desc, nullptr);
 			}
 
-			Ref<VulkanTexture> cameraColorTexture = ResourceManager::GetResource<VulkanTexture>(m_CameraColorTexture);
+			VulkanTexture* cameraColorTexture = ResourceManager::GetResource<VulkanTexture>(m_CameraColorTexture);
 			ResourceID colorResolveTextureID = renderTarget->GetColorResolveTexture();
 
 			if (colorResolveTextureID.IsValid())
 			{
 				// Copy the resolve texture into the camera's color texture
-				Ref<VulkanTexture> resolveTexture = ResourceManager::GetResource<VulkanTexture>(colorResolveTextureID);
+				VulkanTexture* resolveTexture = ResourceManager::GetResource<VulkanTexture>(colorResolveTextureID);
 				resolveTexture->CopyToTexture(cameraColorTexture->GetImage());
 			}
 			else
@@ -770,7 +770,7 @@ namespace Odyssey
 		std::shared_ptr<RenderScene> renderScene = params.renderingData->renderScene;
 
 		// Begin rendering
-		Ref<VulkanCommandBuffer> commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(params.GraphicsCommandBuffer);
+		VulkanCommandBuffer* commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(params.GraphicsCommandBuffer);
 		commandBuffer->BeginRendering(m_RenderingInfo);
 
 		// Don't render with an invalid camera
@@ -800,7 +800,7 @@ namespace Odyssey
 		commandBuffer->EndRendering();
 
 		// Transition the color RT to the final layout
-		Ref<RenderTarget> renderTarget = ResourceManager::GetResource<RenderTarget>(m_RenderTarget);
+		RenderTarget* renderTarget = ResourceManager::GetResource<RenderTarget>(m_RenderTarget);
 		ResourceID colorTextureID = renderTarget->GetColorTexture();
 
 		// Make sure the RT is valid
@@ -811,13 +811,13 @@ namespace Odyssey
 		}
 
 		// Transition the backbuffer layout for presenting
-		Ref<VulkanTexture> colorTexture = ResourceManager::GetResource<VulkanTexture>(colorTextureID);
+		VulkanTexture* colorTexture = ResourceManager::GetResource<VulkanTexture>(colorTextureID);
 		commandBuffer->TransitionLayouts(colorTexture->GetImage(), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
 
 		ResourceID colorResolveTextureID = renderTarget->GetColorResolveTexture();
 		if (colorResolveTextureID.IsValid())
 		{
-			Ref<VulkanTexture> resolveTexture = ResourceManager::GetResource<VulkanTexture>(colorResolveTextureID);
+			VulkanTexture* resolveTexture = ResourceManager::GetResource<VulkanTexture>(colorResolveTextureID);
 			commandBuffer->TransitionLayouts(resolveTexture->GetImage(), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
 		}
 	}
@@ -840,7 +840,7 @@ namespace Odyssey
 
 	void ImguiPass::Execute(RenderPassParams& params)
 	{
-		Ref<VulkanCommandBuffer> commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(params.GraphicsCommandBuffer);
+		VulkanCommandBuffer* commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(params.GraphicsCommandBuffer);
 		commandBuffer->BeginRendering(m_RenderingInfo);
 		m_Imgui->Render(params.GraphicsCommandBuffer);
 	}
@@ -854,14 +854,14 @@ namespace Odyssey
 		commandBuffer->EndRendering();
 
 		// Transition the backbuffer layout for presenting
-		Ref<RenderTarget> renderTarget = ResourceManager::GetResource<RenderTarget>(params.FrameTexture);
-		Ref<VulkanTexture> colorTexture = ResourceManager::GetResource<VulkanTexture>(renderTarget->GetColorTexture());
+		RenderTarget* renderTarget = ResourceManager::GetResource<RenderTarget>(params.FrameTexture);
+		VulkanTexture* colorTexture = ResourceManager::GetResource<VulkanTexture>(renderTarget->GetColorTexture());
 		commandBuffer->TransitionLayouts(colorTexture->GetImage(), VK_IMAGE_LAYOUT_PRESENT_SRC_KHR);
 
 		ResourceID resolveTextureID = renderTarget->GetColorResolveTexture();
 		if (resolveTextureID.IsValid())
 		{
-			Ref<VulkanTexture> resolveTexture = ResourceManager::GetResource<VulkanTexture>(resolveTextureID);
+			VulkanTexture* resolveTexture = ResourceManager::GetResource<VulkanTexture>(resolveTextureID);
 			commandBuffer->TransitionLayouts(resolveTexture->GetImage(), VK_IMAGE_LAYOUT_PRESENT_SRC_KHR);
 		}
 	}
@@ -20,78 +20,45 @@
 #include "VulkanBuffer.h"
 #include "SceneManager.h"
 #include "SpriteRenderer.h"
+#include "FrameAllocator.h"
 
 namespace Odyssey
 {
-	RenderScene::RenderScene()
+	// Drawcalls sharing a key draw the same geometry and can be batched into one instanced draw
+	inline static auto GetSortKey(const Drawcall& drawcall)
 	{
-		// Camera uniform buffer
-		for (uint32_t i = 0; i < MAX_CAMERAS; i++)
-		{
-			// Allocate the UBO
-			ResourceID uboID = ResourceManager::Allocate<VulkanBuffer>(BufferType::Uniform, sizeof(SceneData));
-
-			// Write the camera data into the ubo memory
-			SceneData sceneData;
-			auto uniformBuffer = ResourceManager::GetResource<VulkanBuffer>(uboID);
-			uniformBuffer->CopyData(sizeof(SceneData), &sceneData);
-
-			sceneDataBuffers.push_back(uboID);
-		}
-
-		// Per-object uniform buffers
-		for (uint32_t i = 0; i < Max_Uniform_Buffers; i++)
-		{
-			// Allocate the UBO
-			ResourceID uboID = ResourceManager::Allocate<VulkanBuffer>(BufferType::Uniform, sizeof(ObjectUniformData));
-
-			// Write the per-object data into the ubo
-			ObjectUniformData objectData;
-			auto uniformBuffer = ResourceManager::GetResource<VulkanBuffer>(uboID);
-			uniformBuffer->CopyData(sizeof(ObjectUniformData), &objectData);
-
-			perObjectUniformBuffers.push_back(uboID);
-		}
-
-		// Skinning buffers
-		for (uint32_t i = 0; i < Max_Uniform_Buffers; i++)
-		{
-			// Allocate the UBO
-			ResourceID uboID = ResourceManager::Allocate<VulkanBuffer>(BufferType::Uniform, sizeof(SkinningData));
-
-			// Write the per-object data into the ubo
-			SkinningData skinningData;
-			auto uniformBuffer = ResourceManager::GetResource<VulkanBuffer>(uboID);
-			uniformBuffer->CopyData(sizeof(SkinningData), &skinningData);
+		return std::make_tuple((uint64_t)drawcall.VertexBufferID, (uint64_t)drawcall.IndexBufferID, drawcall.IndexCount, drawcall.Skinned);
+	}
 
-			skinningBuffers.push_back(uboID);
-		}
+	inline static bool CompareSortKeys(const Drawcall& a, const Drawcall& b)
+	{
+		return GetSortKey(a) < GetSortKey(b);
+	}
 
-		// Allocate the UBO
-		LightingBuffer = ResourceManager::Allocate<VulkanBuffer>(BufferType::Uniform, sizeof(LightingData));
+	RenderScene::RenderScene(std::shared_ptr<VulkanRingBuffer> uniformRing)
+		: m_UniformRing(uniformRing)
+	{
+		// Camera uniforms are written by ClearSceneData at the start of each frame
+		SceneDataBuffers.resize(MAX_CAMERAS);
 
-		// Write the per-object data into the ubo
-		LightingData lightingData;
-		auto uniformBuffer = ResourceManager::GetResource<VulkanBuffer>(LightingBuffer);
-		uniformBuffer->CopyData(sizeof(LightingData), &lightingData);
+		// Scene storage buffers
+		ReserveBuffer(ObjectBuffer, m_ObjectCapacity, Initial_Object_Capacity, sizeof(ObjectData));
+		ReserveBuffer(BoneBuffer, m_BoneCapacity, Initial_Object_Capacity, sizeof(glm::mat4));
+		ReserveBuffer(InstanceBuffer, m_InstanceCapacity, Initial_Object_Capacity, sizeof(uint32_t));
 	}
 
 	void RenderScene::Destroy()
 	{
-		for (auto& resource : sceneDataBuffers)
-		{
-			ResourceManager::Destroy(resource);
-		}
+		ReleaseProxies();
 
-		for (auto& resource : perObjectUniformBuffers)
-		{
-			ResourceManager::Destroy(resource);
-		}
+		ResourceManager::Destroy(ObjectBuffer);
+		ResourceManager::Destroy(BoneBuffer);
+		ResourceManager::Destroy(InstanceBuffer);
 	}
 
 	void RenderScene::ConvertScene(Scene* scene)
 	{
-		ClearSceneData();
+		ResetFrameData();
 
 		EnvironmentSettings envSettings = scene->GetEnvironmentSettings();
 		if (envSettings.Skybox)
@@ -129,11 +96,13 @@ namespace Odyssey
 
 		// Cache the shadow light view projection matrix
 		if (m_ShadowLight)
+		{
 			m_ShadowLightMatrix = Light::CalculateViewProj(envSettings.SceneCenter, envSettings.SceneRadius, m_ShadowLight->GetDirection());
+			m_ShadowFrustum = m_ShadowLight->GetShadowFrustum(envSettings.SceneCenter, envSettings.SceneRadius);
+		}
 
 		// Update the lighting ubo
-		auto lightingUBO = ResourceManager::GetResource<VulkanBuffer>(LightingBuffer);
-		lightingUBO->CopyData(sizeof(LightingData), &lightingData);
+		LightingBuffer = m_UniformRing->Write(lightingData);
 
 		// Search the scene for the main camera
 		for (auto entity : scene->GetAllEntitiesWith<Camera>())
@@ -153,11 +122,26 @@ namespace Odyssey
 
 	void RenderScene::ClearSceneData()
 	{
-		SetPasses.clear();
+		ResetFrameData();
+		ReleaseProxies();
+		m_Scene = nullptr;
+	}
+
+	void RenderScene::ResetFrameData()
+	{
 		SpriteDrawcalls.clear();
-		m_GUIDToSetPass.clear();
-		m_NextUniformBuffer = 0;
+		m_Bones.clear();
+		m_Instances.clear();
+		ModelDataBuffers.clear();
 		m_MainCamera = nullptr;
+		m_ShadowLight = nullptr;
+
+		// Last frame's allocations were reset with the ring, so every binding gets valid defaults again
+		RingAllocation defaultSceneData = m_UniformRing->Write(SceneData());
+		for (RingAllocation& sceneDataBuffer : SceneDataBuffers)
+			sceneDataBuffer = defaultSceneData;
+
+		LightingBuffer = m_UniformRing->Write(LightingData());
 	}
 
 	void RenderScene::SetSceneData(uint8_t cameraTag)
@@ -178,9 +162,8 @@ namespace Odyssey
 			if (m_ShadowLight)
 				sceneData.LightViewProj = m_ShadowLightMatrix;
 
-			// Update the scene ubo
-			Ref<VulkanBuffer> sceneUBO = ResourceManager::GetResource<VulkanBuffer>(sceneDataBuffers[cameraTag]);
-			sceneUBO->CopyData(sizeof(sceneData), &sceneData);
+			// Each call takes a new slot, passes recorded earlier in the frame keep the data they were given
+			SceneDataBuffers[cameraTag] = m_UniformRing->Write(sceneData);
 		}
 	}
 
@@ -194,109 +177,676 @@ namespace Odyssey
 
 	void RenderScene::SetupDrawcalls(Scene* scene)
 	{
-		for (auto entity : scene->GetAllEntitiesWith<MeshRenderer, Transform>())
+		UpdateProxies(scene);
+		RefreshSetPasses();
+		CheckMeshVersions();
+
+		if (m_DrawListsDirty)
+			BuildDrawLists();
+
+		UpdateSkinnedObjects(scene);
+		WriteModelData();
+
+		CullViews();
+		BuildInstances();
+		UploadObjectData();
+
+		for (auto entity : scene->GetAllEntitiesWith<SpriteRenderer, Transform>())
 		{
 			GameObject gameObject = GameObject(scene, entity);
-			MeshRenderer& meshRenderer = gameObject.GetComponent<MeshRenderer>();
+			SpriteRenderer& spriteRenderer = gameObject.GetComponent<SpriteRenderer>();
 			Transform& transform = gameObject.GetComponent<Transform>();
-			Animator* animator = gameObject.TryGetComponent<Animator>();
 
-			std::vector<Ref<Material>>& materials = meshRenderer.GetMaterials();
-			Ref<Mesh> mesh = meshRenderer.GetMesh();
+			if (spriteRenderer.IsEnabled())
+			{
+				SpriteDrawcall& drawcall = SpriteDrawcalls.emplace_back();
+				drawcall.Anchor = spriteRenderer.GetAnchor();
+				drawcall.Position = transform.GetPosition();
+				drawcall.Scale = transform.GetScale();
+				drawcall.Fill = spriteRenderer.GetFill();
+				drawcall.BaseColor = spriteRenderer.GetBaseColor();
+
+				if (spriteRenderer.GetSprite())
+					drawcall.Sprite = spriteRenderer.GetSprite()->GetTexture();
+			}
+		}
+	}
 
-			if (!meshRenderer.IsEnabled() || materials.size() == 0 || !mesh)
-				continue;
+	void RenderScene::UpdateProxies(Scene* scene)
+	{
+		RenderChangeLog& changeLog = scene->GetRenderChanges();
+
+		// Another scene, or changes we missed, means converting the whole scene again
+		if (scene != m_Scene || changeLog.GetID() != m_ChangeLogID || !changeLog.Read(m_ChangeCursor, m_Changes))
+		{
+			m_Scene = scene;
+			m_ChangeLogID = changeLog.GetID();
+			changeLog.Skip(m_ChangeCursor);
+			m_Changes.clear();
+
+			RebuildProxies(scene);
+			return;
+		}
+
+		// The log only holds an entity once between reads, but the reads of other render scenes fall in between
+		std::sort(m_Changes.begin(), m_Changes.end());
+		m_Changes.erase(std::unique(m_Changes.begin(), m_Changes.end()), m_Changes.end());
+
+		for (entt::entity entity : m_Changes)
+			RefreshProxy(scene, entity);
+
+		m_Changes.clear();
+	}
+
+	void RenderScene::RebuildProxies(Scene* scene)
+	{
+		ReleaseProxies();
+
+		for (auto entity : scene->GetAllEntitiesWith<MeshRenderer, Transform>())
+			RefreshProxy(scene, entity);
+	}
+
+	void RenderScene::RefreshProxy(Scene* scene, entt::entity entity)
+	{
+		GameObject gameObject = GameObject(scene, entity);
+		MeshRenderer* meshRenderer = gameObject.IsValid() ? gameObject.TryGetComponent<MeshRenderer>() : nullptr;
+		Transform* transform = gameObject.IsValid() ? gameObject.TryGetComponent<Transform>() : nullptr;
+
+		bool renderable = meshRenderer && transform && meshRenderer->IsEnabled() &&
+			meshRenderer->GetMaterials().size() > 0 && meshRenderer->GetMesh();
+
+		auto iter = m_EntityToProxy.find(entity);
+		if (!renderable)
+		{
+			if (iter != m_EntityToProxy.end())
+				RemoveProxy(iter->second);
 
-			uint32_t uboIndex = m_NextUniformBuffer++;
+			return;
+		}
+
+		uint32_t proxyIndex = 0;
+		if (iter != m_EntityToProxy.end())
+		{
+			proxyIndex = iter->second;
+		}
+		else
+		{
+			proxyIndex = (uint32_t)m_Proxies.size();
+			m_EntityToProxy[entity] = proxyIndex;
+
+			RenderProxy& proxy = m_Proxies.emplace_back();
+			proxy.Entity = entity;
+			proxy.ObjectIndex = AllocateObject();
+		}
+
+		RenderProxy& proxy = m_Proxies[proxyIndex];
+		Ref<Mesh> mesh = meshRenderer->GetMesh();
+		std::vector<Ref<Material>>& materials = meshRenderer->GetMaterials();
+		bool skinned = gameObject.TryGetComponent<Animator>() != nullptr;
+
+		// Anything that changes which set passes draw the object moves its drawcalls, a new proxy has none yet
+		bool drawsChanged = proxy.SourceMesh != mesh || proxy.Materials != materials || proxy.Skinned != skinned;
+		if (drawsChanged)
+		{
+			if (!m_DrawListsDirty)
+				RemoveDraws(proxyIndex);
+
+			proxy.SourceMesh = mesh;
+			proxy.Materials = materials;
+			proxy.Skinned = skinned;
+		}
+
+		ObjectData objectData = m_Objects[proxy.ObjectIndex];
+		objectData.World = transform->GetWorldMatrix();
+
+		bool moved = SetObjectData(proxy.ObjectIndex, objectData);
+		UpdateObjectBounds(proxy.ObjectIndex, mesh.Get(), objectData.World, moved);
+
+		// Draw lists being rebuilt this frame pick the proxy up from there
+		if (m_DrawListsDirty)
+			return;
+
+		if (drawsChanged)
+		{
+			AddDraws(proxyIndex, true);
+		}
+		else if (moved && !proxy.Skinned)
+		{
+			// Kept drawcalls only need the moved boxes written into their culling slots
+			std::vector<BoundingBox>& submeshBounds = m_ObjectBounds[proxy.ObjectIndex].Submeshes;
+			for (uint32_t i = 0; i < proxy.BoundsCount; i++)
+				m_DrawBounds.Set(proxy.FirstBounds + i, submeshBounds[i]);
+		}
+	}
+
+	void RenderScene::RemoveProxy(uint32_t proxyIndex)
+	{
+		if (!m_DrawListsDirty)
+			RemoveDraws(proxyIndex);
+
+		RenderProxy& proxy = m_Proxies[proxyIndex];
+		m_FreeObjects.push_back(proxy.ObjectIndex);
+		m_EntityToProxy.erase(proxy.Entity);
+
+		uint32_t lastIndex = (uint32_t)m_Proxies.size() - 1;
+		if (proxyIndex != lastIndex)
+		{
+			proxy = std::move(m_Proxies.back());
+			m_EntityToProxy[proxy.Entity] = proxyIndex;
 
-			for (size_t i = 0; i < materials.size(); i++)
+			if (proxy.Skinned)
+				std::replace(m_SkinnedProxies.begin(), m_SkinnedProxies.end(), lastIndex, proxyIndex);
+		}
+
+		m_Proxies.pop_back();
+	}
+
+	void RenderScene::ReleaseProxies()
+	{
+		for (RenderProxy& proxy : m_Proxies)
+			m_FreeObjects.push_back(proxy.ObjectIndex);
+
+		m_Proxies.clear();
+		m_EntityToProxy.clear();
+
+		// Keep the per-queue vectors so their capacity carries over to the rebuild
+		for (auto& [renderQueue, setPasses] : SetPasses)
+			setPasses.clear();
+
+		m_DrawBounds.Clear();
+		m_SetPassIndices.clear();
+		m_SkinnedProxies.clear();
+		m_ModelDataObjects.clear();
+		m_FreeModelData.clear();
+		m_MeshVersions.clear();
+		m_FreeBounds = 0;
+		m_DrawListsDirty = true;
+	}
+
+	void RenderScene::RefreshSetPasses()
+	{
+		for (auto& [renderQueue, setPasses] : SetPasses)
+		{
+			for (SetPass& setPass : setPasses)
 			{
-				if (!materials[i] || materials[i]->GetGUID() == 0)
-					continue;
+				Ref<Material> material = setPass.SourceMaterial;
 
-				RenderQueue renderQueue = materials[i]->GetRenderQueue();
-				std::vector<SetPass>& setPasses = SetPasses[renderQueue];
+				if (setPass.MaterialVersion != material->GetVersion())
+				{
+					bool instanced = setPass.IsInstanced();
+					setPass.SetMaterial(material);
 
-				if (SubMesh* submesh = mesh->GetSubmesh(i))
+					// The set pass belongs in another queue, or its drawcalls need per-object uniforms now
+					if (setPass.RenderQueue != renderQueue || setPass.IsInstanced() != instanced)
+						m_DrawListsDirty = true;
+				}
+				else
 				{
-					GUID materialGUID = materials[i]->GetGUID();
-					SetPass* setPass = nullptr;
+					// A remade pipeline or edited properties still show up without a new version
+					setPass.GraphicsPipeline = material->GetPipeline();
+					setPass.MaterialBuffer = material->GetMaterialBuffer();
+				}
+			}
+		}
+	}
 
-					if (m_GUIDToSetPass.contains(materialGUID))
-					{
-						size_t index = m_GUIDToSetPass[materialGUID];
-						setPass = &setPasses[index];
-					}
-					else
-					{
-						size_t index = setPasses.size();
-						setPass = &setPasses.emplace_back();
+	void RenderScene::CheckMeshVersions()
+	{
+		// A mesh leaves the map with the last proxy drawing it, so every entry is still held by a proxy
+		if (m_DrawListsDirty)
+			return;
 
-						m_GUIDToSetPass[materialGUID] = index;
+		for (auto& [mesh, usage] : m_MeshVersions)
+		{
+			if (mesh->GetVersion() != usage.Version)
+			{
+				m_DrawListsDirty = true;
+				return;
+			}
+		}
+	}
 
-						setPass->SetMaterial(materials[i], animator != nullptr);
-					}
+	void RenderScene::BuildDrawLists()
+	{
+		for (auto& [renderQueue, setPasses] : SetPasses)
+			setPasses.clear();
+
+		m_DrawBounds.Clear();
+		m_SetPassIndices.clear();
+		m_SkinnedProxies.clear();
+		m_ModelDataObjects.clear();
+		m_FreeModelData.clear();
+		m_MeshVersions.clear();
+		m_FreeBounds = 0;
+
+		for (uint32_t proxyIndex = 0; proxyIndex < m_Proxies.size(); proxyIndex++)
+			AddDraws(proxyIndex, false);
+
+		// Group the drawcalls sharing the same geometry once, batching then only walks the lists
+		for (auto& [renderQueue, setPasses] : SetPasses)
+		{
+			for (SetPass& setPass : setPasses)
+			{
+				if (setPass.IsInstanced())
+					std::stable_sort(setPass.Drawcalls.begin(), setPass.Drawcalls.end(), CompareSortKeys);
+			}
+		}
 
-					// Create the drawcall data
-					Drawcall& drawcall = setPass->Drawcalls.emplace_back();
-					drawcall.VertexBufferID = submesh->VertexBuffer;
-					drawcall.IndexBufferID = submesh->IndexBuffer;
-					drawcall.IndexCount = submesh->IndexCount;
-					drawcall.UniformBufferIndex = uboIndex;
-					drawcall.Skinned = animator != nullptr;
-				}
+		m_DrawListsDirty = false;
+	}
+
+	void RenderScene::AddDraws(uint32_t proxyIndex, bool sorted)
+	{
+		RenderProxy& proxy = m_Proxies[proxyIndex];
+		Mesh* mesh = proxy.SourceMesh.Get();
+
+		UpdateObjectBounds(proxy.ObjectIndex, mesh, m_Objects[proxy.ObjectIndex].World, false);
+
+		// A mesh already drawn keeps the version it was first drawn with, so an edit still rebuilds every proxy using it
+		MeshUsage& usage = m_MeshVersions[mesh];
+		if (usage.Proxies++ == 0)
+			usage.Version = mesh->GetVersion();
+
+		if (proxy.Skinned)
+			m_SkinnedProxies.push_back(proxyIndex);
+
+		// Skinned vertices can leave the bind pose bounds, so they are never culled
+		std::vector<BoundingBox>& submeshBounds = m_ObjectBounds[proxy.ObjectIndex].Submeshes;
+		proxy.FirstBounds = (uint32_t)m_DrawBounds.Size();
+		proxy.BoundsCount = (uint32_t)submeshBounds.size();
+
+		for (BoundingBox& bounds : submeshBounds)
+			m_DrawBounds.Add(proxy.Skinned ? BoundingBox::Infinite() : bounds);
+
+		// Only assigned for set passes that can't be instanced
+		proxy.ModelDataIndex = UINT32_MAX;
+
+		for (size_t i = 0; i < proxy.Materials.size(); i++)
+		{
+			Ref<Material>& material = proxy.Materials[i];
+			if (!material || material->GetGUID() == 0)
+				continue;
+
+			SubMesh* submesh = mesh->GetSubmesh(i);
+			if (!submesh)
+				continue;
+
+			SetPass* setPass = nullptr;
+
+			auto iter = m_SetPassIndices.find(material->GetGUID());
+			if (iter != m_SetPassIndices.end())
+			{
+				auto [renderQueue, setPassIndex] = iter->second;
+				setPass = &SetPasses[renderQueue][setPassIndex];
+			}
+			else
+			{
+				std::vector<SetPass>& setPasses = SetPasses[material->GetRenderQueue()];
+				m_SetPassIndices[material->GetGUID()] = { material->GetRenderQueue(), setPasses.size() };
+				setPass = &setPasses.emplace_back();
+				setPass->SetMaterial(material);
 			}
 
-			// Update the per-object uniform buffer
-			ObjectUniformData objectData;
-			uint32_t perObjectSize = sizeof(objectData);
-			objectData.world = transform.GetWorldMatrix();
+			// Create the drawcall data
+			Drawcall drawcall;
+			drawcall.VertexBufferID = submesh->VertexBuffer;
+			drawcall.IndexBufferID = submesh->IndexBuffer;
+			drawcall.IndexCount = submesh->IndexCount;
+			drawcall.IndexFormat = submesh->IndexFormat;
+			drawcall.ObjectIndex = proxy.ObjectIndex;
+			drawcall.Skinned = proxy.Skinned;
+			drawcall.BoundsIndex = proxy.FirstBounds + (uint32_t)i;
 
-			ResourceID uboID = perObjectUniformBuffers[uboIndex];
-			auto uniformBuffer = ResourceManager::GetResource<VulkanBuffer>(uboID);
-			uniformBuffer->CopyData(perObjectSize, &objectData);
+			std::vector<Drawcall>& drawcalls = setPass->Drawcalls;
 
-			if (animator)
+			if (!setPass->IsInstanced())
 			{
-				// Update the skinning buffer
-				SkinningData skinningData;
-				skinningData.SetBindposes(animator->GetFinalPoses());
+				if (proxy.ModelDataIndex == UINT32_MAX)
+					proxy.ModelDataIndex = AllocateModelData(proxy.ObjectIndex);
 
-				ResourceID skinningID = skinningBuffers[uboIndex];
-				auto skinningBuffer = ResourceManager::GetResource<VulkanBuffer>(skinningID);
-				skinningBuffer->CopyData(sizeof(SkinningData), &skinningData);
+				drawcall.UniformBufferIndex = proxy.ModelDataIndex;
+				drawcalls.push_back(drawcall);
+			}
+			else if (sorted)
+			{
+				// After the drawcalls with the same key, the same place a stable sort would put it
+				drawcalls.insert(std::upper_bound(drawcalls.begin(), drawcalls.end(), drawcall, CompareSortKeys), drawcall);
+			}
+			else
+			{
+				drawcalls.push_back(drawcall);
 			}
 		}
+	}
 
-		for (auto entity : scene->GetAllEntitiesWith<SpriteRenderer, Transform>())
+	void RenderScene::RemoveDraws(uint32_t proxyIndex)
+	{
+		RenderProxy& proxy = m_Proxies[proxyIndex];
+		Mesh* mesh = proxy.SourceMesh.Get();
+
+		// A new proxy hasn't been drawn yet
+		if (!mesh)
+			return;
+
+		auto usage = m_MeshVersions.find(mesh);
+		if (usage != m_MeshVersions.end() && --usage->second.Proxies == 0)
+			m_MeshVersions.erase(usage);
+
+		if (proxy.Skinned)
+			std::erase(m_SkinnedProxies, proxyIndex);
+
+		// Erasing keeps the order, so the instanced set passes stay sorted
+		for (Ref<Material>& material : proxy.Materials)
 		{
-			GameObject gameObject = GameObject(scene, entity);
-			SpriteRenderer& spriteRenderer = gameObject.GetComponent<SpriteRenderer>();
-			Transform& transform = gameObject.GetComponent<Transform>();
+			if (!material || material->GetGUID() == 0)
+				continue;
 
-			if (spriteRenderer.IsEnabled())
+			auto iter = m_SetPassIndices.find(material->GetGUID());
+			if (iter == m_SetPassIndices.end())
+				continue;
+
+			auto [renderQueue, setPassIndex] = iter->second;
+			std::erase_if(SetPasses[renderQueue][setPassIndex].Drawcalls, [&proxy](const Drawcall& drawcall) { return drawcall.ObjectIndex == proxy.ObjectIndex; });
+		}
+
+		if (proxy.ModelDataIndex != UINT32_MAX)
+		{
+			m_FreeModelData.push_back(proxy.ModelDataIndex);
+			proxy.ModelDataIndex = UINT32_MAX;
+		}
+
+		// Invalid bounds are rejected by every frustum, so the old slots are simply left behind
+		for (uint32_t i = 0; i < proxy.BoundsCount; i++)
+			m_DrawBounds.Set(proxy.FirstBounds + i, BoundingBox());
+
+		m_FreeBounds += proxy.BoundsCount;
+		proxy.BoundsCount = 0;
+
+		if (m_FreeBounds * 2 > m_DrawBounds.Size())
+			m_DrawListsDirty = true;
+	}
+
+	uint32_t RenderScene::AllocateModelData(uint32_t objectIndex)
+	{
+		uint32_t index = 0;
+
+		if (m_FreeModelData.size() > 0)
+		{
+			index = m_FreeModelData.back();
+			m_FreeModelData.pop_back();
+			m_ModelDataObjects[index] = objectIndex;
+		}
+		else
+		{
+			index = (uint32_t)m_ModelDataObjects.size();
+			m_ModelDataObjects.push_back(objectIndex);
+		}
+
+		return index;
+	}
+
+	void RenderScene::UpdateSkinnedObjects(Scene* scene)
+	{
+		// Poses change every frame, so each skinned object appends its pose to the shared bone buffer
+		for (uint32_t proxyIndex : m_SkinnedProxies)
+		{
+			RenderProxy& proxy = m_Proxies[proxyIndex];
+			GameObject gameObject = GameObject(scene, proxy.Entity);
+
+			ObjectData objectData = m_Objects[proxy.ObjectIndex];
+			objectData.BoneOffset = (uint32_t)m_Bones.size();
+
+			Animator* animator = gameObject.TryGetComponent<Animator>();
+			if (animator && animator->GetFinalPoses().size() > 0)
 			{
-				SpriteDrawcall& drawcall = SpriteDrawcalls.emplace_back();
-				drawcall.Anchor = spriteRenderer.GetAnchor();
-				drawcall.Position = transform.GetPosition();
-				drawcall.Scale = transform.GetScale();
-				drawcall.Fill = spriteRenderer.GetFill();
-				drawcall.BaseColor = spriteRenderer.GetBaseColor();
+				const std::vector<glm::mat4>& poses = animator->GetFinalPoses();
+				m_Bones.insert(m_Bones.end(), poses.begin(), poses.end());
+			}
+			else
+			{
+				m_Bones.resize(m_Bones.size() + Max_Bones, glm::identity<mat4>());
+			}
 
-				if (spriteRenderer.GetSprite())
-					drawcall.Sprite = spriteRenderer.GetSprite()->GetTexture();
+			SetObjectData(proxy.ObjectIndex, objectData);
+		}
+	}
+
+	void RenderScene::WriteModelData()
+	{
+		// Ring allocations only last a frame, so objects on shaders that read ModelData are written every frame
+		for (uint32_t objectIndex : m_ModelDataObjects)
+		{
+			ObjectUniformData uniformData;
+			uniformData.world = m_Objects[objectIndex].World;
+			ModelDataBuffers.push_back(m_UniformRing->Write(uniformData));
+		}
+	}
+
+	uint32_t RenderScene::AllocateObject()
+	{
+		uint32_t index = 0;
+
+		if (m_FreeObjects.size() > 0)
+		{
+			index = m_FreeObjects.back();
+			m_FreeObjects.pop_back();
+		}
+		else
+		{
+			index = (uint32_t)m_Objects.size();
+			m_Objects.emplace_back();
+			m_ObjectBounds.emplace_back();
+		}
+
+		// The slot may hold bounds from a previous entity
+		m_ObjectBounds[index].Source = nullptr;
+
+		// Force the new slot to upload regardless of the stale data
+		m_DirtyBegin = std::min(m_DirtyBegin, index);
+		m_DirtyEnd = std::max(m_DirtyEnd, index + 1);
+		return index;
+	}
+
+	bool RenderScene::SetObjectData(uint32_t index, const ObjectData& objectData)
+	{
+		if (m_Objects[index] == objectData)
+			return false;
+
+		m_Objects[index] = objectData;
+		m_DirtyBegin = std::min(m_DirtyBegin, index);
+		m_DirtyEnd = std::max(m_DirtyEnd, index + 1);
+		return true;
+	}
+
+	void RenderScene::UpdateObjectBounds(uint32_t index, Mesh* mesh, const mat4& world, bool moved)
+	{
+		ObjectBounds& objectBounds = m_ObjectBounds[index];
+		if (!moved && objectBounds.Source == mesh && objectBounds.Version == mesh->GetVersion())
+			return;
+
+		objectBounds.Source = mesh;
+		objectBounds.Version = mesh->GetVersion();
+		objectBounds.Submeshes.resize(mesh->GetSubmeshCount());
+
+		for (size_t i = 0; i < objectBounds.Submeshes.size(); i++)
+		{
+			// Empty submeshes keep invalid bounds, which every frustum rejects
+			BoundingBox& localBounds = mesh->GetSubmesh(i)->Bounds;
+			objectBounds.Submeshes[i] = localBounds.IsValid() ? localBounds.Transform(world) : BoundingBox();
+		}
+	}
+
+	void RenderScene::CullViews()
+	{
+		m_DrawVisibility.assign(m_DrawBounds.Size(), 0);
+		m_ActiveViews = 0;
+
+		// The shadow pass runs without a shadow light too, so nothing is culled from it
+		if (m_ShadowLight)
+		{
+			CullView(0, m_ShadowFrustum);
+		}
+		else
+		{
+			for (uint16_t& visibility : m_DrawVisibility)
+				visibility |= 1;
+
+			m_ActiveViews |= 1;
+		}
+
+		for (auto& [cameraTag, camera] : m_Cameras)
+		{
+			if (cameraTag > 0 && cameraTag < MAX_CAMERAS)
+				CullView(cameraTag, camera->GetFrustum());
+		}
+	}
+
+	void RenderScene::CullView(uint8_t view, const Frustum& frustum)
+	{
+		m_VisibleDraws.clear();
+		frustum.Cull(m_DrawBounds, m_VisibleDraws);
+
+		uint16_t viewBit = (uint16_t)(1 << view);
+		for (uint32_t index : m_VisibleDraws)
+			m_DrawVisibility[index] |= viewBit;
+
+		m_ActiveViews |= viewBit;
+	}
+
+	void RenderScene::BuildInstances()
+	{
+		for (auto& [renderQueue, setPasses] : SetPasses)
+		{
+			for (SetPass& setPass : setPasses)
+			{
+				bool instanced = setPass.IsInstanced();
+				setPass.ViewDrawcalls.resize(MAX_CAMERAS);
+
+				// Each view gets its own range of the instance buffer holding only what it can see
+				for (uint8_t view = 0; view < MAX_CAMERAS; view++)
+				{
+					std::vector<Drawcall>& batches = setPass.ViewDrawcalls[view];
+					batches.clear();
+
+					uint16_t viewBit = (uint16_t)(1 << view);
+					if ((m_ActiveViews & viewBit) == 0)
+						continue;
+
+					for (Drawcall& drawcall : setPass.Drawcalls)
+					{
+						if ((m_DrawVisibility[drawcall.BoundsIndex] & viewBit) == 0)
+							continue;
+
+						// Non-instanced drawcalls still get an instance so the depth pass can read the object buffer
+						if (!instanced || batches.size() == 0 || GetSortKey(batches.back()) != GetSortKey(drawcall))
+						{
+							Drawcall& batch = batches.emplace_back(drawcall);
+							batch.FirstInstance = (uint32_t)m_Instances.size();
+							batch.InstanceCount = 0;
+						}
+
+						batches.back().InstanceCount++;
+						m_Instances.push_back(drawcall.ObjectIndex);
+					}
+				}
 			}
 		}
 	}
 
-	void SetPass::SetMaterial(Ref<Material> material, bool skinned)
+	void RenderScene::UploadObjectData()
+	{
+		// A new buffer has none of the old slots, re-upload them all
+		if (ReserveBuffer(ObjectBuffer, m_ObjectCapacity, m_Objects.size(), sizeof(ObjectData)))
+		{
+			m_DirtyBegin = 0;
+			m_DirtyEnd = (uint32_t)m_Objects.size();
+		}
+
+		// Upload the dirty range of the object buffer
+		if (m_DirtyBegin < m_DirtyEnd)
+		{
+			auto objectBuffer = ResourceManager::GetResource<VulkanBuffer>(ObjectBuffer);
+			size_t offset = m_DirtyBegin * sizeof(ObjectData);
+			size_t size = (m_DirtyEnd - m_DirtyBegin) * sizeof(ObjectData);
+			objectBuffer->CopyData(size, &m_Objects[m_DirtyBegin], offset);
+
+			m_DirtyBegin = UINT32_MAX;
+			m_DirtyEnd = 0;
+		}
+
+		// Bones and instances change every frame
+		ReserveBuffer(BoneBuffer, m_BoneCapacity, m_Bones.size(), sizeof(glm::mat4));
+		if (m_Bones.size() > 0)
+		{
+			auto boneBuffer = ResourceManager::GetResource<VulkanBuffer>(BoneBuffer);
+			boneBuffer->CopyData(m_Bones.size() * sizeof(glm::mat4), m_Bones.data());
+		}
+
+		ReserveBuffer(InstanceBuffer, m_InstanceCapacity, m_Instances.size(), sizeof(uint32_t));
+		if (m_Instances.size() > 0)
+		{
+			auto instanceBuffer = ResourceManager::GetResource<VulkanBuffer>(InstanceBuffer);
+			instanceBuffer->CopyData(m_Instances.size() * sizeof(uint32_t), m_Instances.data());
+		}
+	}
+
+	bool RenderScene::ReserveBuffer(ResourceID& buffer, uint32_t& capacity, size_t count, size_t stride)
+	{
+		if (buffer.IsValid() && count <= capacity)
+			return false;
+
+		// Grow geometrically so the buffers settle after a few frames
+		uint32_t newCapacity = std::max(capacity * 2, Initial_Object_Capacity);
+		while (newCapacity < count)
+			newCapacity *= 2;
+
+		if (buffer.IsValid())
+			ResourceManager::Destroy(buffer);
+
+		buffer = ResourceManager::Allocate<VulkanBuffer>(BufferType::Storage, newCapacity * stride);
+		capacity = newCapacity;
+		return true;
+	}
+
+	void SetPass::SetMaterial(Ref<Material> material)
 	{
-		Shaders = material->GetShader()->GetResourceMap();
+		SourceMaterial = material;
+		MaterialVersion = material->GetVersion();
+		Bindings = SetPassBindings();
+
 		GraphicsPipeline = material->GetPipeline();
 
+		// Resolve the binding indices once instead of looking them up per drawcall
+		std::map<std::string, ShaderBinding>& shaderBindings = material->GetShader()->GetBindings();
+
+		auto getIndex = [&shaderBindings](const std::string& name)
+			{
+				auto iter = shaderBindings.find(name);
+				return iter != shaderBindings.end() ? (int32_t)iter->second.Index : -1;
+			};
+
+		Bindings.SceneData = getIndex("SceneData");
+		Bindings.ObjectBuffer = getIndex("ObjectBuffer");
+		Bindings.BoneBuffer = getIndex("BoneBuffer");
+		Bindings.InstanceBuffer = getIndex("InstanceBuffer");
+		Bindings.ModelData = getIndex("ModelData");
+		Bindings.GlobalData = getIndex("GlobalData");
+		Bindings.LightData = getIndex("LightData");
+		Bindings.MaterialData = getIndex("MaterialData");
+		Bindings.CameraColor = getIndex("cameraColorSampler");
+		Bindings.BRDFLut = getIndex("brdfLutSampler");
+		Bindings.Irradiance = getIndex("IrradianceSampler");
+		Bindings.Prefiltered = getIndex("PrefilteredSampler");
+		Bindings.Shadowmap = getIndex("shadowmapSampler");
+		Bindings.Depth = getIndex("depthSampler");
+
 		// Textures
-		ShaderBindings = material->GetShader()->GetBindings();
-		Textures = material->GetTextures();
+		for (auto& [propertyName, texture] : material->GetTextures())
+		{
+			int32_t index = getIndex(propertyName);
+			if (index >= 0 && texture)
+				Bindings.Textures.push_back({ (uint32_t)index, texture });
+		}
 
 		// Store the material buffer for binding
 		MaterialBuffer = material->GetMaterialBuffer();
@@ -37,7 +37,7 @@ namespace Odyssey
 
 	void BRDFLutSubPass::Execute(RenderPassParams& params, RenderSubPassData& subPassData)
 	{
-		Ref<VulkanCommandBuffer> commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(params.GraphicsCommandBuffer);
+		VulkanCommandBuffer* commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(params.GraphicsCommandBuffer);
 		commandBuffer->BindGraphicsPipeline(m_Pipeline);
 		commandBuffer->Draw(3, 1, 0, 0);
 	}
@@ -48,9 +48,6 @@ namespace Odyssey
 		m_Shader = AssetManager::LoadAsset<Shader>(Shader_GUID);
 		m_SkinnedShader = AssetManager::LoadAsset<Shader>(Skinned_Shader_GUID);
 
-		// Allocate the UBO
-		m_DepthUBO = ResourceManager::Allocate<VulkanBuffer>(BufferType::Uniform, sizeof(glm::mat4));
-
 		// Non-skinned pipeline
 		{
 			VulkanPipelineInfo info;
@@ -84,7 +81,7 @@ namespace Odyssey
 
 	void DepthSubPass::Execute(RenderPassParams& params, RenderSubPassData& subPassData)
 	{
-		Ref<VulkanCommandBuffer> commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(params.GraphicsCommandBuffer);
+		VulkanCommandBuffer* commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(params.GraphicsCommandBuffer);
 		auto renderScene = params.renderingData->renderScene;
 
 		mat4 depthMatrix = renderScene->GetShadowLightMatrix();
@@ -97,66 +94,61 @@ namespace Odyssey
 		}
 
 		// Update the ubo
-		Ref<VulkanBuffer> depthUbo = ResourceManager::GetResource<VulkanBuffer>(m_DepthUBO);
-		depthUbo->CopyData(sizeof(mat4), &depthMatrix);
+		RingAllocation depthUBO = renderScene->GetUniformRing()->Write(depthMatrix);
+
+		// Every drawcall reads its objects through the instance buffer, so the descriptors only change with the pipeline
+		m_PushDescriptors->Clear();
+		m_PushDescriptors->AddBuffer(depthUBO, 0);
+		m_PushDescriptors->AddBuffer(renderScene->ObjectBuffer, Object_Buffer_Binding);
+		m_PushDescriptors->AddBuffer(renderScene->BoneBuffer, Bone_Buffer_Binding);
+		m_PushDescriptors->AddBuffer(renderScene->InstanceBuffer, Instance_Buffer_Binding);
+
+		commandBuffer->SetDepthBias(-1.0f, 0.0f, -1.25f);
+
+		// Skinned
+		commandBuffer->BindGraphicsPipeline(m_SkinnedPipeline);
+		commandBuffer->PushDescriptorsGraphics(m_PushDescriptors.Get(), m_SkinnedPipeline);
 
 		for (SetPass& setPass : renderScene->SetPasses[RenderQueue::Opaque])
 		{
 			if (!setPass.WriteDepth)
 				continue;
 
-			// Skinned
-			for (size_t i = 0; i < setPass.Drawcalls.size(); i++)
+			for (Drawcall& drawcall : setPass.GetDrawcalls(subPassData.CameraTag))
 			{
-				Drawcall& drawcall = setPass.Drawcalls[i];
-
 				// Skip non-skinned drawcalls
 				if (!drawcall.Skinned)
 					continue;
 
-				// Add the camera and per object data to the push descriptors
-				uint32_t uboIndex = drawcall.UniformBufferIndex;
-				m_PushDescriptors->Clear();
-				m_PushDescriptors->AddBuffer(m_DepthUBO, 0);
-				m_PushDescriptors->AddBuffer(renderScene->perObjectUniformBuffers[uboIndex], 1);
-				m_PushDescriptors->AddBuffer(renderScene->skinningBuffers[uboIndex], 2);
+				commandBuffer->BindVertexBuffer(drawcall.VertexBufferID);
+				commandBuffer->BindIndexBuffer(drawcall.IndexBufferID, drawcall.IndexFormat);
+				commandBuffer->DrawIndexed(drawcall.IndexCount, drawcall.InstanceCount, 0, 0, drawcall.FirstInstance);
+			}
+		}
 
-				commandBuffer->SetDepthBias(-1.0f, 0.0f, -1.25f);
+		// Non-skinned
+		m_PushDescriptors->Clear();
+		m_PushDescriptors->AddBuffer(depthUBO, 0);
+		m_PushDescriptors->AddBuffer(renderScene->ObjectBuffer, Object_Buffer_Binding);
+		m_PushDescriptors->AddBuffer(renderScene->InstanceBuffer, Instance_Buffer_Binding);
 
-				commandBuffer->BindGraphicsPipeline(m_SkinnedPipeline);
-				commandBuffer->PushDescriptorsGraphics(m_PushDescriptors.Get(), m_SkinnedPipeline);
+		commandBuffer->BindGraphicsPipeline(m_Pipeline);
+		commandBuffer->PushDescriptorsGraphics(m_PushDescriptors.Get(), m_Pipeline);
 
-				// Set the per-object descriptor buffer offset
-				commandBuffer->BindVertexBuffer(drawcall.VertexBufferID);
-				commandBuffer->BindIndexBuffer(drawcall.IndexBufferID);
-				commandBuffer->DrawIndexed(drawcall.IndexCount, 1, 0, 0, 0);
-			}
+		for (SetPass& setPass : renderScene->SetPasses[RenderQueue::Opaque])
+		{
+			if (!setPass.WriteDepth)
+				continue;
 
-			// Non-skinned
-			for (size_t i = 0; i < setPass.Drawcalls.size(); i++)
+			for (Drawcall& drawcall : setPass.GetDrawcalls(subPassData.CameraTag))
 			{
-				Drawcall& drawcall = setPass.Drawcalls[i];
-
 				// Skip skinned drawcalls
 				if (drawcall.Skinned)
 					continue;
 
-				// Add the camera and per object data to the push descriptors
-				uint32_t uboIndex = drawcall.UniformBufferIndex;
-				m_PushDescriptors->Clear();
-				m_PushDescriptors->AddBuffer(m_DepthUBO, 0);
-				m_PushDescriptors->AddBuffer(renderScene->perObjectUniformBuffers[uboIndex], 1);
-
-				commandBuffer->SetDepthBias(-1.0f, 0.0f, -1.25f);
-
-				// Push the descriptors into the command buffer
-				commandBuffer->BindGraphicsPipeline(m_Pipeline);
-				commandBuffer->PushDescriptorsGraphics(m_PushDescriptors.Get(), m_Pipeline);
-
-				// Set the per-object descriptor buffer offset
 				commandBuffer->BindVertexBuffer(drawcall.VertexBufferID);
-				commandBuffer->BindIndexBuffer(drawcall.IndexBufferID);
-				commandBuffer->DrawIndexed(drawcall.IndexCount, 1, 0, 0, 0);
+				commandBuffer->BindIndexBuffer(drawcall.IndexBufferID, drawcall.IndexFormat);
+				commandBuffer->DrawIndexed(drawcall.IndexCount, drawcall.InstanceCount, 0, 0, drawcall.FirstInstance);
 			}
 		}
 	}
@@ -170,7 +162,6 @@ namespace Odyssey
 	{
 		m_PushDescriptors = new VulkanPushDescriptors();
 
-		m_GlobalDataUBO = ResourceManager::Allocate<VulkanBuffer>(BufferType::Uniform, sizeof(GlobalData));
 		m_BlackTexture = AssetManager::LoadAsset<Texture2D>(s_BlackTextureGUID);
 		m_BlackTextureID = m_BlackTexture->GetTexture();
 
@@ -184,9 +175,9 @@ namespace Odyssey
 		auto renderScene = params.renderingData->renderScene;
 		renderScene->SetSceneData(subPassData.CameraTag);
 
+		GlobalData globalData = {};
 		if (Camera* camera = renderScene->GetCamera(subPassData.CameraTag))
 		{
-			GlobalData globalData;
 			if (Renderer::ReverseDepthEnabled())
 			{
 				//{ f/n - 1,   1, (1/n - 1/f), 1/f }
@@ -220,110 +211,84 @@ namespace Odyssey
 			globalData.Time.y = Time::Elapsed();
 			globalData.Time.z = Time::Elapsed() * 2.0f;
 			globalData.Time.w = Time::Elapsed() * 3.0f;
-
-			Ref<VulkanBuffer> ubo = ResourceManager::GetResource<VulkanBuffer>(m_GlobalDataUBO);
-			ubo->CopyData(sizeof(GlobalData), &globalData);
 		}
 
+		RingAllocation globalDataUBO = renderScene->GetUniformRing()->Write(globalData);
+
 		for (SetPass& setPass : params.renderingData->renderScene->SetPasses[m_RenderQueue])
 		{
-			commandBuffer->BindGraphicsPipeline(setPass.GraphicsPipeline);
-
-			for (size_t i = 0; i < setPass.Drawcalls.size(); i++)
-			{
-				Drawcall& drawcall = setPass.Drawcalls[i];
+			// Everything in the set pass was culled for this camera
+			std::vector<Drawcall>& drawcalls = setPass.GetDrawcalls(subPassData.CameraTag);
+			if (drawcalls.size() == 0)
+				continue;
 
-				// Add the camera and per object data to the push descriptors
-				uint32_t uboIndex = drawcall.UniformBufferIndex;
-				m_PushDescriptors->Clear();
+			SetPassBindings& bindings = setPass.Bindings;
 
-				if (setPass.ShaderBindings.contains("SceneData"))
-				{
-					uint32_t index = setPass.ShaderBindings["SceneData"].Index;
-					m_PushDescriptors->AddBuffer(renderScene->sceneDataBuffers[subPassData.CameraTag], index);
-				}
-				if (setPass.ShaderBindings.contains("ModelData"))
-				{
-					uint32_t index = setPass.ShaderBindings["ModelData"].Index;
-					m_PushDescriptors->AddBuffer(renderScene->perObjectUniformBuffers[uboIndex], index);
-				}
-				if (setPass.ShaderBindings.contains("SkinningData"))
-				{
-					uint32_t index = setPass.ShaderBindings["SkinningData"].Index;
-					m_PushDescriptors->AddBuffer(renderScene->skinningBuffers[uboIndex], 2);
-				}
-				if (setPass.ShaderBindings.contains("GlobalData"))
-				{
-					uint32_t index = setPass.ShaderBindings["GlobalData"].Index;
-					m_PushDescriptors->AddBuffer(m_GlobalDataUBO, index);
-				}
-				if (setPass.ShaderBindings.contains("LightData"))
-				{
-					uint32_t index = setPass.ShaderBindings["LightData"].Index;
-					m_PushDescriptors->AddBuffer(renderScene->LightingBuffer, index);
-				}
+			commandBuffer->BindGraphicsPipeline(setPass.GraphicsPipeline);
+			commandBuffer->SetDepthBias(-1.0f, 0.0f, -1.25f);
 
-				if (setPass.ShaderBindings.contains("cameraColorSampler") && params.ColorTextures[subPassData.CameraTag].IsValid())
-				{
-					uint32_t index = setPass.ShaderBindings["cameraColorSampler"].Index;
-					m_PushDescriptors->AddTexture(params.ColorTextures[subPassData.CameraTag], index);
-				}
+			// Add the set pass data to the push descriptors
+			m_PushDescriptors->Clear();
 
-				if (setPass.ShaderBindings.contains("brdfLutSampler") && params.BRDFLutTexture.IsValid())
-				{
-					uint32_t index = setPass.ShaderBindings["brdfLutSampler"].Index;
-					m_PushDescriptors->AddTexture(params.BRDFLutTexture, index);
-				}
-				if (setPass.ShaderBindings.contains("IrradianceSampler") && params.IrradianceTexture.IsValid())
-				{
-					uint32_t index = setPass.ShaderBindings["IrradianceSampler"].Index;
-					m_PushDescriptors->AddTexture(params.IrradianceTexture, index);
-				}
-				if (setPass.ShaderBindings.contains("PrefilteredSampler") && params.PrefilteredCubemap.IsValid())
-				{
-					uint32_t index = setPass.ShaderBindings["PrefilteredSampler"].Index;
-					m_PushDescriptors->AddTexture(params.PrefilteredCubemap, index);
-				}
-				if (setPass.MaterialBuffer.IsValid())
-				{
-					uint32_t index = setPass.ShaderBindings["MaterialData"].Index;
-					m_PushDescriptors->AddBuffer(setPass.MaterialBuffer, index);
-				}
+			if (bindings.SceneData >= 0)
+				m_PushDescriptors->AddBuffer(renderScene->SceneDataBuffers[subPassData.CameraTag], bindings.SceneData);
+			if (bindings.ObjectBuffer >= 0)
+				m_PushDescriptors->AddBuffer(renderScene->ObjectBuffer, bindings.ObjectBuffer);
+			if (bindings.BoneBuffer >= 0)
+				m_PushDescriptors->AddBuffer(renderScene->BoneBuffer, bindings.BoneBuffer);
+			if (bindings.InstanceBuffer >= 0)
+				m_PushDescriptors->AddBuffer(renderScene->InstanceBuffer, bindings.InstanceBuffer);
+			if (bindings.GlobalData >= 0)
+				m_PushDescriptors->AddBuffer(globalDataUBO, bindings.GlobalData);
+			if (bindings.LightData >= 0)
+				m_PushDescriptors->AddBuffer(renderScene->LightingBuffer, bindings.LightData);
+			if (bindings.MaterialData >= 0 && setPass.MaterialBuffer.IsValid())
+				m_PushDescriptors->AddBuffer(setPass.MaterialBuffer, bindings.MaterialData);
+
+			if (bindings.CameraColor >= 0 && params.ColorTextures[subPassData.CameraTag].IsValid())
+				m_PushDescriptors->AddTexture(params.ColorTextures[subPassData.CameraTag], bindings.CameraColor);
+			if (bindings.BRDFLut >= 0 && params.BRDFLutTexture.IsValid())
+				m_PushDescriptors->AddTexture(params.BRDFLutTexture, bindings.BRDFLut);
+			if (bindings.Irradiance >= 0 && params.IrradianceTexture.IsValid())
+				m_PushDescriptors->AddTexture(params.IrradianceTexture, bindings.Irradiance);
+			if (bindings.Prefiltered >= 0 && params.PrefilteredCubemap.IsValid())
+				m_PushDescriptors->AddTexture(params.PrefilteredCubemap, bindings.Prefiltered);
+
+			// Add the texture assets for the set pass
+			for (auto& [index, texture] : bindings.Textures)
+				m_PushDescriptors->AddTexture(texture->GetTexture(), index);
+
+			// Add the built-in engine textures for the set pass
+			if (bindings.Shadowmap >= 0)
+				m_PushDescriptors->AddTexture(params.Shadowmap(), bindings.Shadowmap);
+			if (bindings.Depth >= 0)
+				m_PushDescriptors->AddTexture(params.DepthTextures[subPassData.CameraTag], bindings.Depth);
+
+			if (setPass.IsInstanced())
+			{
+				// Push the descriptors once for every batch in the set pass
+				commandBuffer->PushDescriptorsGraphics(m_PushDescriptors.Get(), setPass.GraphicsPipeline);
 
-				// Add the texture assets for the set pass
-				for (auto& [propertyName, texture] : setPass.Textures)
+				for (Drawcall& drawcall : drawcalls)
 				{
-					if (setPass.ShaderBindings.contains(propertyName))
-					{
-						uint32_t index = setPass.ShaderBindings[propertyName].Index;
-						m_PushDescriptors->AddTexture(texture->GetTexture(), index);
-					}
+					commandBuffer->BindVertexBuffer(drawcall.VertexBufferID);
+					commandBuffer->BindIndexBuffer(drawcall.IndexBufferID, drawcall.IndexFormat);
+					commandBuffer->DrawIndexed(drawcall.IndexCount, drawcall.InstanceCount, 0, 0, drawcall.FirstInstance);
 				}
-
-				// Add the built-in engine textures for the set pass
-				if (setPass.ShaderBindings.contains("shadowmapSampler"))
+			}
+			else
+			{
+				// Shaders reading ModelData need the per-object uniform buffer pushed for every drawcall
+				for (Drawcall& drawcall : drawcalls)
 				{
-					uint32_t index = setPass.ShaderBindings["shadowmapSampler"].Index;
-					m_PushDescriptors->AddTexture(params.Shadowmap(), index);
-				}
+					m_PushDescriptors->AddBuffer(renderScene->ModelDataBuffers[drawcall.UniformBufferIndex], bindings.ModelData);
+					commandBuffer->PushDescriptorsGraphics(m_PushDescriptors.Get(), setPass.GraphicsPipeline);
+					m_PushDescriptors->RemoveLast();
 
-				// Add the built-in engine textures for the set pass
-				if (setPass.ShaderBindings.contains("depthSampler"))
-				{
-					ResourceID cameraDepthTexture = params.DepthTextures[subPassData.CameraTag];
-					uint32_t index = setPass.ShaderBindings["depthSampler"].Index;
-					m_PushDescriptors->AddTexture(cameraDepthTexture, index);
+					commandBuffer->BindVertexBuffer(drawcall.VertexBufferID);
+					commandBuffer->BindIndexBuffer(drawcall.IndexBufferID, drawcall.IndexFormat);
+					commandBuffer->DrawIndexed(drawcall.IndexCount, 1, 0, 0, 0);
 				}
-
-				commandBuffer->SetDepthBias(-1.0f, 0.0f, -1.25f);
-
-				// Push the descriptors into the command buffer
-				commandBuffer->PushDescriptorsGraphics(m_PushDescriptors.Get(), setPass.GraphicsPipeline);
-
-				// Set the per-object descriptor buffer offset
-				commandBuffer->BindVertexBuffer(drawcall.VertexBufferID);
-				commandBuffer->BindIndexBuffer(drawcall.IndexBufferID);
-				commandBuffer->DrawIndexed(drawcall.IndexCount, 1, 0, 0, 0);
 			}
 		}
 	}
@@ -353,7 +318,7 @@ namespace Odyssey
 		// Push the camera descriptors
 		auto renderScene = params.renderingData->renderScene;
 		m_PushDescriptors->Clear();
-		m_PushDescriptors->AddBuffer(renderScene->sceneDataBuffers[subPassData.CameraTag], 0);
+		m_PushDescriptors->AddBuffer(renderScene->SceneDataBuffers[subPassData.CameraTag], 0);
 
 		// Push the descriptors into the command buffer
 		commandBuffer->PushDescriptorsGraphics(m_PushDescriptors.Get(), m_GraphicsPipeline);
@@ -378,14 +343,6 @@ namespace Odyssey
 		m_PushDescriptors = new VulkanPushDescriptors();
 
 		m_CubeMesh = AssetManager::LoadAsset<Mesh>(s_CubeMeshGUID);
-
-		// Allocate the UBO
-		uboID = ResourceManager::Allocate<VulkanBuffer>(BufferType::Uniform, sizeof(glm::mat4));
-
-		// Write the camera data into the ubo memory
-		auto uniformBuffer = ResourceManager::GetResource<VulkanBuffer>(uboID);
-		glm::mat4 identity = glm::mat4(1.0f);
-		uniformBuffer->CopyData(sizeof(glm::mat4), &identity);
 	}
 
 	void SkyboxSubPass::Execute(RenderPassParams& params, RenderSubPassData& subPassData)
@@ -400,8 +357,7 @@ namespace Odyssey
 		float3 viewPos = renderScene->GetCamera(subPassData.CameraTag)->GetViewPosition();
 		glm::mat4 posOnly = glm::translate(glm::mat4(1.0f), viewPos);
 
-		auto uniformBuffer = ResourceManager::GetResource<VulkanBuffer>(uboID);
-		uniformBuffer->CopyData(sizeof(glm::mat4), &posOnly);
+		RingAllocation modelUBO = renderScene->GetUniformRing()->Write(posOnly);
 
 		// Bind our graphics pipeline
 		commandBuffer->BindGraphicsPipeline(m_GraphicsPipeline);
@@ -410,10 +366,10 @@ namespace Odyssey
 
 		uint32_t index = 0;
 		if (m_Shader->HasBinding("SceneData", index))
-			m_PushDescriptors->AddBuffer(renderScene->sceneDataBuffers[subPassData.CameraTag], index);
+			m_PushDescriptors->AddBuffer(renderScene->SceneDataBuffers[subPassData.CameraTag], index);
 
 		if (m_Shader->HasBinding("ModelData", index))
-			m_PushDescriptors->AddBuffer(uboID, index);
+			m_PushDescriptors->AddBuffer(modelUBO, index);
 
 		if (m_Shader->HasBinding("LightData", index))
 			m_PushDescriptors->AddBuffer(renderScene->LightingBuffer, index);
@@ -425,7 +381,7 @@ namespace Odyssey
 		commandBuffer->PushDescriptorsGraphics(m_PushDescriptors.Get(), m_GraphicsPipeline);
 
 		commandBuffer->BindVertexBuffer(m_CubeMesh->GetVertexBuffer());
-		commandBuffer->BindIndexBuffer(m_CubeMesh->GetIndexBuffer());
+		commandBuffer->BindIndexBuffer(m_CubeMesh->GetIndexBuffer(), m_CubeMesh->GetIndexType());
 		commandBuffer->DrawIndexed(m_CubeMesh->GetIndexCount(), 1, 0, 0, 0);
 	}
 
@@ -447,7 +403,7 @@ namespace Odyssey
 
 	void ParticleSubPass::Execute(RenderPassParams& params, RenderSubPassData& subPassData)
 	{
-		Ref<VulkanCommandBuffer> graphicsCommandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(params.GraphicsCommandBuffer);
+		VulkanCommandBuffer* graphicsCommandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(params.GraphicsCommandBuffer);
 		auto renderScene = params.renderingData->renderScene;
 		renderScene->SetSceneData(subPassData.CameraTag);
 
@@ -461,7 +417,7 @@ namespace Odyssey
 			GUID materialGUID = ParticleBatcher::GetMaterial(index);
 
 			m_PushDescriptors->Clear();
-			m_PushDescriptors->AddBuffer(renderScene->sceneDataBuffers[subPassData.CameraTag], 0);
+			m_PushDescriptors->AddBuffer(renderScene->SceneDataBuffers[subPassData.CameraTag], 0);
 			m_PushDescriptors->AddBuffer(particleBuffer, 2);
 			m_PushDescriptors->AddBuffer(aliveBuffer, 4);
 
@@ -492,9 +448,6 @@ namespace Odyssey
 
 	void Opaque2DSubPass::Setup()
 	{
-		for (size_t i = 0; i < Max_Supported_Sprites; i++)
-			m_SpriteDataUBO[i] = ResourceManager::Allocate<VulkanBuffer>(BufferType::Uniform, sizeof(SpriteData));
-
 		m_Shader = AssetManager::LoadAsset<Shader>(Shader_GUID);
 		m_Shader->AddOnModifiedListener([this]() { OnSpriteShaderModified(); });
 
@@ -513,10 +466,9 @@ namespace Odyssey
 	{
 		auto renderScene = params.renderingData->renderScene;
 
-		Ref<VulkanCommandBuffer> commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(params.GraphicsCommandBuffer);
+		VulkanCommandBuffer* commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(params.GraphicsCommandBuffer);
 		Camera* camera = renderScene->GetCamera(subPassData.CameraTag);
 
-		assert(renderScene->SpriteDrawcalls.size() < Max_Supported_Sprites);
 		assert(camera);
 
 		mat4 orthoProjection = camera->GetScreenSpaceProjection();
@@ -543,15 +495,14 @@ namespace Odyssey
 			spriteData.Projection = orthoProjection;
 
 			// Update the sprite ubo
-			Ref<VulkanBuffer> uniformBuffer = ResourceManager::GetResource<VulkanBuffer>(m_SpriteDataUBO[i]);
-			uniformBuffer->CopyData(sizeof(SpriteData), &spriteData);
+			RingAllocation spriteUBO = renderScene->GetUniformRing()->Write(spriteData);
 
 			// Set the pipeline
 			commandBuffer->BindGraphicsPipeline(m_GraphicsPipeline);
 
 			// Push the descriptors
 			m_PushDescriptors->Clear();
-			m_PushDescriptors->AddBuffer(m_SpriteDataUBO[i], 0);
+			m_PushDescriptors->AddBuffer(spriteUBO, 0);
 
 			if (spriteDrawcall.Sprite.IsValid())
 				m_PushDescriptors->AddTexture(spriteDrawcall.Sprite, 1);
@@ -561,7 +512,7 @@ namespace Odyssey
 			// Bind the buffers and draw
 			// TODO: Convert this into instanced rendering
 			commandBuffer->BindVertexBuffer(m_QuadMesh->GetVertexBuffer());
-			commandBuffer->BindIndexBuffer(m_QuadMesh->GetIndexBuffer());
+			commandBuffer->BindIndexBuffer(m_QuadMesh->GetIndexBuffer(), m_QuadMesh->GetIndexType());
 			commandBuffer->DrawIndexed(m_QuadMesh->GetIndexCount(), 1, 0, 0, 0);
 		}
 	}
@@ -54,7 +54,7 @@ namespace Odyssey
 		{
 			if (context->GetSampleCount() > 1)
 			{
-				Ref<VulkanImage> image = ResourceManager::GetResource<VulkanImage>(imageID);
+				VulkanImage* image = ResourceManager::GetResource<VulkanImage>(imageID);
 				VulkanImageDescription desc;
 				desc.ImageType = ImageType::RenderTexture;
 				desc.Width = image->GetWidth();
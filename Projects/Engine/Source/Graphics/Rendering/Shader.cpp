@@ -5,6 +5,7 @@
 #include "AssetManager.h"
 #include "SourceShader.h"
 #include "VulkanDescriptorLayout.h"
+#include "ShaderCache.h"
 #include "spirv_cross/spirv_reflect.hpp"
 #include "Vertex.h"
 
@@ -27,34 +28,141 @@ namespace Odyssey
 		SetSourceAsset(source->GetGUID());
 	}
 
+	Shader::~Shader()
+	{
+		std::erase(s_ModifiedShaders, this);
+	}
+
 	void Shader::Recompile()
 	{
-		if (m_Source)
+		RecompileBatch({ this });
+	}
+
+	struct Shader::CompiledStage
+	{
+	public:
+		size_t Source = 0;
+		ShaderType ShaderType;
+		uint64_t CacheKey = 0;
+		BinaryBuffer CodeBuffer;
+		ShaderReflection Reflection;
+		bool Valid = false;
+	};
+
+	void Shader::RecompileBatch(const std::vector<Shader*>& shaders)
+	{
+		std::vector<SourceShader*> sources;
+		for (Shader* shader : shaders)
+			sources.push_back(shader->m_Source.Get());
+
+		std::vector<CompiledStage> stages;
+		CompileStages(sources, stages);
+
+		for (size_t i = 0; i < shaders.size(); i++)
 		{
-			m_Shaders.clear();
+			Shader* shader = shaders[i];
+			if (!shader->m_Source)
+				continue;
 
-			std::vector<ShaderType> shaderTypes = m_Source->GetShaderTypes();
+			shader->m_Shaders.clear();
+			std::map<ShaderType, ShaderReflection> reflections;
 
-			for (ShaderType shaderType : shaderTypes)
+			for (CompiledStage& stage : stages)
 			{
-				BinaryBuffer tempBuffer;
-				auto& shaderData = m_Shaders[shaderType];
+				if (stage.Source != i || !stage.Valid)
+					continue;
 
-				// Compile the shader
-				if (m_Source->Compile(shaderType, tempBuffer))
-				{
-					// Destroy the previous shader module, if loaded
-					if (shaderData.ShaderModule)
-						ResourceManager::Destroy(shaderData.ShaderModule);
+				auto& shaderData = shader->m_Shaders[stage.ShaderType];
+
+				// Load a new shader module with the updated code
+				shaderData.CodeBuffer = stage.CodeBuffer;
+				shaderData.ShaderModule = ResourceManager::Allocate<VulkanShaderModule>(stage.ShaderType, shaderData.CodeBuffer);
+				reflections[stage.ShaderType] = stage.Reflection;
+			}
+
+			// Generate the shader resources from the reflection data
+			shader->GenerateShaderResources(reflections);
+		}
+	}
+
+	uint32_t Shader::Precompile(const std::vector<SourceShader*>& sources, uint32_t& stageCount)
+	{
+		std::vector<CompiledStage> stages;
+		uint32_t hits = CompileStages(sources, stages);
+		stageCount = (uint32_t)stages.size();
+		return hits;
+	}
+
+	uint32_t Shader::CompileStages(const std::vector<SourceShader*>& sources, std::vector<CompiledStage>& stages)
+	{
+		std::vector<ShaderCompiler::CompilerSettings> compileSettings;
+		std::vector<size_t> compileStages;
+
+		for (size_t i = 0; i < sources.size(); i++)
+		{
+			SourceShader* source = sources[i];
+			if (!source)
+				continue;
+
+			for (ShaderType shaderType : source->GetShaderTypes())
+			{
+				ShaderCompiler::CompilerSettings settings;
+				if (!source->GetCompilerSettings(shaderType, settings))
+					continue;
 
-					// Load a new shader module with the updated code
-					shaderData.CodeBuffer = tempBuffer;
-					shaderData.ShaderModule = ResourceManager::Allocate<VulkanShaderModule>(shaderType, shaderData.CodeBuffer);
+				CompiledStage& stage = stages.emplace_back();
+				stage.Source = i;
+				stage.ShaderType = shaderType;
+				stage.CacheKey = ShaderCache::GenerateKey(settings);
+
+				// Cache hits skip both the compiler and the reflection
+				stage.Valid = ShaderCache::Load(stage.CacheKey, stage.CodeBuffer, stage.Reflection);
+
+				if (!stage.Valid)
+				{
+					compileSettings.push_back(settings);
+					compileStages.push_back(stages.size() - 1);
 				}
 			}
+		}
+
+		// Compile the cache misses of every shader at once
+		std::vector<ShaderCompiler::Result> results = ShaderCompiler::CompileBatch(compileSettings);
+
+		for (size_t i = 0; i < results.size(); i++)
+		{
+			if (!results[i].Success)
+				continue;
 
-			// Reflect the shader code and generate the shader resources
-			GenerateShaderResources();
+			CompiledStage& stage = stages[compileStages[i]];
+			stage.CodeBuffer = results[i].CodeBuffer;
+			stage.Valid = true;
+
+			ReflectShader(stage.ShaderType, stage.CodeBuffer, stage.Reflection);
+			ShaderCache::Save(stage.CacheKey, stage.CodeBuffer, stage.Reflection);
+		}
+
+		return (uint32_t)(stages.size() - compileStages.size());
+	}
+
+	void Shader::ProcessModifiedShaders()
+	{
+		if (s_ModifiedShaders.size() == 0)
+			return;
+
+		// Take the list first since listeners may modify other shaders
+		std::vector<Shader*> shaders;
+		shaders.swap(s_ModifiedShaders);
+
+		for (Shader* shader : shaders)
+			shader->DestroyShaderModules();
+
+		RecompileBatch(shaders);
+
+		for (Shader* shader : shaders)
+		{
+			shader->LoadMaterialDefaults();
+			shader->NotifyModified();
 		}
 	}
 
@@ -114,6 +222,13 @@ namespace Odyssey
 	}
 
 	void Shader::LoadFromSource(Ref<SourceShader> source)
+	{
+		DestroyShaderModules();
+		Recompile();
+		LoadMaterialDefaults();
+	}
+
+	void Shader::DestroyShaderModules()
 	{
 		// Clear any existing shaders
 		for (auto& [shaderType, shaderData] : m_Shaders)
@@ -121,9 +236,12 @@ namespace Odyssey
 			shaderData.CodeBuffer.Clear();
 			ResourceManager::Destroy(shaderData.ShaderModule);
 		}
+	}
 
-		Recompile();
-		LoadMaterialDefaults();
+	void Shader::NotifyModified()
+	{
+		for (Listener& listener : m_OnModifiedListeners)
+			listener.Callback();
 	}
 
 	void Shader::SaveToDisk(const Path& path)
@@ -320,7 +438,7 @@ namespace Odyssey
 		return VK_FORMAT_R32G32B32A32_SFLOAT;
 	}
 
-	void Shader::GenerateShaderResources()
+	void Shader::GenerateShaderResources(std::map<ShaderType, ShaderReflection>& reflections)
 	{
 		// Destroy the previous layout, if it exists
 		if (m_DescriptorLayout)
@@ -330,170 +448,179 @@ namespace Odyssey
 
 		// Create a new layout
 		m_DescriptorLayout = ResourceManager::Allocate<VulkanDescriptorLayout>();
-		Ref<VulkanDescriptorLayout> descriptorLayout = ResourceManager::GetResource<VulkanDescriptorLayout>(m_DescriptorLayout);
+		VulkanDescriptorLayout* descriptorLayout = ResourceManager::GetResource<VulkanDescriptorLayout>(m_DescriptorLayout);
 
-		for (auto& [shaderType, shaderData] : m_Shaders)
+		for (auto& [shaderType, reflection] : reflections)
 		{
-			// Parse the spirv code so it can be reflected
-			spirv_cross::CompilerReflection refl(shaderData.CodeBuffer.Convert<uint32_t>());
-			spirv_cross::ShaderResources resources = refl.get_shader_resources();
+			if (reflection.VertexAttributes)
+				m_VertexAttributes = reflection.VertexAttributes;
 
-			if (shaderType == ShaderType::Vertex)
-			{
-				// BUild vertex attribute descriptions from the inputs
-				std::vector<VkVertexInputAttributeDescription> descriptions;
+			// Set the material properties into the data
+			if (reflection.MaterialProperties.size() > 0 && m_MaterialBufferData.Properties.size() == 0)
+				m_MaterialBufferData.Set(reflection.MaterialProperties, reflection.MaterialBufferSize);
 
-				for (size_t i = 0; i < resources.stage_inputs.size(); i++)
+			// Bindings shared between stages are only added once
+			for (ShaderBinding& binding : reflection.Bindings)
+			{
+				if (!m_Bindings.contains(binding.Name))
 				{
-					spirv_cross::Resource& input = resources.stage_inputs[i];
-					spirv_cross::SPIRType inputType = refl.get_type(input.type_id);
-					std::string inputName = Odyssey::ToLower(input.name);
-
-					std::string inputTag = "input.";
-					size_t inputPos = inputName.find("input.");
-					if (inputPos != std::string::npos)
-						inputName = inputName.substr(inputPos + inputTag.length());
-
-					VkVertexInputAttributeDescription& inputDesc = descriptions.emplace_back();
-					inputDesc.binding = 0;
-					inputDesc.location = (uint32_t)i;
-					inputDesc.format = GetVertexFormat(inputType);
-					inputDesc.offset = Vertex::GetOffset(inputName);
+					m_Bindings[binding.Name] = binding;
+					descriptorLayout->AddBinding(binding.Name, binding.DescriptorType, binding.Index);
 				}
-
-				if (descriptions.size() > 0)
-					m_VertexAttributes.WriteData(descriptions);
 			}
+		}
 
-			// Reflect texture sampler bindings
-			for (spirv_cross::Resource& resource : resources.sampled_images)
-			{
-				std::string name = refl.get_name(resource.base_type_id);
-				uint32_t set = refl.get_decoration(resource.id, spv::DecorationDescriptorSet);
-				uint32_t binding = refl.get_decoration(resource.id, spv::DecorationBinding);
+		descriptorLayout->Apply();
+	}
 
-				if (!m_Bindings.contains(name))
-				{
-					ShaderBinding& bindingData = m_Bindings[name];
-					bindingData.Name = name;
-					bindingData.DescriptorType = DescriptorType::Sampler;
-					bindingData.Index = binding;
+	void Shader::ReflectShader(ShaderType shaderType, BinaryBuffer& codeBuffer, ShaderReflection& reflection)
+	{
+		// Parse the spirv code so it can be reflected
+		spirv_cross::CompilerReflection refl(codeBuffer.Convert<uint32_t>());
+		spirv_cross::ShaderResources resources = refl.get_shader_resources();
 
-					descriptorLayout->AddBinding(name, DescriptorType::Sampler, binding);
-				}
-			}
+		if (shaderType == ShaderType::Vertex)
+		{
+			// BUild vertex attribute descriptions from the inputs
+			std::vector<VkVertexInputAttributeDescription> descriptions;
 
-			// Reflect sampler state bindings (texture cubes, etc)
-			for (spirv_cross::Resource& resource : resources.separate_samplers)
+			for (size_t i = 0; i < resources.stage_inputs.size(); i++)
 			{
-				std::string name = refl.get_name(resource.id);
-				uint32_t set = refl.get_decoration(resource.id, spv::DecorationDescriptorSet);
-				uint32_t binding = refl.get_decoration(resource.id, spv::DecorationBinding);
+				spirv_cross::Resource& input = resources.stage_inputs[i];
+				spirv_cross::SPIRType inputType = refl.get_type(input.type_id);
+				std::string inputName = Odyssey::ToLower(input.name);
 
-				if (!m_Bindings.contains(name))
-				{
-					ShaderBinding& bindingData = m_Bindings[name];
-					bindingData.Name = name;
-					bindingData.DescriptorType = DescriptorType::Sampler;
-					bindingData.Index = binding;
+				std::string inputTag = "input.";
+				size_t inputPos = inputName.find("input.");
+				if (inputPos != std::string::npos)
+					inputName = inputName.substr(inputPos + inputTag.length());
+
+				VkVertexInputAttributeDescription& inputDesc = descriptions.emplace_back();
+				inputDesc.binding = 0;
+				inputDesc.location = (uint32_t)i;
 
-					descriptorLayout->AddBinding(name, DescriptorType::Sampler, binding);
+				// The packed layout decides the format, the input assembler converts it to the shader's type
+				if (!PackedVertex::GetAttribute(inputName, inputDesc.offset, inputDesc.format))
+				{
+					Log::Error("[Shader] Vertex input is not part of the packed vertex layout: " + inputName);
+					inputDesc.offset = 0;
+					inputDesc.format = GetVertexFormat(inputType);
 				}
 			}
 
-			// Reflect uniform buffer bindings
-			for (spirv_cross::Resource& resource : resources.uniform_buffers)
-			{
-				std::string name = refl.get_name(resource.base_type_id);
-				uint32_t set = refl.get_decoration(resource.id, spv::DecorationDescriptorSet);
-				uint32_t binding = refl.get_decoration(resource.id, spv::DecorationBinding);
+			if (descriptions.size() > 0)
+				reflection.VertexAttributes.WriteData(descriptions);
+		}
 
-				if (name == "MaterialData" && m_MaterialBufferData.Properties.size() == 0)
-				{
-					spirv_cross::SPIRType type = refl.get_type(resource.base_type_id);
-					size_t memberCount = type.member_types.size();
+		// Reflect texture sampler bindings
+		for (spirv_cross::Resource& resource : resources.sampled_images)
+		{
+			std::string name = refl.get_name(resource.base_type_id);
+			uint32_t set = refl.get_decoration(resource.id, spv::DecorationDescriptorSet);
+			uint32_t binding = refl.get_decoration(resource.id, spv::DecorationBinding);
+
+			ShaderBinding& bindingData = reflection.Bindings.emplace_back();
+			bindingData.Name = name;
+			bindingData.DescriptorType = DescriptorType::Sampler;
+			bindingData.Index = binding;
+		}
 
-					std::vector<MaterialProperty> properties;
+		// Reflect sampler state bindings (texture cubes, etc)
+		for (spirv_cross::Resource& resource : resources.separate_samplers)
+		{
+			std::string name = refl.get_name(resource.id);
+			uint32_t set = refl.get_decoration(resource.id, spv::DecorationDescriptorSet);
+			uint32_t binding = refl.get_decoration(resource.id, spv::DecorationBinding);
+
+			ShaderBinding& bindingData = reflection.Bindings.emplace_back();
+			bindingData.Name = name;
+			bindingData.DescriptorType = DescriptorType::Sampler;
+			bindingData.Index = binding;
+		}
 
-					for (size_t i = 0; i < type.member_types.size(); i++)
-					{
-						MaterialProperty& materialProperty = properties.emplace_back();
-						materialProperty.Name = refl.get_member_name(type.self, (uint32_t)i);
+		// Reflect uniform buffer bindings
+		for (spirv_cross::Resource& resource : resources.uniform_buffers)
+		{
+			std::string name = refl.get_name(resource.base_type_id);
+			uint32_t set = refl.get_decoration(resource.id, spv::DecorationDescriptorSet);
+			uint32_t binding = refl.get_decoration(resource.id, spv::DecorationBinding);
 
-						// Get member offset and size within this struct.
-						materialProperty.Offset = refl.type_struct_member_offset(type, (uint32_t)i);
-						materialProperty.Size = refl.get_declared_struct_member_size(type, (uint32_t)i);
+			if (name == "MaterialData")
+			{
+				spirv_cross::SPIRType type = refl.get_type(resource.base_type_id);
+				size_t memberCount = type.member_types.size();
 
-						auto& memberType = refl.get_type(type.member_types[i]);
+				std::vector<MaterialProperty> properties;
 
-						switch (memberType.basetype)
-						{
-							case spirv_cross::SPIRType::Float:
-								if (memberType.vecsize == 1)
-									materialProperty.Type = PropertyType::Float;
-								else if (memberType.vecsize == 2)
-									materialProperty.Type = PropertyType::Float2;
-								else if (memberType.vecsize == 3)
-									materialProperty.Type = PropertyType::Float3;
-								else if (memberType.vecsize == 4)
-									materialProperty.Type = PropertyType::Float4;
-								break;
-							case spirv_cross::SPIRType::Boolean:
-								materialProperty.Type = PropertyType::Bool;
-							case spirv_cross::SPIRType::Int:
-								materialProperty.Type = PropertyType::Int32;
-								break;
-							default:
-								materialProperty.Type = PropertyType::Unknown;
-								break;
-						}
+				for (size_t i = 0; i < type.member_types.size(); i++)
+				{
+					MaterialProperty& materialProperty = properties.emplace_back();
+					materialProperty.Name = refl.get_member_name(type.self, (uint32_t)i);
 
-						//if (!memberType.array.empty())
-						//{
-						//	// Get array stride, e.g. float4 foo[]; Will have array stride of 16 bytes.
-						//	size_t array_stride = refl.type_struct_member_array_stride(type, i);
-						//}
-						//
-						//if (memberType.columns > 1)
-						//{
-						//	// Get bytes stride between columns (if column major), for float4x4 -> 16 bytes.
-						//	size_t matrix_stride = refl.type_struct_member_matrix_stride(type, i);
-						//}
-					}
+					// Get member offset and size within this struct.
+					materialProperty.Offset = refl.type_struct_member_offset(type, (uint32_t)i);
+					materialProperty.Size = refl.get_declared_struct_member_size(type, (uint32_t)i);
 
-					// Set the material properties into the data
-					m_MaterialBufferData.Set(properties, refl.get_declared_struct_size(type));
-				}
-				
-				if (!m_Bindings.contains(name))
-				{
-					ShaderBinding& bindingData = m_Bindings[name];
-					bindingData.Name = name;
-					bindingData.DescriptorType = DescriptorType::Uniform;
-					bindingData.Index = binding;
-					descriptorLayout->AddBinding(name, DescriptorType::Uniform, binding);
-				}
-			}
+					auto& memberType = refl.get_type(type.member_types[i]);
 
-			// Reflect storage buffer bindings
-			for (spirv_cross::Resource& resource : resources.storage_buffers)
-			{
-				std::string name = refl.get_name(resource.id);
-				uint32_t set = refl.get_decoration(resource.id, spv::DecorationDescriptorSet);
-				uint32_t binding = refl.get_decoration(resource.id, spv::DecorationBinding);
+					switch (memberType.basetype)
+					{
+						case spirv_cross::SPIRType::Float:
+							if (memberType.vecsize == 1)
+								materialProperty.Type = PropertyType::Float;
+							else if (memberType.vecsize == 2)
+								materialProperty.Type = PropertyType::Float2;
+							else if (memberType.vecsize == 3)
+								materialProperty.Type = PropertyType::Float3;
+							else if (memberType.vecsize == 4)
+								materialProperty.Type = PropertyType::Float4;
+							break;
+						case spirv_cross::SPIRType::Boolean:
+							materialProperty.Type = PropertyType::Bool;
+						case spirv_cross::SPIRType::Int:
+							materialProperty.Type = PropertyType::Int32;
+							break;
+						default:
+							materialProperty.Type = PropertyType::Unknown;
+							break;
+					}
 
-				if (!m_Bindings.contains(name))
-				{
-					ShaderBinding& bindingData = m_Bindings[name];
-					bindingData.Name = name;
-					bindingData.DescriptorType = DescriptorType::Storage;
-					bindingData.Index = binding;
-					descriptorLayout->AddBinding(name, DescriptorType::Storage, binding);
+					//if (!memberType.array.empty())
+					//{
+					//	// Get array stride, e.g. float4 foo[]; Will have array stride of 16 bytes.
+					//	size_t array_stride = refl.type_struct_member_array_stride(type, i);
+					//}
+					//
+					//if (memberType.columns > 1)
+					//{
+					//	// Get bytes stride between columns (if column major), for float4x4 -> 16 bytes.
+					//	size_t matrix_stride = refl.type_struct_member_matrix_stride(type, i);
+					//}
 				}
+
+				// Store the material properties for the shader to apply
+				reflection.MaterialProperties = properties;
+				reflection.MaterialBufferSize = refl.get_declared_struct_size(type);
 			}
+			
+			ShaderBinding& bindingData = reflection.Bindings.emplace_back();
+			bindingData.Name = name;
+			bindingData.DescriptorType = DescriptorType::Uniform;
+			bindingData.Index = binding;
 		}
 
-		descriptorLayout->Apply();
+		// Reflect storage buffer bindings
+		for (spirv_cross::Resource& resource : resources.storage_buffers)
+		{
+			std::string name = refl.get_name(resource.id);
+			uint32_t set = refl.get_decoration(resource.id, spv::DecorationDescriptorSet);
+			uint32_t binding = refl.get_decoration(resource.id, spv::DecorationBinding);
+
+			ShaderBinding& bindingData = reflection.Bindings.emplace_back();
+			bindingData.Name = name;
+			bindingData.DescriptorType = DescriptorType::Storage;
+			bindingData.Index = binding;
+		}
 	}
 
 	void Shader::OnSourceModified()
@@ -501,10 +628,10 @@ namespace Odyssey
 		if (m_Source)
 		{
 			m_Source->Reload();
-			LoadFromSource(m_Source);
 
-			for (Listener& listener : m_OnModifiedListeners)
-				listener.Callback();
+			// Queue the recompile so shaders edited together compile as one batch
+			if (std::find(s_ModifiedShaders.begin(), s_ModifiedShaders.end(), this) == s_ModifiedShaders.end())
+				s_ModifiedShaders.push_back(this);
 		}
 	}
 }
\ No newline at end of file
@@ -5,21 +5,27 @@
 #include "BinaryBuffer.h"
 #include "AssetManager.h"
 #include "SourceTexture.h"
+#include "AssetSerializer.h"
+#include "Enum.h"
 
 namespace Odyssey
 {
 	Texture2D::Texture2D(const Path& assetPath)
 		: Asset(assetPath)
 	{
-		if (Ref<SourceTexture> source = AssetManager::LoadSourceAsset<SourceTexture>(m_SourceAsset))
-			Load(source);
+		Load();
+	}
+
+	Texture2D::Texture2D(const Path& assetPath, LoadData& loadData)
+		: Asset(assetPath)
+	{
+		Load(loadData);
 	}
 
 	Texture2D::Texture2D(const Path& assetPath, TextureFormat format)
 		: Asset(assetPath)
 	{
-		if (Ref<SourceTexture> source = AssetManager::LoadSourceAsset<SourceTexture>(m_SourceAsset))
-			Load(source);
+		Load();
 	}
 
 	Texture2D::Texture2D(const Path& assetPath, Ref<SourceTexture> source)
@@ -33,19 +39,52 @@ namespace Odyssey
 		SaveToDisk(m_AssetPath);
 	}
 
-	void Texture2D::Load(Ref<SourceTexture> source)
+	void Texture2D::Load()
+	{
+		LoadData loadData;
+		Decode(m_AssetPath, loadData);
+		Load(loadData);
+	}
+
+	void Texture2D::Load(LoadData& loadData)
+	{
+		m_TextureDescription.MipMapEnabled = loadData.Description.MipMapEnabled;
+		m_TextureDescription.MipBias = loadData.Description.MipBias;
+		m_TextureDescription.MaxMipCount = loadData.Description.MaxMipCount;
+		m_Usage = loadData.Usage;
+		m_Compression = loadData.Compression;
+
+		CreateTexture(loadData.Texture);
+	}
+
+	void Texture2D::Decode(const Path& assetPath, LoadData& loadData)
 	{
-		AssetDeserializer deserializer(m_AssetPath);
+		GUID guid;
+		GUID sourceAsset;
+		std::string usage;
+		std::string compression;
+
+		AssetDeserializer deserializer(assetPath);
 		if (deserializer.IsValid())
 		{
 			SerializationNode root = deserializer.GetRoot();
-			root.ReadData("Mip Maps Enabled", m_TextureDescription.MipMapEnabled);
-			root.ReadData("Mip Bias", m_TextureDescription.MipBias);
-			root.ReadData("Max Mip Count", m_TextureDescription.MaxMipCount);
+			root.ReadData("m_GUID", guid.Ref());
+			root.ReadData("m_SourceAsset", sourceAsset.Ref());
+			root.ReadData("Mip Maps Enabled", loadData.Description.MipMapEnabled);
+			root.ReadData("Mip Bias", loadData.Description.MipBias);
+			root.ReadData("Max Mip Count", loadData.Description.MaxMipCount);
+			root.ReadData("Usage", usage);
+			root.ReadData("Compression", compression);
 		}
 
-		source->AddOnModifiedListener([this]() { OnSourceModified(); });
-		LoadFromSource(source);
+		if (!usage.empty())
+			loadData.Usage = Enum::ToEnum<TextureUsage>(usage);
+
+		if (!compression.empty())
+			loadData.Compression = Enum::ToEnum<TextureCompression>(compression);
+
+		TextureCache::Settings settings = GetCacheSettings(sourceAsset, loadData.Usage, loadData.Compression);
+		LoadCookedTexture(guid, sourceAsset, settings, loadData.Texture);
 	}
 
 	void Texture2D::SetMipMapsEnabled(bool enabled)
@@ -53,7 +92,7 @@ namespace Odyssey
 		if (m_TextureDescription.MipMapEnabled != enabled)
 		{
 			m_TextureDescription.MipMapEnabled = enabled;
-			LoadFromSource(AssetManager::LoadSourceAsset<SourceTexture>(m_SourceAsset));
+			Reload();
 		}
 	}
 
@@ -62,7 +101,7 @@ namespace Odyssey
 		if (m_TextureDescription.MipBias != bias)
 		{
 			m_TextureDescription.MipBias = bias;
-			LoadFromSource(AssetManager::LoadSourceAsset<SourceTexture>(m_SourceAsset));
+			Reload();
 		}
 	}
 
@@ -71,26 +110,53 @@ namespace Odyssey
 		if (m_TextureDescription.MaxMipCount != count)
 		{
 			m_TextureDescription.MaxMipCount = count;
-			LoadFromSource(AssetManager::LoadSourceAsset<SourceTexture>(m_SourceAsset));
+			Reload();
 		}
 	}
 
-	void Texture2D::LoadFromSource(Ref<SourceTexture> source)
+	void Texture2D::SetUsage(TextureUsage usage)
 	{
-		// Copy in the texture settings
-		m_TextureDescription.Width = (uint32_t)source->GetWidth();
-		m_TextureDescription.Height = (uint32_t)source->GetHeight();
-		m_TextureDescription.Channels = (uint32_t)source->GetChannels();
+		if (m_Usage != usage)
+		{
+			m_Usage = usage;
+			Reload();
+		}
+	}
+
+	void Texture2D::SetCompression(TextureCompression compression)
+	{
+		if (m_Compression != compression)
+		{
+			m_Compression = compression;
+			Reload();
+		}
+	}
+
+	void Texture2D::Reload()
+	{
+		// Mip settings only change how much of the cooked chain is uploaded, so this is a cache read unless the usage changed
+		TextureCache::CookedTexture texture;
+		if (LoadCookedTexture(m_GUID, m_SourceAsset, GetCacheSettings(m_SourceAsset, m_Usage, m_Compression), texture))
+			CreateTexture(texture);
+	}
 
-		if (m_AssetPath.string().find("normal") != std::string::npos)
-			m_TextureDescription.Format = TextureFormat::R8G8B8A8_UNORM;
+	void Texture2D::CreateTexture(TextureCache::CookedTexture& texture)
+	{
+		if (texture.Width == 0 || texture.Height == 0)
+			return;
+
+		// Copy in the texture settings
+		m_TextureDescription.Width = texture.Width;
+		m_TextureDescription.Height = texture.Height;
+		m_TextureDescription.Channels = 4;
+		m_TextureDescription.Format = texture.Format;
 
 		// Destroy the existing texture
 		if (m_Texture)
 			ResourceManager::Destroy(m_Texture);
 
-		// Allocate a new texture using the source pixel buffer
-		m_Texture = ResourceManager::Allocate<VulkanTexture>(m_TextureDescription, &(source->GetPixelBuffer()));
+		// Allocate a new texture straight from the cooked mip chain
+		m_Texture = ResourceManager::Allocate<VulkanTexture>(m_TextureDescription, &texture.Pixels, texture.MipOffsets);
 	}
 
 	void Texture2D::SaveToDisk(const Path& assetPath)
@@ -106,13 +172,50 @@ namespace Odyssey
 		root.WriteData("Mip Maps Enabled", m_TextureDescription.MipMapEnabled);
 		root.WriteData("Mip Bias", m_TextureDescription.MipBias);
 		root.WriteData("Max Mip Count", m_TextureDescription.MaxMipCount);
+		root.WriteData("Usage", Enum::ToString(m_Usage));
+		root.WriteData("Compression", Enum::ToString(m_Compression));
 
 		serializer.WriteToDisk(assetPath);
 	}
 
-	void Texture2D::OnSourceModified()
+	TextureCache::Settings Texture2D::GetCacheSettings(GUID sourceAsset, TextureUsage usage, TextureCompression compression)
 	{
-		if (Ref<SourceTexture> source = AssetManager::LoadSourceAsset<SourceTexture>(m_SourceAsset))
-			LoadFromSource(source);
+		TextureCache::Settings settings;
+		settings.Usage = usage;
+		settings.Compression = compression;
+
+		// Re-cook whenever the contents of the source image change
+		Path sourcePath = AssetManager::GUIDToPath(sourceAsset);
+		if (!sourcePath.empty())
+			settings.SourceHash = TextureCache::HashSource(sourcePath);
+
+		return settings;
+	}
+
+	bool Texture2D::LoadCookedTexture(GUID guid, GUID sourceAsset, const TextureCache::Settings& settings, TextureCache::CookedTexture& texture)
+	{
+		// The cooked texture skips stb_image and the block compressor entirely
+		if (guid)
+		{
+			BinaryBuffer buffer = AssetManager::LoadBinaryData(guid);
+			if (buffer && TextureCache::Uncook(buffer, settings, texture))
+				return true;
+		}
+
+		if (Ref<SourceTexture> source = AssetManager::LoadSourceAsset<SourceTexture>(sourceAsset))
+		{
+			BinaryBuffer buffer = TextureCache::Cook(source->GetPixelBuffer(), (uint32_t)source->GetWidth(), (uint32_t)source->GetHeight(), settings);
+
+			if (buffer && TextureCache::Uncook(buffer, settings, texture))
+			{
+				// Cook once so the next load is a straight copy
+				if (guid)
+					AssetManager::SaveBinaryData(guid, buffer);
+
+				return true;
+			}
+		}
+
+		return false;
 	}
 }
\ No newline at end of file
@@ -0,0 +1,671 @@
+#include "TextureCache.h"
+
+namespace Odyssey
+{
+	struct TextureCacheHeader
+	{
+		uint32_t Magic;
+		uint32_t Version;
+		uint64_t SourceHash;
+		uint32_t Width;
+		uint32_t Height;
+		uint32_t Format;
+		uint32_t Usage;
+		uint32_t Compression;
+		uint32_t MipCount;
+	};
+
+	inline static constexpr uint64_t Source_Hash_Offset_Basis = 0xcbf29ce484222325;
+	inline static constexpr uint64_t Source_Hash_Prime = 0x100000001b3;
+	inline static constexpr size_t Source_Hash_Chunk_Size = 64 * 1024;
+
+	// Interpolation weights of the 4-bit BC7 indices
+	inline static constexpr int32_t BC7_Weights[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+	template<typename T>
+	void WriteTextureStream(std::vector<uint8_t>& data, const T* values, size_t count)
+	{
+		size_t offset = data.size();
+		data.resize(offset + sizeof(T) * count);
+		memcpy(data.data() + offset, values, sizeof(T) * count);
+	}
+
+	float SRGBToLinear(float value)
+	{
+		return value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+	}
+
+	float LinearToSRGB(float value)
+	{
+		return value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+	}
+
+	uint8_t QuantizeUNORM8(float value)
+	{
+		return (uint8_t)(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+	}
+
+	TextureFormat SelectFormat(BinaryBuffer& pixels, const TextureCache::Settings& settings)
+	{
+		if (settings.Compression == TextureCompression::None)
+			return TextureFormat::R8G8B8A8_UNORM;
+
+		// Only the two tangent space channels are stored, the shaders reconstruct z
+		if (settings.Usage == TextureUsage::NormalMap)
+			return TextureFormat::BC5_UNORM;
+
+		if (settings.Compression == TextureCompression::HighQuality)
+			return TextureFormat::BC7_UNORM;
+
+		// BC1 has no alpha, so anything with transparency needs the separate alpha block of BC3
+		const std::vector<uint8_t>& data = pixels.GetData();
+		for (size_t i = 3; i < data.size(); i += 4)
+		{
+			if (data[i] != 255)
+				return TextureFormat::BC3_UNORM;
+		}
+
+		return TextureFormat::BC1_RGB_UNORM;
+	}
+
+	std::vector<float4> DecodeTexels(const std::vector<uint8_t>& rgba, TextureUsage usage)
+	{
+		// Color textures are filtered in linear space so darker texels don't dominate the lower mips
+		float srgbToLinear[256];
+		for (uint32_t i = 0; i < 256; i++)
+			srgbToLinear[i] = SRGBToLinear(i / 255.0f);
+
+		std::vector<float4> texels(rgba.size() / 4);
+
+		for (size_t i = 0; i < texels.size(); i++)
+		{
+			const uint8_t* texel = &rgba[i * 4];
+			float4 value = float4(texel[0], texel[1], texel[2], texel[3]) / 255.0f;
+
+			if (usage == TextureUsage::Color)
+				value = float4(srgbToLinear[texel[0]], srgbToLinear[texel[1]], srgbToLinear[texel[2]], value.a);
+			else if (usage == TextureUsage::NormalMap)
+				value = float4(float3(value) * 2.0f - 1.0f, value.a);
+
+			texels[i] = value;
+		}
+
+		return texels;
+	}
+
+	void EncodeTexels(const std::vector<float4>& texels, TextureUsage usage, std::vector<uint8_t>& rgba)
+	{
+		rgba.resize(texels.size() * 4);
+
+		for (size_t i = 0; i < texels.size(); i++)
+		{
+			float4 value = texels[i];
+
+			if (usage == TextureUsage::Color)
+				value = float4(LinearToSRGB(value.r), LinearToSRGB(value.g), LinearToSRGB(value.b), value.a);
+			else if (usage == TextureUsage::NormalMap)
+				value = float4(float3(value) * 0.5f + 0.5f, value.a);
+
+			for (uint32_t c = 0; c < 4; c++)
+				rgba[i * 4 + c] = QuantizeUNORM8(value[c]);
+		}
+	}
+
+	std::vector<float4> Downsample(const std::vector<float4>& texels, uint32_t width, uint32_t height, TextureUsage usage)
+	{
+		uint32_t mipWidth = std::max(width / 2, 1u);
+		uint32_t mipHeight = std::max(height / 2, 1u);
+		std::vector<float4> mip((size_t)mipWidth * mipHeight);
+
+		for (uint32_t y = 0; y < mipHeight; y++)
+		{
+			uint32_t y0 = std::min(y * 2, height - 1);
+			uint32_t y1 = std::min(y * 2 + 1, height - 1);
+
+			for (uint32_t x = 0; x < mipWidth; x++)
+			{
+				uint32_t x0 = std::min(x * 2, width - 1);
+				uint32_t x1 = std::min(x * 2 + 1, width - 1);
+
+				float4 value = (texels[(size_t)y0 * width + x0] + texels[(size_t)y0 * width + x1] +
+					texels[(size_t)y1 * width + x0] + texels[(size_t)y1 * width + x1]) * 0.25f;
+
+				// Averaged normals shrink, keep them unit length so lighting doesn't darken in the distance
+				if (usage == TextureUsage::NormalMap)
+				{
+					float3 normal = float3(value);
+					float length = glm::length(normal);
+					if (length > 0.0f)
+						value = float4(normal / length, value.a);
+				}
+
+				mip[(size_t)y * mipWidth + x] = value;
+			}
+		}
+
+		return mip;
+	}
+
+	void FetchBlock(const std::vector<uint8_t>& rgba, uint32_t width, uint32_t height, uint32_t blockX, uint32_t blockY, uint8_t block[16][4])
+	{
+		// Edge blocks repeat the last row and column so partial blocks still encode cleanly
+		for (uint32_t y = 0; y < 4; y++)
+		{
+			uint32_t pixelY = std::min(blockY * 4 + y, height - 1);
+
+			for (uint32_t x = 0; x < 4; x++)
+			{
+				uint32_t pixelX = std::min(blockX * 4 + x, width - 1);
+				memcpy(block[y * 4 + x], &rgba[((size_t)pixelY * width + pixelX) * 4], 4);
+			}
+		}
+	}
+
+	template<uint32_t N>
+	void FindEndpoints(const uint8_t block[16][4], float endpoint0[N], float endpoint1[N])
+	{
+		float mean[N] = { };
+		float minValue[N];
+		float maxValue[N];
+
+		for (uint32_t c = 0; c < N; c++)
+		{
+			minValue[c] = 255.0f;
+			maxValue[c] = 0.0f;
+		}
+
+		for (uint32_t i = 0; i < 16; i++)
+		{
+			for (uint32_t c = 0; c < N; c++)
+			{
+				mean[c] += block[i][c] / 16.0f;
+				minValue[c] = std::min(minValue[c], (float)block[i][c]);
+				maxValue[c] = std::max(maxValue[c], (float)block[i][c]);
+			}
+		}
+
+		float covariance[N][N] = { };
+		for (uint32_t i = 0; i < 16; i++)
+		{
+			for (uint32_t a = 0; a < N; a++)
+			{
+				for (uint32_t b = 0; b < N; b++)
+					covariance[a][b] += (block[i][a] - mean[a]) * (block[i][b] - mean[b]);
+			}
+		}
+
+		// Power iteration from the bounding box diagonal converges on the principal axis of the block
+		float axis[N];
+		float axisLength = 0.0f;
+		for (uint32_t c = 0; c < N; c++)
+		{
+			axis[c] = maxValue[c] - minValue[c];
+			axisLength += axis[c] * axis[c];
+		}
+
+		// A flat block collapses to a single color
+		if (axisLength <= 0.0f)
+		{
+			for (uint32_t c = 0; c < N; c++)
+				endpoint0[c] = endpoint1[c] = mean[c];
+			return;
+		}
+
+		for (uint32_t iteration = 0; iteration < 8; iteration++)
+		{
+			float next[N] = { };
+			float nextLength = 0.0f;
+
+			for (uint32_t a = 0; a < N; a++)
+			{
+				for (uint32_t b = 0; b < N; b++)
+					next[a] += covariance[a][b] * axis[b];
+
+				nextLength += next[a] * next[a];
+			}
+
+			if (nextLength <= 1e-6f)
+				break;
+
+			nextLength = std::sqrt(nextLength);
+			for (uint32_t c = 0; c < N; c++)
+				axis[c] = next[c] / nextLength;
+		}
+
+		axisLength = 0.0f;
+		for (uint32_t c = 0; c < N; c++)
+			axisLength += axis[c] * axis[c];
+
+		axisLength = std::sqrt(axisLength);
+		for (uint32_t c = 0; c < N; c++)
+			axis[c] /= axisLength;
+
+		// The endpoints are the extremes of the block projected onto the axis
+		float minProjection = 0.0f;
+		float maxProjection = 0.0f;
+		for (uint32_t i = 0; i < 16; i++)
+		{
+			float projection = 0.0f;
+			for (uint32_t c = 0; c < N; c++)
+				projection += (block[i][c] - mean[c]) * axis[c];
+
+			minProjection = std::min(minProjection, projection);
+			maxProjection = std::max(maxProjection, projection);
+		}
+
+		for (uint32_t c = 0; c < N; c++)
+		{
+			endpoint0[c] = std::clamp(mean[c] + axis[c] * maxProjection, 0.0f, 255.0f);
+			endpoint1[c] = std::clamp(mean[c] + axis[c] * minProjection, 0.0f, 255.0f);
+		}
+	}
+
+	uint16_t PackRGB565(const float color[3])
+	{
+		uint32_t r = (uint32_t)(color[0] * 31.0f / 255.0f + 0.5f);
+		uint32_t g = (uint32_t)(color[1] * 63.0f / 255.0f + 0.5f);
+		uint32_t b = (uint32_t)(color[2] * 31.0f / 255.0f + 0.5f);
+		return (uint16_t)((r << 11) | (g << 5) | b);
+	}
+
+	void UnpackRGB565(uint16_t color, int32_t rgb[3])
+	{
+		int32_t r = (color >> 11) & 31;
+		int32_t g = (color >> 5) & 63;
+		int32_t b = color & 31;
+		rgb[0] = (r << 3) | (r >> 2);
+		rgb[1] = (g << 2) | (g >> 4);
+		rgb[2] = (b << 3) | (b >> 2);
+	}
+
+	void EncodeBC1(const uint8_t block[16][4], uint8_t* output)
+	{
+		float endpoint0[3];
+		float endpoint1[3];
+		FindEndpoints<3>(block, endpoint0, endpoint1);
+
+		uint16_t color0 = PackRGB565(endpoint0);
+		uint16_t color1 = PackRGB565(endpoint1);
+
+		// The opaque four color mode is selected by color0 > color1
+		if (color0 < color1)
+			std::swap(color0, color1);
+
+		uint32_t indices = 0;
+
+		if (color0 != color1)
+		{
+			int32_t palette[4][3];
+			UnpackRGB565(color0, palette[0]);
+			UnpackRGB565(color1, palette[1]);
+
+			for (uint32_t c = 0; c < 3; c++)
+			{
+				palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+				palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+			}
+
+			for (uint32_t i = 0; i < 16; i++)
+			{
+				uint32_t bestIndex = 0;
+				int32_t bestError = INT32_MAX;
+
+				for (uint32_t p = 0; p < 4; p++)
+				{
+					int32_t error = 0;
+					for (uint32_t c = 0; c < 3; c++)
+					{
+						int32_t delta = block[i][c] - palette[p][c];
+						error += delta * delta;
+					}
+
+					if (error < bestError)
+					{
+						bestError = error;
+						bestIndex = p;
+					}
+				}
+
+				indices |= bestIndex << (i * 2);
+			}
+		}
+
+		memcpy(output, &color0, sizeof(uint16_t));
+		memcpy(output + 2, &color1, sizeof(uint16_t));
+		memcpy(output + 4, &indices, sizeof(uint32_t));
+	}
+
+	void EncodeBC4(const uint8_t block[16][4], uint32_t channel, uint8_t* output)
+	{
+		int32_t minValue = 255;
+		int32_t maxValue = 0;
+
+		for (uint32_t i = 0; i < 16; i++)
+		{
+			minValue = std::min(minValue, (int32_t)block[i][channel]);
+			maxValue = std::max(maxValue, (int32_t)block[i][channel]);
+		}
+
+		// The eight value mode is selected by endpoint0 > endpoint1
+		output[0] = (uint8_t)maxValue;
+		output[1] = (uint8_t)minValue;
+
+		uint64_t indices = 0;
+
+		if (maxValue > minValue)
+		{
+			int32_t palette[8];
+			palette[0] = maxValue;
+			palette[1] = minValue;
+
+			for (int32_t i = 1; i < 7; i++)
+				palette[i + 1] = ((7 - i) * maxValue + i * minValue) / 7;
+
+			for (uint32_t i = 0; i < 16; i++)
+			{
+				uint64_t bestIndex = 0;
+				int32_t bestError = INT32_MAX;
+
+				for (uint32_t p = 0; p < 8; p++)
+				{
+					int32_t error = std::abs(block[i][channel] - palette[p]);
+					if (error < bestError)
+					{
+						bestError = error;
+						bestIndex = p;
+					}
+				}
+
+				indices |= bestIndex << (i * 3);
+			}
+		}
+
+		for (uint32_t i = 0; i < 6; i++)
+			output[2 + i] = (uint8_t)(indices >> (i * 8));
+	}
+
+	struct BlockWriter
+	{
+	public:
+		void Write(uint32_t value, uint32_t bitCount)
+		{
+			for (uint32_t i = 0; i < bitCount; i++, Position++)
+			{
+				if ((value >> i) & 1)
+					Data[Position / 8] |= (uint8_t)(1 << (Position % 8));
+			}
+		}
+
+	public:
+		uint8_t* Data = nullptr;
+		uint32_t Position = 0;
+	};
+
+	void QuantizeBC7Endpoint(const float endpoint[4], uint32_t quantized[4], uint32_t& pBit)
+	{
+		// Mode 6 stores 7 bits per channel plus a shared low bit, pick whichever low bit lands closer
+		float bestError = FLT_MAX;
+
+		for (uint32_t p = 0; p < 2; p++)
+		{
+			uint32_t candidate[4];
+			float error = 0.0f;
+
+			for (uint32_t c = 0; c < 4; c++)
+			{
+				candidate[c] = (uint32_t)std::clamp((int32_t)std::round((endpoint[c] - p) / 2.0f), 0, 127);
+				float delta = (float)((candidate[c] << 1) | p) - endpoint[c];
+				error += delta * delta;
+			}
+
+			if (error < bestError)
+			{
+				bestError = error;
+				pBit = p;
+				memcpy(quantized, candidate, sizeof(candidate));
+			}
+		}
+	}
+
+	void EncodeBC7(const uint8_t block[16][4], uint8_t* output)
+	{
+		// Single subset mode 6 with RGBA endpoints, the best general purpose mode for a fast encoder
+		float endpoints[2][4];
+		FindEndpoints<4>(block, endpoints[0], endpoints[1]);
+
+		uint32_t quantized[2][4];
+		uint32_t pBits[2];
+		QuantizeBC7Endpoint(endpoints[0], quantized[0], pBits[0]);
+		QuantizeBC7Endpoint(endpoints[1], quantized[1], pBits[1]);
+
+		int32_t palette[16][4];
+		for (uint32_t c = 0; c < 4; c++)
+		{
+			int32_t value0 = (int32_t)((quantized[0][c] << 1) | pBits[0]);
+			int32_t value1 = (int32_t)((quantized[1][c] << 1) | pBits[1]);
+
+			for (uint32_t w = 0; w < 16; w++)
+				palette[w][c] = ((64 - BC7_Weights[w]) * value0 + BC7_Weights[w] * value1 + 32) >> 6;
+		}
+
+		uint32_t indices[16];
+		for (uint32_t i = 0; i < 16; i++)
+		{
+			int32_t bestError = INT32_MAX;
+
+			for (uint32_t w = 0; w < 16; w++)
+			{
+				int32_t error = 0;
+				for (uint32_t c = 0; c < 4; c++)
+				{
+					int32_t delta = block[i][c] - palette[w][c];
+					error += delta * delta;
+				}
+
+				if (error < bestError)
+				{
+					bestError = error;
+					indices[i] = w;
+				}
+			}
+		}
+
+		// The anchor index drops its top bit, so flip the endpoints when it would be set
+		if (indices[0] & 8)
+		{
+			std::swap(quantized[0], quantized[1]);
+			std::swap(pBits[0], pBits[1]);
+
+			for (uint32_t i = 0; i < 16; i++)
+				indices[i] = 15 - indices[i];
+		}
+
+		memset(output, 0, 16);
+
+		BlockWriter writer;
+		writer.Data = output;
+		writer.Write(1 << 6, 7);
+
+		for (uint32_t c = 0; c < 4; c++)
+		{
+			writer.Write(quantized[0][c], 7);
+			writer.Write(quantized[1][c], 7);
+		}
+
+		writer.Write(pBits[0], 1);
+		writer.Write(pBits[1], 1);
+
+		for (uint32_t i = 0; i < 16; i++)
+			writer.Write(indices[i], i == 0 ? 3 : 4);
+	}
+
+	void CompressMip(const std::vector<uint8_t>& rgba, uint32_t width, uint32_t height, TextureFormat format, std::vector<uint8_t>& output)
+	{
+		if (!IsCompressedFormat(format))
+		{
+			output.insert(output.end(), rgba.begin(), rgba.end());
+			return;
+		}
+
+		size_t blockSize = format == TextureFormat::BC1_RGB_UNORM ? 8 : 16;
+		uint32_t blocksX = (width + 3) / 4;
+		uint32_t blocksY = (height + 3) / 4;
+
+		size_t offset = output.size();
+		output.resize(offset + blockSize * blocksX * blocksY);
+
+		uint8_t block[16][4];
+
+		for (uint32_t blockY = 0; blockY < blocksY; blockY++)
+		{
+			for (uint32_t blockX = 0; blockX < blocksX; blockX++)
+			{
+				FetchBlock(rgba, width, height, blockX, blockY, block);
+				uint8_t* blockData = output.data() + offset + ((size_t)blockY * blocksX + blockX) * blockSize;
+
+				switch (format)
+				{
+					case TextureFormat::BC1_RGB_UNORM:
+						EncodeBC1(block, blockData);
+						break;
+					case TextureFormat::BC3_UNORM:
+						EncodeBC4(block, 3, blockData);
+						EncodeBC1(block, blockData + 8);
+						break;
+					case TextureFormat::BC5_UNORM:
+						EncodeBC4(block, 0, blockData);
+						EncodeBC4(block, 1, blockData + 8);
+						break;
+					case TextureFormat::BC7_UNORM:
+						EncodeBC7(block, blockData);
+						break;
+					default:
+						break;
+				}
+			}
+		}
+	}
+
+	uint64_t TextureCache::HashSource(const Path& sourcePath)
+	{
+		std::ifstream file(sourcePath, std::ios::binary);
+		if (!file.is_open())
+			return 0;
+
+		uint64_t hash = Source_Hash_Offset_Basis;
+		std::vector<char> chunk(Source_Hash_Chunk_Size);
+
+		while (file.read(chunk.data(), chunk.size()) || file.gcount() > 0)
+		{
+			for (std::streamsize i = 0; i < file.gcount(); i++)
+			{
+				hash ^= (uint8_t)chunk[i];
+				hash *= Source_Hash_Prime;
+			}
+		}
+
+		return hash;
+	}
+
+	BinaryBuffer TextureCache::Cook(BinaryBuffer& pixels, uint32_t width, uint32_t height, const Settings& settings)
+	{
+		if (width == 0 || height == 0 || pixels.GetSize() < (size_t)width * height * 4)
+			return BinaryBuffer();
+
+		TextureFormat format = SelectFormat(pixels, settings);
+		uint32_t mipCount = (uint32_t)(std::floor(std::log2(std::max(width, height))) + 1);
+
+		// The full chain is always cooked, the mip settings only decide how much of it gets uploaded
+		std::vector<uint64_t> mipSizes(mipCount);
+		std::vector<uint8_t> mipData;
+
+		std::vector<uint8_t> rgba = pixels.GetData();
+		std::vector<float4> texels;
+		uint32_t mipWidth = width;
+		uint32_t mipHeight = height;
+
+		for (uint32_t mip = 0; mip < mipCount; mip++)
+		{
+			if (mip > 0)
+			{
+				if (texels.empty())
+					texels = DecodeTexels(rgba, settings.Usage);
+
+				texels = Downsample(texels, mipWidth, mipHeight, settings.Usage);
+				mipWidth = std::max(mipWidth / 2, 1u);
+				mipHeight = std::max(mipHeight / 2, 1u);
+				EncodeTexels(texels, settings.Usage, rgba);
+			}
+
+			size_t offset = mipData.size();
+			CompressMip(rgba, mipWidth, mipHeight, format, mipData);
+			mipSizes[mip] = mipData.size() - offset;
+		}
+
+		TextureCacheHeader header{ };
+		header.Magic = Magic;
+		header.Version = Version;
+		header.SourceHash = settings.SourceHash;
+		header.Width = width;
+		header.Height = height;
+		header.Format = (uint32_t)format;
+		header.Usage = (uint32_t)settings.Usage;
+		header.Compression = (uint32_t)settings.Compression;
+		header.MipCount = mipCount;
+
+		std::vector<uint8_t> data;
+		data.reserve(sizeof(TextureCacheHeader) + sizeof(uint64_t) * mipCount + mipData.size());
+		WriteTextureStream(data, &header, 1);
+		WriteTextureStream(data, mipSizes.data(), mipSizes.size());
+		WriteTextureStream(data, mipData.data(), mipData.size());
+
+		return BinaryBuffer(std::move(data));
+	}
+
+	bool TextureCache::Uncook(BinaryBuffer& buffer, const Settings& settings, CookedTexture& texture)
+	{
+		const std::vector<uint8_t>& data = buffer.GetData();
+		size_t size = buffer.GetSize();
+
+		if (size < sizeof(TextureCacheHeader))
+			return false;
+
+		// Anything cooked from a different source or with different settings is stale
+		TextureCacheHeader header;
+		memcpy(&header, data.data(), sizeof(TextureCacheHeader));
+
+		if (header.Magic != Magic || header.Version != Version ||
+			header.SourceHash != settings.SourceHash ||
+			header.Usage != (uint32_t)settings.Usage ||
+			header.Compression != (uint32_t)settings.Compression)
+			return false;
+
+		size_t offset = sizeof(TextureCacheHeader);
+		if (offset + sizeof(uint64_t) * header.MipCount > size)
+			return false;
+
+		std::vector<uint64_t> mipSizes(header.MipCount);
+		memcpy(mipSizes.data(), data.data() + offset, sizeof(uint64_t) * header.MipCount);
+		offset += sizeof(uint64_t) * header.MipCount;
+
+		size_t pixelSize = 0;
+		texture.MipOffsets.resize(header.MipCount);
+
+		for (uint32_t mip = 0; mip < header.MipCount; mip++)
+		{
+			texture.MipOffsets[mip] = pixelSize;
+			pixelSize += mipSizes[mip];
+		}
+
+		if (offset + pixelSize > size)
+			return false;
+
+		texture.Width = header.Width;
+		texture.Height = header.Height;
+		texture.Format = (TextureFormat)header.Format;
+
+		// The payload is already in the layout the GPU expects, so this is the only copy
+		texture.Pixels.WriteData(data.data() + offset, pixelSize);
+		return true;
+	}
+}
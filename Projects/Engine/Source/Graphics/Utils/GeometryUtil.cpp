@@ -104,6 +104,40 @@ namespace Odyssey
 		genTangSpaceDefault(&context);
 	}
 
+	inline static float2 SignNotZero(float2 value)
+	{
+		return float2(value.x >= 0.0f ? 1.0f : -1.0f, value.y >= 0.0f ? 1.0f : -1.0f);
+	}
+
+	float2 GeometryUtil::OctahedralEncode(float3 normal)
+	{
+		float length = glm::abs(normal.x) + glm::abs(normal.y) + glm::abs(normal.z);
+		if (length <= 0.0f)
+			return float2(0.0f);
+
+		normal /= length;
+		float2 encoded = float2(normal.x, normal.y);
+
+		if (normal.z < 0.0f)
+			encoded = (1.0f - glm::abs(float2(encoded.y, encoded.x))) * SignNotZero(encoded);
+
+		return encoded;
+	}
+
+	float3 GeometryUtil::OctahedralDecode(float2 encoded)
+	{
+		float3 normal = float3(encoded.x, encoded.y, 1.0f - glm::abs(encoded.x) - glm::abs(encoded.y));
+
+		if (normal.z < 0.0f)
+		{
+			float2 folded = (1.0f - glm::abs(float2(normal.y, normal.x))) * SignNotZero(float2(normal.x, normal.y));
+			normal.x = folded.x;
+			normal.y = folded.y;
+		}
+
+		return glm::normalize(normal);
+	}
+
 	void GeometryUtil::ComputeBox(vec3 center, vec3 scale, std::vector<Vertex>& vertices, std::vector<unsigned int>& indices)
 	{
 		// A box has six faces, each one pointing in a different direction.
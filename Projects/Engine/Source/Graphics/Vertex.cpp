@@ -1,4 +1,5 @@
 #include "Vertex.h"
+#include "GeometryUtil.h"
 
 namespace Odyssey
 {
@@ -56,45 +57,83 @@ namespace Odyssey
 		BoneWeights = glm::vec4(1, 0, 0, 0);
 	}
 
-	uint32_t Vertex::GetOffset(std::string_view attribute)
+	PackedVertex::PackedVertex()
+		: PackedVertex(Vertex())
+	{
+	}
+
+	PackedVertex::PackedVertex(const Vertex& vertex)
+	{
+		Position = vertex.Position;
+		Normal = glm::i16vec2(glm::round(glm::clamp(GeometryUtil::OctahedralEncode(vertex.Normal), -1.0f, 1.0f) * 32767.0f));
+		Tangent = glm::i16vec4(glm::round(glm::clamp(vertex.Tangent, -1.0f, 1.0f) * 32767.0f));
+		Color = glm::u8vec4(glm::round(glm::clamp(vertex.Color, 0.0f, 1.0f) * 255.0f));
+		TexCoord0 = glm::packHalf2x16(vertex.TexCoord0);
+		TexCoord1 = glm::packHalf2x16(vertex.TexCoord1);
+		BoneIndices = glm::u16vec4(vertex.BoneIndices);
+		BoneWeights = glm::u16vec4(glm::round(glm::clamp(vertex.BoneWeights, 0.0f, 1.0f) * 65535.0f));
+	}
+
+	std::vector<PackedVertex> PackedVertex::Pack(const std::vector<Vertex>& vertices)
+	{
+		return std::vector<PackedVertex>(vertices.begin(), vertices.end());
+	}
+
+	bool PackedVertex::GetAttribute(std::string_view attribute, uint32_t& offset, VkFormat& format)
 	{
 		if (attribute == "position")
-			return offsetof(Vertex, Position);
+		{
+			offset = offsetof(PackedVertex, Position);
+			format = VK_FORMAT_R32G32B32_SFLOAT;
+		}
 		else if (attribute == "normal")
-			return offsetof(Vertex, Normal);
+		{
+			offset = offsetof(PackedVertex, Normal);
+			format = VK_FORMAT_R16G16_SNORM;
+		}
 		else if (attribute == "tangent")
-			return offsetof(Vertex, Tangent);
+		{
+			offset = offsetof(PackedVertex, Tangent);
+			format = VK_FORMAT_R16G16B16A16_SNORM;
+		}
 		else if (attribute == "color")
-			return offsetof(Vertex, Color);
+		{
+			offset = offsetof(PackedVertex, Color);
+			format = VK_FORMAT_R8G8B8A8_UNORM;
+		}
 		else if (attribute == "texcoord0")
-			return offsetof(Vertex, TexCoord0);
+		{
+			offset = offsetof(PackedVertex, TexCoord0);
+			format = VK_FORMAT_R16G16_SFLOAT;
+		}
 		else if (attribute == "texcoord1")
-			return offsetof(Vertex, TexCoord1);
-		else if (attribute == "texcoord2")
-			return offsetof(Vertex, TexCoord2);
-		else if (attribute == "texcoord3")
-			return offsetof(Vertex, TexCoord3);
-		else if (attribute == "texcoord4")
-			return offsetof(Vertex, TexCoord4);
-		else if (attribute == "texcoord5")
-			return offsetof(Vertex, TexCoord5);
-		else if (attribute == "texcoord6")
-			return offsetof(Vertex, TexCoord6);
-		else if (attribute == "texcoord7")
-			return offsetof(Vertex, TexCoord7);
+		{
+			offset = offsetof(PackedVertex, TexCoord1);
+			format = VK_FORMAT_R16G16_SFLOAT;
+		}
 		else if (attribute == "boneindices")
-			return offsetof(Vertex, BoneIndices);
+		{
+			offset = offsetof(PackedVertex, BoneIndices);
+			format = VK_FORMAT_R16G16B16A16_UINT;
+		}
 		else if (attribute == "boneweights")
-			return offsetof(Vertex, BoneWeights);
+		{
+			offset = offsetof(PackedVertex, BoneWeights);
+			format = VK_FORMAT_R16G16B16A16_UNORM;
+		}
+		else
+		{
+			return false;
+		}
 
-		return 0;
+		return true;
 	}
 
-	VkVertexInputBindingDescription Vertex::GetBindingDescription()
+	VkVertexInputBindingDescription PackedVertex::GetBindingDescription()
 	{
 		VkVertexInputBindingDescription bindingDescription;
 		bindingDescription.binding = 0;
-		bindingDescription.stride = sizeof(Vertex);
+		bindingDescription.stride = sizeof(PackedVertex);
 		bindingDescription.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
 		return bindingDescription;
 	}
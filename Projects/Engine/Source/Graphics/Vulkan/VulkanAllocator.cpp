@@ -13,7 +13,7 @@ namespace Odyssey
 	{
 	}
 
-	VmaAllocation VulkanAllocator::AllocateBuffer(VkBufferCreateInfo createInfo, VmaMemoryUsage usage, bool cpuRead, VkBuffer& outBuffer)
+	VmaAllocation VulkanAllocator::AllocateBuffer(VkBufferCreateInfo createInfo, VmaMemoryUsage usage, bool cpuRead, VkBuffer& outBuffer, void** mappedData)
 	{
 		VmaAllocationCreateInfo allocInfo = {};
 		allocInfo.usage = usage;
@@ -22,11 +22,17 @@ namespace Odyssey
 		else
 			allocInfo.flags |= VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT;
 
+		if (mappedData)
+			allocInfo.flags |= VMA_ALLOCATION_CREATE_MAPPED_BIT;
+
 		VmaAllocation allocation;
-		vmaCreateBuffer(s_Data->Allocator, &createInfo, &allocInfo, &outBuffer, &allocation, nullptr);
+		VmaAllocationInfo allocationInfo = {};
+		vmaCreateBuffer(s_Data->Allocator, &createInfo, &allocInfo, &outBuffer, &allocation, &allocationInfo);
 
 		if (allocation == nullptr)
 			Log::Error("Failed to allocate buffer");
+		else if (mappedData)
+			*mappedData = allocationInfo.pMappedData;
 
 		return allocation;
 	}
@@ -65,6 +71,17 @@ namespace Odyssey
 		vmaUnmapMemory(s_Data->Allocator, allocation);
 	}
 
+	void VulkanAllocator::Flush(VmaAllocation allocation, VkDeviceSize offset, VkDeviceSize size)
+	{
+		// Does nothing for host coherent memory
+		vmaFlushAllocation(s_Data->Allocator, allocation, offset, size);
+	}
+
+	void VulkanAllocator::Invalidate(VmaAllocation allocation, VkDeviceSize offset, VkDeviceSize size)
+	{
+		vmaInvalidateAllocation(s_Data->Allocator, allocation, offset, size);
+	}
+
 	void VulkanAllocator::Init(std::shared_ptr<VulkanContext> context)
 	{
 		s_Data = new VulkanAllocatorData();
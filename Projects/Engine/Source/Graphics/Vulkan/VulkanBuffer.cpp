@@ -82,9 +82,10 @@ namespace Odyssey
 		bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
 
 		bool cpuRead = bufferType == BufferType::Storage;
+		bool hostVisible = GetMemoryUsage(bufferType) == VMA_MEMORY_USAGE_CPU_TO_GPU;
 
 		VulkanAllocator allocator("Buffer");
-		m_MemoryAllocation = allocator.AllocateBuffer(bufferInfo, VMA_MEMORY_USAGE_AUTO, cpuRead, m_Buffer);
+		m_MemoryAllocation = allocator.AllocateBuffer(bufferInfo, VMA_MEMORY_USAGE_AUTO, cpuRead, m_Buffer, hostVisible ? (void**)&m_MappedData : nullptr);
 
 		if (bufferType == BufferType::Uniform || bufferType == BufferType::Storage)
 		{
@@ -101,44 +102,49 @@ namespace Odyssey
 
 		m_Buffer = nullptr;
 		m_MemoryAllocation = nullptr;
+		m_MappedData = nullptr;
 	}
 
-	void VulkanBuffer::CopyData(VkDeviceSize size, const void* data)
+	void VulkanBuffer::CopyData(VkDeviceSize size, const void* data, VkDeviceSize offset)
 	{
 		VulkanAllocator allocator("Buffer");
 
+		// Persistently mapped buffers skip the map and unmap entirely
+		if (m_MappedData)
+		{
+			memcpy(m_MappedData + offset, data, (size_t)size);
+			allocator.Flush(m_MemoryAllocation, offset, size);
+			return;
+		}
+
 		uint8_t* memData = allocator.MapMemory<uint8_t>(m_MemoryAllocation);
-		memcpy(memData, data, (size_t)size);
+		memcpy(memData + offset, data, (size_t)size);
 		allocator.UnmapMemory(m_MemoryAllocation);
 	}
 
-	void VulkanBuffer::UploadData(const void* data, VkDeviceSize size)
+	UploadToken VulkanBuffer::UploadData(const void* data, VkDeviceSize size)
 	{
-		// Write the vertices into the staging buffer
-		ResourceID stagingBufferID = ResourceManager::Allocate<VulkanBuffer>(BufferType::Staging, size);
-		Ref<VulkanBuffer> stagingBuffer = ResourceManager::GetResource<VulkanBuffer>(stagingBufferID);
-		stagingBuffer->CopyData(size, data);
-
-		// Copy the staging buffer into the vertex buffer
-		auto commandPool = ResourceManager::GetResource<VulkanCommandPool>(m_Context->GetGraphicsCommandPool());
-
-		ResourceID commandBufferID = commandPool->AllocateBuffer();
-		auto commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(commandBufferID);
-
-		commandBuffer->BeginCommands();
-		commandBuffer->CopyBufferToBuffer(stagingBufferID, m_ResourceID, size);
-		commandBuffer->EndCommands();
-
-		commandBuffer->SubmitGraphics();
-		commandPool->ReleaseBuffer(commandBufferID);
+		// Host visible buffers are written in place, there is nothing to wait on
+		if (m_MappedData)
+		{
+			CopyData(size, data);
+			return 0;
+		}
 
-		ResourceManager::Destroy(stagingBufferID);
+		return m_Context->GetUploadManager()->UploadBuffer(m_ResourceID, data, (size_t)size);
 	}
 
 	void VulkanBuffer::CopyBufferMemory(void* dst)
 	{
 		VulkanAllocator allocator("Buffer");
 
+		if (m_MappedData)
+		{
+			allocator.Invalidate(m_MemoryAllocation, 0, m_Size);
+			memcpy(dst, m_MappedData, (size_t)m_Size);
+			return;
+		}
+
 		uint8_t* memData = allocator.MapMemory<uint8_t>(m_MemoryAllocation);
 		memcpy(dst, memData, (size_t)m_Size);
 		allocator.UnmapMemory(m_MemoryAllocation);
@@ -152,6 +158,12 @@ namespace Odyssey
 		return vkGetBufferDeviceAddress(m_Context->GetDeviceVK(), &addressInfo);
 	}
 
+	void VulkanBuffer::Flush(VkDeviceSize offset, VkDeviceSize size)
+	{
+		VulkanAllocator allocator("Buffer");
+		allocator.Flush(m_MemoryAllocation, offset, size);
+	}
+
 	VkWriteDescriptorSet VulkanBuffer::GetDescriptorInfo()
 	{
 		assert(m_BufferType == BufferType::Uniform || m_BufferType == BufferType::Storage);
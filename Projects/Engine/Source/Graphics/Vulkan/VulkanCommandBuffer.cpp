@@ -10,6 +10,7 @@
 #include "ResourceManager.h"
 #include "VulkanDescriptorLayout.h"
 #include "VulkanPushDescriptors.h"
+#include "VulkanUploadManager.h"
 
 namespace Odyssey
 {
@@ -71,6 +72,9 @@ namespace Odyssey
 
 	void VulkanCommandBuffer::SubmitGraphics()
 	{
+		// Uploads recorded before this go out first so the commands can read them
+		m_Context->GetUploadManager()->Flush();
+
 		const uint64_t DEFAULT_FENCE_TIMEOUT = 100000000000;
 
 		VkSubmitInfo end_info = {};
@@ -97,6 +101,9 @@ namespace Odyssey
 
 	void VulkanCommandBuffer::SubmitCompute()
 	{
+		// The compute queue is not ordered behind the graphics handoff, so the uploads are waited on here
+		m_Context->GetUploadManager()->WaitIdle();
+
 		const uint64_t DEFAULT_FENCE_TIMEOUT = 100000000000;
 
 		VkSubmitInfo end_info = {};
@@ -168,7 +175,7 @@ namespace Odyssey
 		VkPipelineStageFlags srcStage;
 		VkPipelineStageFlags dstStage;
 
-		Ref<VulkanImage> image = ResourceManager::GetResource<VulkanImage>(imageID);
+		VulkanImage* image = ResourceManager::GetResource<VulkanImage>(imageID);
 
 		if (image->GetLayout() != newLayout)
 		{
@@ -178,7 +185,7 @@ namespace Odyssey
 		}
 	}
 
-	void VulkanCommandBuffer::CopyBufferToImage(ResourceID bufferID, ResourceID imageID, uint32_t width, uint32_t height)
+	void VulkanCommandBuffer::CopyBufferToImage(ResourceID bufferID, ResourceID imageID, uint32_t width, uint32_t height, bool generateMips)
 	{
 		TransitionLayouts(imageID, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
 
@@ -188,75 +195,67 @@ namespace Odyssey
 		auto copyRegions = image->GetBufferCopyRegions();
 		vkCmdCopyBufferToImage(m_CommandBuffer, buffer->m_Buffer, image->GetImage(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, (uint32_t)copyRegions.size(), copyRegions.data());
 
+		if (generateMips && image->GetMipLevels() > 1)
+			GenerateMips(imageID, width, height);
+		else
+			TransitionLayouts(imageID, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+	}
+
+	void VulkanCommandBuffer::GenerateMips(ResourceID imageID, uint32_t width, uint32_t height)
+	{
+		auto image = ResourceManager::GetResource<VulkanImage>(imageID);
 		uint32_t mipLevels = image->GetMipLevels();
 
-		if (mipLevels > 1)
+		VkImageMemoryBarrier barrier{};
+		barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		barrier.image = image->GetImage();
+		barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		barrier.subresourceRange.baseArrayLayer = 0;
+		barrier.subresourceRange.layerCount = 1;
+		barrier.subresourceRange.levelCount = 1;
+
+		int32_t mipWidth = (int32_t)width;
+		int32_t mipHeight = (int32_t)height;
+
+		for (uint32_t i = 1; i < mipLevels; i++)
 		{
-			VkImageMemoryBarrier barrier{};
-			barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-			barrier.image = image->GetImage();
-			barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-			barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-			barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-			barrier.subresourceRange.baseArrayLayer = 0;
-			barrier.subresourceRange.layerCount = 1;
-			barrier.subresourceRange.levelCount = 1;
-
-			int32_t mipWidth = (int32_t)width;
-			int32_t mipHeight = (int32_t)height;
-
-			for (uint32_t i = 1; i < mipLevels; i++)
-			{
-				barrier.subresourceRange.baseMipLevel = i - 1;
-				barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-				barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
-				barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-				barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
-
-				vkCmdPipelineBarrier(m_CommandBuffer,
-					VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
-					0, nullptr,
-					0, nullptr,
-					1, &barrier);
-
-				VkImageBlit blit{};
-				blit.srcOffsets[0] = { 0, 0, 0 };
-				blit.srcOffsets[1] = { mipWidth, mipHeight, 1 };
-				blit.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-				blit.srcSubresource.mipLevel = i - 1;
-				blit.srcSubresource.baseArrayLayer = 0;
-				blit.srcSubresource.layerCount = 1;
-				blit.dstOffsets[0] = { 0, 0, 0 };
-				blit.dstOffsets[1] = { mipWidth > 1 ? mipWidth / 2 : 1, mipHeight > 1 ? mipHeight / 2 : 1, 1 };
-				blit.dstSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-				blit.dstSubresource.mipLevel = i;
-				blit.dstSubresource.baseArrayLayer = 0;
-				blit.dstSubresource.layerCount = 1;
-
-				vkCmdBlitImage(m_CommandBuffer,
-					image->GetImage(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-					image->GetImage(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-					1, &blit,
-					VK_FILTER_LINEAR);
-
-				barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
-				barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-				barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
-				barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-
-				vkCmdPipelineBarrier(m_CommandBuffer,
-					VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
-					0, nullptr,
-					0, nullptr,
-					1, &barrier);
-
-				if (mipWidth > 1) mipWidth /= 2;
-				if (mipHeight > 1) mipHeight /= 2;
-			}
-			barrier.subresourceRange.baseMipLevel = mipLevels - 1;
+			barrier.subresourceRange.baseMipLevel = i - 1;
 			barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-			barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+			barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
 			barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+			barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+
+			vkCmdPipelineBarrier(m_CommandBuffer,
+				VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
+				0, nullptr,
+				0, nullptr,
+				1, &barrier);
+
+			VkImageBlit blit{};
+			blit.srcOffsets[0] = { 0, 0, 0 };
+			blit.srcOffsets[1] = { mipWidth, mipHeight, 1 };
+			blit.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+			blit.srcSubresource.mipLevel = i - 1;
+			blit.srcSubresource.baseArrayLayer = 0;
+			blit.srcSubresource.layerCount = 1;
+			blit.dstOffsets[0] = { 0, 0, 0 };
+			blit.dstOffsets[1] = { mipWidth > 1 ? mipWidth / 2 : 1, mipHeight > 1 ? mipHeight / 2 : 1, 1 };
+			blit.dstSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+			blit.dstSubresource.mipLevel = i;
+			blit.dstSubresource.baseArrayLayer = 0;
+			blit.dstSubresource.layerCount = 1;
+
+			vkCmdBlitImage(m_CommandBuffer,
+				image->GetImage(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+				image->GetImage(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+				1, &blit,
+				VK_FILTER_LINEAR);
+
+			barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+			barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+			barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
 			barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
 
 			vkCmdPipelineBarrier(m_CommandBuffer,
@@ -264,12 +263,22 @@ namespace Odyssey
 				0, nullptr,
 				0, nullptr,
 				1, &barrier);
-			image->SetLayout(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
-		}
-		else
-		{
-			TransitionLayouts(imageID, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
+			if (mipWidth > 1) mipWidth /= 2;
+			if (mipHeight > 1) mipHeight /= 2;
 		}
+		barrier.subresourceRange.baseMipLevel = mipLevels - 1;
+		barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+		barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+		barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+
+		vkCmdPipelineBarrier(m_CommandBuffer,
+			VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
+			0, nullptr,
+			0, nullptr,
+			1, &barrier);
+		image->SetLayout(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
 	}
 
 	void VulkanCommandBuffer::BindVertexBuffer(ResourceID vertexBufferID)
@@ -293,8 +302,8 @@ namespace Odyssey
 
 	void VulkanCommandBuffer::CopyImageToImage(ResourceID source, ResourceID destination)
 	{
-		Ref<VulkanImage> sourceImage = ResourceManager::GetResource<VulkanImage>(source);
-		Ref<VulkanImage> destinationImage = ResourceManager::GetResource<VulkanImage>(destination);
+		VulkanImage* sourceImage = ResourceManager::GetResource<VulkanImage>(source);
+		VulkanImage* destinationImage = ResourceManager::GetResource<VulkanImage>(destination);
 
 		VkImageLayout scrOriginalLayout = sourceImage->GetLayout();
 		TransitionLayouts(source, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
@@ -308,8 +317,8 @@ namespace Odyssey
 
 	void VulkanCommandBuffer::CopyImageToImage(ResourceID source, uint32_t srcMip, uint32_t srcSlice, ResourceID destination, uint32_t dstMip, uint32_t dstSlice, uint width, uint height)
 	{
-		Ref<VulkanImage> sourceImage = ResourceManager::GetResource<VulkanImage>(source);
-		Ref<VulkanImage> destinationImage = ResourceManager::GetResource<VulkanImage>(destination);
+		VulkanImage* sourceImage = ResourceManager::GetResource<VulkanImage>(source);
+		VulkanImage* destinationImage = ResourceManager::GetResource<VulkanImage>(destination);
 
 		VkImageLayout scrOriginalLayout = sourceImage->GetLayout();
 		TransitionLayouts(source, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
@@ -329,10 +338,11 @@ namespace Odyssey
 			destinationImage->GetImage(), destinationImage->GetLayout(), (uint32_t)copyRegions.size(), copyRegions.data());
 	}
 
-	void VulkanCommandBuffer::BindIndexBuffer(ResourceID indexBufferID)
+	void VulkanCommandBuffer::BindIndexBuffer(ResourceID indexBufferID, IndexType indexType)
 	{
 		auto indexBuffer = ResourceManager::GetResource<VulkanBuffer>(indexBufferID);
-		vkCmdBindIndexBuffer(m_CommandBuffer, indexBuffer->m_Buffer, 0, VK_INDEX_TYPE_UINT32);
+		VkIndexType vkIndexType = indexType == IndexType::UInt16 ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32;
+		vkCmdBindIndexBuffer(m_CommandBuffer, indexBuffer->m_Buffer, 0, vkIndexType);
 	}
 
 	void VulkanCommandBuffer::PushDescriptorsGraphics(VulkanPushDescriptors* descriptors, ResourceID pipelineID)
@@ -353,7 +363,7 @@ namespace Odyssey
 
 	void VulkanCommandBuffer::PushConstantsGraphics(ResourceID pipelineID, uint32_t offset, uint32_t size, const void* data)
 	{
-		Ref<VulkanGraphicsPipeline> pipeline = ResourceManager::GetResource<VulkanGraphicsPipeline>(pipelineID);
+		VulkanGraphicsPipeline* pipeline = ResourceManager::GetResource<VulkanGraphicsPipeline>(pipelineID);
 		vkCmdPushConstants(m_CommandBuffer, pipeline->GetLayout(), VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT, offset, size, data);
 	}
 
@@ -3,6 +3,7 @@
 #include "VulkanDevice.h"
 #include "VulkanCommandPool.h"
 #include "VulkanQueue.h"
+#include "VulkanUploadManager.h"
 #ifndef GLFW_INCLUDE_VULKAN
 #define GLFW_INCLUDE_VULKAN
 #endif
@@ -35,6 +36,9 @@ namespace Odyssey
 
 	void VulkanContext::Destroy()
 	{
+		m_UploadManager->Destroy();
+		m_UploadManager.reset();
+
 		ResourceManager::Destroy(m_GraphicsCommandPool);
 		ResourceManager::Destroy(m_ComputeCommandPool);
 	}
@@ -45,6 +49,8 @@ namespace Odyssey
 		m_ComputeCommandPool = ResourceManager::Allocate<VulkanCommandPool>(VulkanQueueType::Compute);
 		m_GraphicsQueue = std::make_shared<VulkanQueue>(VulkanQueueType::Graphics, VulkanContext::shared_from_this());
 		m_ComputeQueue = std::make_shared<VulkanQueue>(VulkanQueueType::Compute, VulkanContext::shared_from_this());
+		m_TransferQueue = std::make_shared<VulkanQueue>(VulkanQueueType::Transfer, VulkanContext::shared_from_this());
+		m_UploadManager = std::make_shared<VulkanUploadManager>(VulkanContext::shared_from_this());
 	}
 
 	VkPhysicalDevice VulkanContext::GetPhysicalDeviceVK()
@@ -67,6 +73,11 @@ namespace Odyssey
 		return m_ComputeQueue.get();
 	}
 
+	VulkanQueue* VulkanContext::GetTransferQueue()
+	{
+		return m_TransferQueue.get();
+	}
+
 	const VkQueue VulkanContext::GetGraphicsQueueVK()
 	{
 		return m_GraphicsQueue->queue;
@@ -77,6 +88,11 @@ namespace Odyssey
 		return m_ComputeQueue->queue;
 	}
 
+	const VkQueue VulkanContext::GetTransferQueueVK()
+	{
+		return m_TransferQueue->queue;
+	}
+
 	void VulkanContext::GatherExtensions()
 	{
 		if (glfwInit())
@@ -79,11 +79,24 @@ namespace Odyssey
 		}
 
 		const float queue_priority[] = { 1.0f };
-		VkDeviceQueueCreateInfo queue_info[1] = {};
-		queue_info[0].sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
-		queue_info[0].queueFamilyIndex = physicalDevice->GetFamilyIndex(VulkanQueueType::Graphics);
-		queue_info[0].queueCount = 1;
-		queue_info[0].pQueuePriorities = queue_priority;
+		std::vector<VkDeviceQueueCreateInfo> queue_info;
+
+		VkDeviceQueueCreateInfo& graphicsQueue = queue_info.emplace_back();
+		graphicsQueue.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+		graphicsQueue.queueFamilyIndex = physicalDevice->GetFamilyIndex(VulkanQueueType::Graphics);
+		graphicsQueue.queueCount = 1;
+		graphicsQueue.pQueuePriorities = queue_priority;
+
+		// Uploads get their own queue when the device has a dedicated transfer family
+		uint32_t transferFamily = physicalDevice->GetFamilyIndex(VulkanQueueType::Transfer);
+		if (transferFamily != graphicsQueue.queueFamilyIndex)
+		{
+			VkDeviceQueueCreateInfo& transferQueue = queue_info.emplace_back();
+			transferQueue.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+			transferQueue.queueFamilyIndex = transferFamily;
+			transferQueue.queueCount = 1;
+			transferQueue.pQueuePriorities = queue_priority;
+		}
 
 		VkPhysicalDeviceDynamicRenderingFeaturesKHR dynamicRendering{};
 		dynamicRendering.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR;
@@ -93,7 +106,12 @@ namespace Odyssey
 		bufferAddress.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES;
 		bufferAddress.bufferDeviceAddress = VK_TRUE;
 
+		VkPhysicalDeviceTimelineSemaphoreFeatures timelineSemaphore{};
+		timelineSemaphore.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES;
+		timelineSemaphore.timelineSemaphore = VK_TRUE;
+
 		dynamicRendering.pNext = &bufferAddress;
+		bufferAddress.pNext = &timelineSemaphore;
 
 		VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT unusedAttachments;
 
@@ -108,13 +126,14 @@ namespace Odyssey
 		VkPhysicalDeviceFeatures deviceFeatures{};
 		deviceFeatures.logicOp = true;
 		deviceFeatures.samplerAnisotropy = true;
+		deviceFeatures.textureCompressionBC = true;
 		deviceFeatures.geometryShader = true;
 		deviceFeatures.tessellationShader = true;
 
 		VkDeviceCreateInfo create_info = {};
 		create_info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
-		create_info.queueCreateInfoCount = sizeof(queue_info) / sizeof(queue_info[0]);
-		create_info.pQueueCreateInfos = queue_info;
+		create_info.queueCreateInfoCount = (uint32_t)queue_info.size();
+		create_info.pQueueCreateInfos = queue_info.data();
 		create_info.enabledExtensionCount = (uint32_t)device_extensions.size();
 		create_info.ppEnabledExtensionNames = device_extensions.data();
 		create_info.pNext = &dynamicRendering;
@@ -132,7 +132,7 @@ namespace Odyssey
 
 		if (info.AttributeDescriptions.GetSize() > 0)
 		{
-			VkVertexInputBindingDescription bindingDescription = Vertex::GetBindingDescription();
+			VkVertexInputBindingDescription bindingDescription = PackedVertex::GetBindingDescription();
 			vertexInputInfo.vertexBindingDescriptionCount = 1;
 			vertexInputInfo.pVertexBindingDescriptions = &bindingDescription;
 
@@ -7,6 +7,7 @@
 #include <Log.h>
 #include "ResourceManager.h"
 #include "VulkanBuffer.h"
+#include "VulkanUploadManager.h"
 
 namespace Odyssey
 {
@@ -182,13 +183,8 @@ namespace Odyssey
 		imageView = VK_NULL_HANDLE;
 	}
 
-	void VulkanImage::SetData(BinaryBuffer& buffer)
+	UploadToken VulkanImage::SetData(BinaryBuffer& buffer)
 	{
-		// Set the staging buffer's memory
-		ResourceID stagingBufferID = ResourceManager::Allocate<VulkanBuffer>(BufferType::Staging, buffer.GetSize());
-		Ref<VulkanBuffer> stagingBuffer = ResourceManager::GetResource<VulkanBuffer>(stagingBufferID);
-		stagingBuffer->CopyData(buffer.GetSize(), buffer.GetData().data());
-
 		// Generate a copy region for this new set of data
 		VkBufferImageCopy bufferCopyRegion = {};
 		bufferCopyRegion.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
@@ -204,31 +200,14 @@ namespace Odyssey
 		m_CopyRegions.clear();
 		m_CopyRegions.push_back(bufferCopyRegion);
 
-		// Allocate a command buffer
-		ResourceID commandPoolID = m_Context->GetGraphicsCommandPool();
-		auto commandPool = ResourceManager::GetResource<VulkanCommandPool>(commandPoolID);
-		ResourceID commandBufferID = commandPool->AllocateBuffer();
-		auto commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(commandBufferID);
-
-		// Copy the buffer into the image
-		commandBuffer->BeginCommands();
-		commandBuffer->CopyBufferToImage(stagingBufferID, m_ResourceID, m_ImageDesc.Width, m_ImageDesc.Height);
-		commandBuffer->EndCommands();
-		commandBuffer->SubmitGraphics();
-
-		commandPool->ReleaseBuffer(commandBufferID);
-		ResourceManager::Destroy(stagingBufferID);
+		// Copied with the next upload batch, mips are generated once it reaches the graphics queue
+		return m_Context->GetUploadManager()->UploadImage(m_ResourceID, buffer.GetData().data(), buffer.GetSize(), m_CopyRegions, true);
 	}
 
-	void VulkanImage::SetData(BinaryBuffer& buffer, size_t arrayDepth)
+	UploadToken VulkanImage::SetData(BinaryBuffer& buffer, size_t arrayDepth)
 	{
 		size_t offset = buffer.GetSize() / arrayDepth;
 
-		// Set the staging buffer's memory
-		ResourceID stagingBufferID = ResourceManager::Allocate<VulkanBuffer>(BufferType::Staging, buffer.GetSize());
-		Ref<VulkanBuffer> stagingBuffer = ResourceManager::GetResource<VulkanBuffer>(stagingBufferID);
-		stagingBuffer->CopyData(buffer.GetSize(), buffer.GetData().data());
-
 		// Generate a copy region for this new set of data
 		for (size_t i = 0; i < arrayDepth; i++)
 		{
@@ -246,19 +225,36 @@ namespace Odyssey
 			m_CopyRegions.push_back(bufferCopyRegion);
 		}
 
-		// Allocate a command buffer
-		Ref<VulkanCommandPool> commandPool = ResourceManager::GetResource<VulkanCommandPool>(m_Context->GetGraphicsCommandPool());
-		ResourceID commandBufferID = commandPool->AllocateBuffer();
-		Ref<VulkanCommandBuffer> commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(commandBufferID);
+		return m_Context->GetUploadManager()->UploadImage(m_ResourceID, buffer.GetData().data(), buffer.GetSize(), m_CopyRegions, true);
+	}
+
+	UploadToken VulkanImage::SetMipData(BinaryBuffer& buffer, const std::vector<size_t>& mipOffsets)
+	{
+		// Only the mips the image was created with are uploaded, the cooked chain may hold more
+		uint32_t mipLevels = std::min(m_MipLevels, (uint32_t)mipOffsets.size());
+		size_t uploadSize = mipLevels < mipOffsets.size() ? mipOffsets[mipLevels] : buffer.GetSize();
+
+		// Generate a copy region for each mip level
+		m_CopyRegions.clear();
+
+		for (uint32_t i = 0; i < mipLevels; i++)
+		{
+			VkBufferImageCopy bufferCopyRegion = {};
+			bufferCopyRegion.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+			bufferCopyRegion.imageSubresource.mipLevel = i;
+			bufferCopyRegion.imageSubresource.baseArrayLayer = 0;
+			bufferCopyRegion.imageSubresource.layerCount = 1;
+			bufferCopyRegion.imageExtent.width = std::max(m_ImageDesc.Width >> i, 1u);
+			bufferCopyRegion.imageExtent.height = std::max(m_ImageDesc.Height >> i, 1u);
+			bufferCopyRegion.imageExtent.depth = 1;
+			bufferCopyRegion.imageOffset = { 0, 0, 0 };
+			bufferCopyRegion.bufferOffset = mipOffsets[i];
 
-		// Copy the buffer into the image
-		commandBuffer->BeginCommands();
-		commandBuffer->CopyBufferToImage(stagingBufferID, m_ResourceID, m_ImageDesc.Width, m_ImageDesc.Height);
-		commandBuffer->EndCommands();
-		commandBuffer->SubmitGraphics();
-		commandPool->ReleaseBuffer(commandBufferID);
+			m_CopyRegions.push_back(bufferCopyRegion);
+		}
 
-		ResourceManager::Destroy(stagingBufferID);
+		// The mips are already in the buffer so there is nothing to generate
+		return m_Context->GetUploadManager()->UploadImage(m_ResourceID, buffer.GetData().data(), uploadSize, m_CopyRegions, false);
 	}
 
 	VkImageMemoryBarrier VulkanImage::CreateMemoryBarrier(ResourceID imageID, VkImageLayout oldLayout, VkImageLayout newLayout, VkPipelineStageFlags& srcStage, VkPipelineStageFlags& dstStage)
@@ -513,6 +509,14 @@ namespace Odyssey
 				return VK_FORMAT_R32G32B32A32_SFLOAT;
 			case TextureFormat::R16G16_SFLOAT:
 				return VK_FORMAT_R16G16_SFLOAT;
+			case TextureFormat::BC1_RGB_UNORM:
+				return VK_FORMAT_BC1_RGB_UNORM_BLOCK;
+			case TextureFormat::BC3_UNORM:
+				return VK_FORMAT_BC3_UNORM_BLOCK;
+			case TextureFormat::BC5_UNORM:
+				return VK_FORMAT_BC5_UNORM_BLOCK;
+			case TextureFormat::BC7_UNORM:
+				return VK_FORMAT_BC7_UNORM_BLOCK;
 			case TextureFormat::D24_UNORM_S8_UINT:
 				return VK_FORMAT_D24_UNORM_S8_UINT;
 			case TextureFormat::D16_UNORM:
@@ -132,22 +132,22 @@ namespace Odyssey
 
 	uint64_t VulkanImgui::AddRenderTexture(ResourceID renderTextureID, ResourceID samplerID)
 	{
-		Ref<RenderTarget> renderTarget = ResourceManager::GetResource<RenderTarget>(renderTextureID);
+		RenderTarget* renderTarget = ResourceManager::GetResource<RenderTarget>(renderTextureID);
 
-		Ref<VulkanImage> image;
+		VulkanImage* image = nullptr;
 
 		if (renderTarget->GetColorResolveTexture().IsValid())
 		{
-			Ref<VulkanTexture> texture = ResourceManager::GetResource<VulkanTexture>(renderTarget->GetColorResolveTexture());
+			VulkanTexture* texture = ResourceManager::GetResource<VulkanTexture>(renderTarget->GetColorResolveTexture());
 			image = ResourceManager::GetResource<VulkanImage>(texture->GetImage());
 		}
 		else
 		{
-			Ref<VulkanTexture> texture = ResourceManager::GetResource<VulkanTexture>(renderTarget->GetColorTexture());
+			VulkanTexture* texture = ResourceManager::GetResource<VulkanTexture>(renderTarget->GetColorTexture());
 			image = ResourceManager::GetResource<VulkanImage>(texture->GetImage());
 		}
 
-		Ref<VulkanTextureSampler> sampler = ResourceManager::GetResource<VulkanTextureSampler>(samplerID);
+		VulkanTextureSampler* sampler = ResourceManager::GetResource<VulkanTextureSampler>(samplerID);
 
 		VkSampler samplerVk = sampler->GetSamplerVK();
 		VkImageView view = image->GetImageView();
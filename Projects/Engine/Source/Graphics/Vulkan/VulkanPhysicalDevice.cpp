@@ -123,6 +123,21 @@ namespace Odyssey
 
 		}
 
+		// Prefer a transfer-only family, those map to the copy engines and run alongside graphics work
+		for (uint32_t i = 0; i < count; i++)
+		{
+			VkQueueFlags flags = queues[i].queueFlags;
+			if ((flags & VK_QUEUE_TRANSFER_BIT) && !(flags & VK_QUEUE_GRAPHICS_BIT) && !(flags & VK_QUEUE_COMPUTE_BIT))
+			{
+				indices.transferFamily = i;
+				break;
+			}
+		}
+
+		// Graphics queues can always transfer, so fall back to sharing the graphics family
+		if (!indices.transferFamily.has_value())
+			indices.transferFamily = indices.graphicsFamily;
+
 		free(queues);
 		assert(indices.graphicsFamily.has_value());
 		assert(indices.computeFamily.has_value());
@@ -147,7 +162,7 @@ namespace Odyssey
 			case VulkanQueueType::Compute:
 				return indices.computeFamily.value();
 			case VulkanQueueType::Transfer:
-				break;
+				return indices.transferFamily.value();
 			default:
 				break;
 		}
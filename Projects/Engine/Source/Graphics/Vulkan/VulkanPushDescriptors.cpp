@@ -14,6 +14,20 @@ namespace Odyssey
 			int d = 0;
 	}
 
+	void VulkanPushDescriptors::AddBuffer(const RingAllocation& allocation, uint32_t bindingIndex)
+	{
+		auto buffer = ResourceManager::GetResource<VulkanBuffer>(allocation.Buffer);
+
+		VkDescriptorBufferInfo& bufferRange = m_BufferRanges.emplace_back();
+		bufferRange.buffer = buffer->m_Buffer;
+		bufferRange.offset = allocation.Offset;
+		bufferRange.range = allocation.Size;
+
+		VkWriteDescriptorSet& writeSet = m_WriteDescriptors.emplace_back(buffer->GetDescriptorInfo());
+		writeSet.dstBinding = bindingIndex;
+		writeSet.pBufferInfo = &bufferRange;
+	}
+
 	void VulkanPushDescriptors::AddTexture(ResourceID textureID, uint32_t bindingIndex)
 	{
 		auto texture = ResourceManager::GetResource<VulkanTexture>(textureID);
@@ -23,8 +37,20 @@ namespace Odyssey
 			int d = 0;
 	}
 
+	void VulkanPushDescriptors::RemoveLast()
+	{
+		if (m_WriteDescriptors.size() > 0)
+		{
+			if (m_BufferRanges.size() > 0 && m_WriteDescriptors.back().pBufferInfo == &m_BufferRanges.back())
+				m_BufferRanges.pop_back();
+
+			m_WriteDescriptors.pop_back();
+		}
+	}
+
 	void VulkanPushDescriptors::Clear()
 	{
 		m_WriteDescriptors.clear();
+		m_BufferRanges.clear();
 	}
 }
\ No newline at end of file
@@ -44,11 +44,14 @@ namespace Odyssey
 		// Drawing
 		SetupFrameData();
 
+		// Per-frame uniforms are sub-allocated from one ring shared by every render scene
+		m_UniformRing = std::make_shared<VulkanRingBuffer>(m_Context, BufferType::Uniform, Uniform_Ring_Frame_Size, (uint32_t)m_Frames.size());
+
 		// Render scenes
 		m_RenderScenes.resize(m_Frames.size());
 		for (int i = 0; i < m_RenderScenes.size(); i++)
 		{
-			m_RenderScenes[i] = std::make_shared<RenderScene>();
+			m_RenderScenes[i] = std::make_shared<RenderScene>(m_UniformRing);
 		}
 
 		for (int i = 0; i < m_Frames.size(); ++i)
@@ -65,9 +68,9 @@ namespace Odyssey
 		}
 
 
-		Ref<VulkanCommandPool> commandPool = ResourceManager::GetResource<VulkanCommandPool>(m_Context->GetGraphicsCommandPool());
+		VulkanCommandPool* commandPool = ResourceManager::GetResource<VulkanCommandPool>(m_Context->GetGraphicsCommandPool());
 		ResourceID commandBufferID = commandPool->AllocateBuffer();
-		Ref<VulkanCommandBuffer> commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(commandBufferID);
+		VulkanCommandBuffer* commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(commandBufferID);
 
 		RenderPassParams params;
 		params.GraphicsCommandBuffer = commandBufferID;
@@ -98,6 +101,8 @@ namespace Odyssey
 		}
 
 		m_Frames.clear();
+		m_UniformRing->Destroy();
+		m_UniformRing.reset();
 		m_Swapchain.reset();
 		m_Window.reset();
 
@@ -208,20 +213,20 @@ namespace Odyssey
 		}
 
 		// Allocate a command buffer
-		Ref<VulkanCommandPool> commandPool = ResourceManager::GetResource<VulkanCommandPool>(m_Context->GetGraphicsCommandPool());
+		VulkanCommandPool* commandPool = ResourceManager::GetResource<VulkanCommandPool>(m_Context->GetGraphicsCommandPool());
 		ResourceID commandBufferID = commandPool->AllocateBuffer();
-		Ref<VulkanCommandBuffer> commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(commandBufferID);
+		VulkanCommandBuffer* commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(commandBufferID);
 
 		commandBuffer->BeginCommands();
 
 		// Transition the swapchain image back to a format for writing
-		Ref<RenderTarget> renderTarget = ResourceManager::GetResource<RenderTarget>(frame.GetFrameTexture());
-		Ref<VulkanTexture> colorTexture = ResourceManager::GetResource<VulkanTexture>(renderTarget->GetColorTexture());
+		RenderTarget* renderTarget = ResourceManager::GetResource<RenderTarget>(frame.GetFrameTexture());
+		VulkanTexture* colorTexture = ResourceManager::GetResource<VulkanTexture>(renderTarget->GetColorTexture());
 		commandBuffer->TransitionLayouts(colorTexture->GetImage(), VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
 
 		if (renderTarget->GetColorResolveTexture().IsValid())
 		{
-			Ref<VulkanTexture> resolveTexture = ResourceManager::GetResource<VulkanTexture>(renderTarget->GetColorResolveTexture());
+			VulkanTexture* resolveTexture = ResourceManager::GetResource<VulkanTexture>(renderTarget->GetColorResolveTexture());
 			commandBuffer->TransitionLayouts(resolveTexture->GetImage(), VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
 		}
 
@@ -241,10 +246,17 @@ namespace Odyssey
 			unsigned int width = m_Window->GetSurface()->GetWidth();
 			unsigned int height = m_Window->GetSurface()->GetHeight();
 
+			// The previous use of this frame's ring region has retired by now
+			m_UniformRing->BeginFrame(s_FrameIndex);
+
 			if (Scene* scene = SceneManager::GetActiveScene())
 			{
 				m_RenderScenes[s_FrameIndex]->ConvertScene(scene);
 			}
+			else
+			{
+				m_RenderScenes[s_FrameIndex]->ClearSceneData();
+			}
 
 			// RenderPass begin
 			m_RenderingData->frame = frame;
@@ -273,9 +285,9 @@ namespace Odyssey
 
 			for (Ref<RenderPass>& renderPass : m_RenderPasses)
 			{
-				Ref<VulkanCommandPool> commandPool = ResourceManager::GetResource<VulkanCommandPool>(m_Context->GetGraphicsCommandPool());
+				VulkanCommandPool* commandPool = ResourceManager::GetResource<VulkanCommandPool>(m_Context->GetGraphicsCommandPool());
 				ResourceID commandBufferID = commandPool->AllocateBuffer();
-				Ref<VulkanCommandBuffer> commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(commandBufferID);
+				VulkanCommandBuffer* commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(commandBufferID);
 
 				params.GraphicsCommandBuffer = commandBufferID;
 				commandBuffer->BeginCommands();
@@ -291,9 +303,9 @@ namespace Odyssey
 			// IMGUI always renders last
 			if (m_IMGUIPass)
 			{
-				Ref<VulkanCommandPool> commandPool = ResourceManager::GetResource<VulkanCommandPool>(m_Context->GetGraphicsCommandPool());
+				VulkanCommandPool* commandPool = ResourceManager::GetResource<VulkanCommandPool>(m_Context->GetGraphicsCommandPool());
 				ResourceID commandBufferID = commandPool->AllocateBuffer();
-				Ref<VulkanCommandBuffer> commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(commandBufferID);
+				VulkanCommandBuffer* commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(commandBufferID);
 				
 				params.GraphicsCommandBuffer = commandBufferID;
 				commandBuffer->BeginCommands();
@@ -306,23 +318,23 @@ namespace Odyssey
 				commandPool->ReleaseBuffer(commandBufferID);
 			}
 
-			Ref<RenderTarget> renderTarget = ResourceManager::GetResource<RenderTarget>(frame->GetFrameTexture());
+			RenderTarget* renderTarget = ResourceManager::GetResource<RenderTarget>(frame->GetFrameTexture());
 
 			// Allocate a command buffer
-			Ref<VulkanCommandPool> commandPool = ResourceManager::GetResource<VulkanCommandPool>(m_Context->GetGraphicsCommandPool());
+			VulkanCommandPool* commandPool = ResourceManager::GetResource<VulkanCommandPool>(m_Context->GetGraphicsCommandPool());
 			ResourceID commandBufferID = commandPool->AllocateBuffer();
-			Ref<VulkanCommandBuffer> commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(commandBufferID);
+			VulkanCommandBuffer* commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(commandBufferID);
 
 			commandBuffer->BeginCommands();
 
 			if (renderTarget->GetColorResolveTexture().IsValid())
 			{
-				Ref<VulkanTexture> resolveTexture = ResourceManager::GetResource<VulkanTexture>(renderTarget->GetColorResolveTexture());
+				VulkanTexture* resolveTexture = ResourceManager::GetResource<VulkanTexture>(renderTarget->GetColorResolveTexture());
 				commandBuffer->TransitionLayouts(resolveTexture->GetImage(), VK_IMAGE_LAYOUT_PRESENT_SRC_KHR);
 			}
 			else
 			{
-				Ref<VulkanTexture> colorTexture = ResourceManager::GetResource<VulkanTexture>(renderTarget->GetColorTexture());
+				VulkanTexture* colorTexture = ResourceManager::GetResource<VulkanTexture>(renderTarget->GetColorTexture());
 				commandBuffer->TransitionLayouts(colorTexture->GetImage(), VK_IMAGE_LAYOUT_PRESENT_SRC_KHR);
 			}
 
@@ -424,7 +436,7 @@ namespace Odyssey
 		{
 			if (renderScene->SkyboxCubemap.IsValid())
 			{
-				Ref<VulkanTexture> skybox = ResourceManager::GetResource<VulkanTexture>(renderScene->SkyboxCubemap);
+				VulkanTexture* skybox = ResourceManager::GetResource<VulkanTexture>(renderScene->SkyboxCubemap);
 
 				VulkanImageDescription textureDesc;
 				textureDesc.ImageType = ImageType::Cubemap;
@@ -440,9 +452,9 @@ namespace Odyssey
 
 				m_IrradianceCubemap = ResourceManager::Allocate<VulkanTexture>(textureDesc, nullptr);
 
-				Ref<VulkanCommandPool> commandPool = ResourceManager::GetResource<VulkanCommandPool>(m_Context->GetGraphicsCommandPool());
+				VulkanCommandPool* commandPool = ResourceManager::GetResource<VulkanCommandPool>(m_Context->GetGraphicsCommandPool());
 				ResourceID commandBufferID = commandPool->AllocateBuffer();
-				Ref<VulkanCommandBuffer> commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(commandBufferID);
+				VulkanCommandBuffer* commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(commandBufferID);
 
 				commandBuffer->BeginCommands();
 				params.GraphicsCommandBuffer = commandBufferID;
@@ -463,7 +475,7 @@ namespace Odyssey
 		{
 			if (renderScene->SkyboxCubemap.IsValid())
 			{
-				Ref<VulkanTexture> skybox = ResourceManager::GetResource<VulkanTexture>(renderScene->SkyboxCubemap);
+				VulkanTexture* skybox = ResourceManager::GetResource<VulkanTexture>(renderScene->SkyboxCubemap);
 
 				VulkanImageDescription textureDesc;
 				textureDesc.ImageType = ImageType::Cubemap;
@@ -479,9 +491,9 @@ namespace Odyssey
 
 				m_PrefilteredCubemap = ResourceManager::Allocate<VulkanTexture>(textureDesc, nullptr);
 
-				Ref<VulkanCommandPool> commandPool = ResourceManager::GetResource<VulkanCommandPool>(m_Context->GetGraphicsCommandPool());
+				VulkanCommandPool* commandPool = ResourceManager::GetResource<VulkanCommandPool>(m_Context->GetGraphicsCommandPool());
 				ResourceID commandBufferID = commandPool->AllocateBuffer();
-				Ref<VulkanCommandBuffer> commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(commandBufferID);
+				VulkanCommandBuffer* commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(commandBufferID);
 
 				commandBuffer->BeginCommands();
 				params.GraphicsCommandBuffer = commandBufferID;
@@ -0,0 +1,91 @@
+#include "VulkanRingBuffer.h"
+#include "VulkanBuffer.h"
+#include "VulkanContext.h"
+#include "ResourceManager.h"
+#include "volk.h"
+
+namespace Odyssey
+{
+	VulkanRingBuffer::VulkanRingBuffer(std::shared_ptr<VulkanContext> context, BufferType bufferType, uint32_t frameSize, uint32_t frameCount)
+		: m_Context(context), m_BufferType(bufferType), m_FrameCount(frameCount)
+	{
+		VkPhysicalDeviceProperties properties;
+		vkGetPhysicalDeviceProperties(m_Context->GetPhysicalDeviceVK(), &properties);
+
+		// Every sub-allocation is bound by offset, so each one has to start on the device's alignment
+		if (bufferType == BufferType::Uniform)
+		{
+			m_Alignment = (uint32_t)properties.limits.minUniformBufferOffsetAlignment;
+			m_MaxRange = properties.limits.maxUniformBufferRange;
+		}
+		else
+		{
+			m_Alignment = (uint32_t)properties.limits.minStorageBufferOffsetAlignment;
+			m_MaxRange = properties.limits.maxStorageBufferRange;
+		}
+
+		m_Alignment = std::max(m_Alignment, 16u);
+		m_FrameSize = Align(frameSize);
+		CreateBuffer();
+	}
+
+	void VulkanRingBuffer::Destroy()
+	{
+		ResourceManager::Destroy(m_Buffer);
+		m_Buffer = ResourceID::Invalid();
+		m_MappedData = nullptr;
+	}
+
+	void VulkanRingBuffer::BeginFrame(uint32_t frameIndex)
+	{
+		m_FrameIndex = frameIndex % m_FrameCount;
+		m_Head = 0;
+	}
+
+	RingAllocation VulkanRingBuffer::Allocate(uint32_t size)
+	{
+		if (size > m_MaxRange)
+		{
+			Log::Error("[VulkanRingBuffer] Allocation of " + std::to_string(size) + " bytes is larger than the device allows to be bound.");
+			return RingAllocation();
+		}
+
+		uint32_t alignedSize = Align(size);
+
+		if (m_Head + alignedSize > m_FrameSize)
+		{
+			// Out of space for this frame, double every region in a new buffer
+			// The old buffer goes through the resource manager so earlier allocations stay readable until the frame retires
+			Log::Warning("[VulkanRingBuffer] Frame region is full, growing to " + std::to_string(m_FrameSize * 2) + " bytes per frame.");
+
+			ResourceManager::Destroy(m_Buffer);
+			m_FrameSize = std::max(m_FrameSize * 2, alignedSize);
+			m_Head = 0;
+			CreateBuffer();
+		}
+
+		RingAllocation allocation;
+		allocation.Buffer = m_Buffer;
+		allocation.Offset = m_FrameIndex * m_FrameSize + m_Head;
+		allocation.Size = size;
+		allocation.Data = m_MappedData + allocation.Offset;
+
+		m_Head += alignedSize;
+		return allocation;
+	}
+
+	void VulkanRingBuffer::Flush(const RingAllocation& allocation)
+	{
+		if (VulkanBuffer* buffer = ResourceManager::GetResource<VulkanBuffer>(allocation.Buffer))
+			buffer->Flush(allocation.Offset, allocation.Size);
+	}
+
+	void VulkanRingBuffer::CreateBuffer()
+	{
+		m_Buffer = ResourceManager::Allocate<VulkanBuffer>(m_BufferType, (VkDeviceSize)m_FrameSize * m_FrameCount);
+
+		VulkanBuffer* buffer = ResourceManager::GetResource<VulkanBuffer>(m_Buffer);
+		m_MappedData = buffer->GetMappedData();
+		assert(m_MappedData);
+	}
+}
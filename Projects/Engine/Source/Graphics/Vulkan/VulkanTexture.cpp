@@ -17,7 +17,7 @@ namespace Odyssey
 		return desc.ImageType == ImageType::RenderTexture || desc.ImageType == ImageType::DepthTexture || desc.ImageType == ImageType::Shadowmap;
 	}
 
-	VulkanTexture::VulkanTexture(ResourceID id, std::shared_ptr<VulkanContext> context, VulkanImageDescription description, BinaryBuffer* buffer)
+	VulkanTexture::VulkanTexture(ResourceID id, std::shared_ptr<VulkanContext> context, VulkanImageDescription description, BinaryBuffer* buffer, std::vector<size_t> mipOffsets)
 		: Resource(id)
 	{
 		m_Context = context;
@@ -27,7 +27,10 @@ namespace Odyssey
 		m_Image = ResourceManager::Allocate<VulkanImage>(description);
 		auto image = ResourceManager::GetResource<VulkanImage>(m_Image);
 
-		if (buffer)
+		// Cooked textures carry their own mip chain
+		if (buffer && mipOffsets.size() > 0)
+			image->SetMipData(*buffer, mipOffsets);
+		else if (buffer)
 			image->SetData(*buffer, description.ArrayDepth);
 
 		// Create a sampler
@@ -69,7 +72,7 @@ namespace Odyssey
 		: Resource(id)
 	{
 		m_Context = context;
-		if (Ref<VulkanImage> image = ResourceManager::GetResource<VulkanImage>(imageID))
+		if (VulkanImage* image = ResourceManager::GetResource<VulkanImage>(imageID))
 		{
 			m_Description.Width = image->GetWidth();
 			m_Description.Height = image->GetHeight();
@@ -86,7 +89,7 @@ namespace Odyssey
 
 	VkWriteDescriptorSet VulkanTexture::GetDescriptorInfo()
 	{
-		Ref<VulkanImage> image = ResourceManager::GetResource<VulkanImage>(m_Image);
+		VulkanImage* image = ResourceManager::GetResource<VulkanImage>(m_Image);
 		descriptor.imageLayout = image->GetLayout();
 		
 		VkWriteDescriptorSet writeSet{};
@@ -102,9 +105,9 @@ namespace Odyssey
 	void VulkanTexture::CopyToTexture(ResourceID destination)
 	{
 		// Allocate a command buffer
-		Ref<VulkanCommandPool> commandPool = ResourceManager::GetResource<VulkanCommandPool>(m_Context->GetGraphicsCommandPool());
+		VulkanCommandPool* commandPool = ResourceManager::GetResource<VulkanCommandPool>(m_Context->GetGraphicsCommandPool());
 		ResourceID commandBufferID = commandPool->AllocateBuffer();
-		Ref<VulkanCommandBuffer> commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(commandBufferID);
+		VulkanCommandBuffer* commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(commandBufferID);
 
 		// Copy the buffer into the image
 		commandBuffer->BeginCommands();
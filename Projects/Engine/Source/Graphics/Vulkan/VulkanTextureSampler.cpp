@@ -39,7 +39,7 @@ namespace Odyssey
 	{
 		m_Context = context;
 
-		Ref<VulkanImage> image = ResourceManager::GetResource<VulkanImage>(imageID);
+		VulkanImage* image = ResourceManager::GetResource<VulkanImage>(imageID);
 
 		VkSamplerCreateInfo samplerInfo{};
 		samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
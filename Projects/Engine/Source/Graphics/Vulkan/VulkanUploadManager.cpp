@@ -0,0 +1,421 @@
+#include "VulkanUploadManager.h"
+#include "VulkanContext.h"
+#include "VulkanPhysicalDevice.h"
+#include "VulkanBuffer.h"
+#include "VulkanImage.h"
+#include "VulkanCommandBuffer.h"
+#include "VulkanCommandPool.h"
+#include "ResourceManager.h"
+#include "volk.h"
+
+namespace Odyssey
+{
+	// Anything the engine reads uploaded data with once it reaches the graphics queue
+	inline static constexpr VkPipelineStageFlags Read_Stages = VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT |
+		VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT;
+
+	inline static constexpr VkAccessFlags Read_Access = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT |
+		VK_ACCESS_UNIFORM_READ_BIT | VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_TRANSFER_READ_BIT;
+
+	VulkanUploadManager::VulkanUploadManager(std::shared_ptr<VulkanContext> context)
+	{
+		m_Context = context;
+		m_GraphicsFamily = context->GetPhysicalDevice()->GetFamilyIndex(VulkanQueueType::Graphics);
+		m_TransferFamily = context->GetPhysicalDevice()->GetFamilyIndex(VulkanQueueType::Transfer);
+		m_DedicatedTransfer = m_TransferFamily != m_GraphicsFamily;
+
+		m_TransferCommandPool = ResourceManager::Allocate<VulkanCommandPool>(VulkanQueueType::Transfer);
+
+		VkSemaphoreTypeCreateInfo typeInfo{};
+		typeInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+		typeInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+		typeInfo.initialValue = 0;
+
+		VkSemaphoreCreateInfo semaphoreInfo{};
+		semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+		semaphoreInfo.pNext = &typeInfo;
+
+		VkResult err = vkCreateSemaphore(m_Context->GetDeviceVK(), &semaphoreInfo, allocator, &m_Timeline);
+		if (!check_vk_result(err))
+			Log::Error("[VulkanUploadManager] Failed to create the upload timeline semaphore.");
+
+		m_StagingBuffer = ResourceManager::Allocate<VulkanBuffer>(BufferType::Staging, Staging_Ring_Size);
+		m_StagingData = ResourceManager::GetResource<VulkanBuffer>(m_StagingBuffer)->GetMappedData();
+
+		Log::Info(std::format("[VulkanUploadManager] Uploading on {} queue family {}.",
+			m_DedicatedTransfer ? "dedicated transfer" : "graphics", m_TransferFamily));
+	}
+
+	void VulkanUploadManager::Destroy()
+	{
+		WaitIdle();
+
+		ResourceManager::Destroy(m_StagingBuffer);
+		ResourceManager::Destroy(m_TransferCommandPool);
+		vkDestroySemaphore(m_Context->GetDeviceVK(), m_Timeline, allocator);
+
+		m_StagingBuffer = ResourceID::Invalid();
+		m_StagingData = nullptr;
+		m_Timeline = VK_NULL_HANDLE;
+	}
+
+	UploadToken VulkanUploadManager::UploadBuffer(ResourceID destination, const void* data, size_t size, size_t offset)
+	{
+		if (size == 0)
+			return 0;
+
+		StagingAllocation staging = AllocateStaging(size);
+		memcpy(staging.Data, data, size);
+
+		BeginBatch();
+
+		VulkanBuffer* stagingBuffer = ResourceManager::GetResource<VulkanBuffer>(staging.Buffer);
+		VulkanBuffer* buffer = ResourceManager::GetResource<VulkanBuffer>(destination);
+		VulkanCommandBuffer* commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(m_TransferCommands);
+		stagingBuffer->Flush(staging.Offset, size);
+
+		VkBufferCopy region{};
+		region.srcOffset = staging.Offset;
+		region.dstOffset = offset;
+		region.size = size;
+		vkCmdCopyBuffer(commandBuffer->GetCommandBuffer(), stagingBuffer->m_Buffer, buffer->m_Buffer, 1, &region);
+
+		VkBufferMemoryBarrier& barrier = m_BufferBarriers.emplace_back();
+		barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+		barrier.srcQueueFamilyIndex = m_DedicatedTransfer ? m_TransferFamily : VK_QUEUE_FAMILY_IGNORED;
+		barrier.dstQueueFamilyIndex = m_DedicatedTransfer ? m_GraphicsFamily : VK_QUEUE_FAMILY_IGNORED;
+		barrier.buffer = buffer->m_Buffer;
+		barrier.offset = offset;
+		barrier.size = size;
+
+		return m_BatchValue;
+	}
+
+	UploadToken VulkanUploadManager::UploadImage(ResourceID destination, const void* data, size_t size, const std::vector<VkBufferImageCopy>& regions, bool generateMips)
+	{
+		StagingAllocation staging = AllocateStaging(size);
+		memcpy(staging.Data, data, size);
+
+		BeginBatch();
+
+		VulkanBuffer* stagingBuffer = ResourceManager::GetResource<VulkanBuffer>(staging.Buffer);
+		VulkanImage* image = ResourceManager::GetResource<VulkanImage>(destination);
+		VulkanCommandBuffer* commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(m_TransferCommands);
+		stagingBuffer->Flush(staging.Offset, size);
+
+		// The previous contents are replaced, so the image is taken from undefined without a release from its last queue
+		VkImageMemoryBarrier barrier{};
+		barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+		barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+		barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.srcAccessMask = 0;
+		barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		barrier.image = image->GetImage();
+		barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		barrier.subresourceRange.baseMipLevel = 0;
+		barrier.subresourceRange.levelCount = image->GetMipLevels();
+		barrier.subresourceRange.baseArrayLayer = 0;
+		barrier.subresourceRange.layerCount = image->GetArrayDepth();
+
+		vkCmdPipelineBarrier(commandBuffer->GetCommandBuffer(), VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+			0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+		// Regions are relative to the data, move them to where it landed in the staging buffer
+		std::vector<VkBufferImageCopy> stagingRegions = regions;
+		for (VkBufferImageCopy& region : stagingRegions)
+			region.bufferOffset += staging.Offset;
+
+		vkCmdCopyBufferToImage(commandBuffer->GetCommandBuffer(), stagingBuffer->m_Buffer, image->GetImage(),
+			VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, (uint32_t)stagingRegions.size(), stagingRegions.data());
+
+		PendingImage& pendingImage = m_PendingImages.emplace_back();
+		pendingImage.Image = destination;
+		pendingImage.GenerateMips = generateMips && image->GetMipLevels() > 1;
+
+		// Anything recorded from here on sees the image as it will be once the batch has run
+		image->SetLayout(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
+		return m_BatchValue;
+	}
+
+	void VulkanUploadManager::Flush()
+	{
+		if (!m_Recording)
+			return;
+
+		m_Recording = false;
+
+		UploadBatch& batch = m_InFlight.emplace_back();
+		batch.Value = m_BatchValue;
+		batch.StagingEnd = m_StagingHead;
+		batch.TransferCommands = m_TransferCommands;
+		batch.StagingBuffers = std::move(m_BatchStagingBuffers);
+		m_BatchStagingBuffers.clear();
+
+		VulkanCommandBuffer* transferCommands = ResourceManager::GetResource<VulkanCommandBuffer>(m_TransferCommands);
+
+		if (m_DedicatedTransfer)
+		{
+			// The copies signal the first value of the batch and release ownership to the graphics family
+			RecordHandoff(transferCommands->GetCommandBuffer(), Handoff::Release);
+			transferCommands->EndCommands();
+			Submit(m_Context->GetTransferQueueVK(), transferCommands->GetCommandBuffer(), 0, m_BatchValue - 1);
+
+			// The graphics queue waits on the copies and acquires them ahead of any work submitted after it
+			VulkanCommandPool* commandPool = ResourceManager::GetResource<VulkanCommandPool>(m_Context->GetGraphicsCommandPool());
+			batch.GraphicsCommands = commandPool->AllocateBuffer();
+
+			VulkanCommandBuffer* graphicsCommands = ResourceManager::GetResource<VulkanCommandBuffer>(batch.GraphicsCommands);
+			graphicsCommands->BeginCommands();
+			RecordHandoff(graphicsCommands->GetCommandBuffer(), Handoff::Acquire);
+			GenerateMips(batch.GraphicsCommands);
+			graphicsCommands->EndCommands();
+
+			Submit(m_Context->GetGraphicsQueueVK(), graphicsCommands->GetCommandBuffer(), m_BatchValue - 1, m_BatchValue);
+		}
+		else
+		{
+			// Sharing the graphics queue, so the copies are made visible and mipped in the same submission
+			RecordHandoff(transferCommands->GetCommandBuffer(), Handoff::Complete);
+			GenerateMips(m_TransferCommands);
+			transferCommands->EndCommands();
+			Submit(m_Context->GetTransferQueueVK(), transferCommands->GetCommandBuffer(), 0, m_BatchValue);
+		}
+
+		m_SubmittedValue = m_BatchValue;
+		m_TransferCommands = ResourceID::Invalid();
+		m_BufferBarriers.clear();
+		m_PendingImages.clear();
+
+		RetireBatches();
+	}
+
+	bool VulkanUploadManager::IsComplete(UploadToken token)
+	{
+		if (token <= m_CompletedValue)
+			return true;
+
+		if (token > m_SubmittedValue)
+			return false;
+
+		RetireBatches();
+		return token <= m_CompletedValue;
+	}
+
+	void VulkanUploadManager::Wait(UploadToken token)
+	{
+		WaitForValue(token);
+	}
+
+	void VulkanUploadManager::WaitIdle()
+	{
+		Flush();
+		WaitForValue(m_SubmittedValue);
+	}
+
+	void VulkanUploadManager::BeginBatch()
+	{
+		if (m_Recording)
+			return;
+
+		// The copies signal the first value and the handoff to graphics signals the second
+		m_NextValue += 2;
+		m_BatchValue = m_NextValue;
+		m_Recording = true;
+
+		VulkanCommandPool* commandPool = ResourceManager::GetResource<VulkanCommandPool>(m_TransferCommandPool);
+		m_TransferCommands = commandPool->AllocateBuffer();
+
+		VulkanCommandBuffer* commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(m_TransferCommands);
+		commandBuffer->BeginCommands();
+	}
+
+	VulkanUploadManager::StagingAllocation VulkanUploadManager::AllocateStaging(size_t size)
+	{
+		StagingAllocation allocation;
+
+		if (size > Staging_Ring_Size)
+		{
+			// Too large for the ring, the buffer is destroyed with the batch that uses it
+			Log::Warning(std::format("[VulkanUploadManager] Upload of {} bytes is larger than the staging ring.", size));
+
+			allocation.Buffer = ResourceManager::Allocate<VulkanBuffer>(BufferType::Staging, size);
+			allocation.Data = ResourceManager::GetResource<VulkanBuffer>(allocation.Buffer)->GetMappedData();
+			m_BatchStagingBuffers.push_back(allocation.Buffer);
+			return allocation;
+		}
+
+		uint64_t start = (m_StagingHead + Staging_Alignment - 1) & ~(Staging_Alignment - 1);
+
+		// Allocations never straddle the end of the ring, skip to the start instead
+		uint64_t ringOffset = start % Staging_Ring_Size;
+		if (ringOffset + size > Staging_Ring_Size)
+			start += Staging_Ring_Size - ringOffset;
+
+		// Only stalls when the ring is full of copies the GPU has not finished
+		while (start + size - m_StagingTail > Staging_Ring_Size)
+		{
+			RetireBatches();
+
+			if (m_InFlight.empty())
+			{
+				// Nothing submitted holds the ring, so the space can only belong to the batch being recorded
+				if (!m_Recording)
+				{
+					m_StagingTail = start;
+					break;
+				}
+
+				Flush();
+				continue;
+			}
+
+			WaitForValue(m_InFlight.front().Value);
+		}
+
+		m_StagingHead = start + size;
+
+		allocation.Buffer = m_StagingBuffer;
+		allocation.Offset = start % Staging_Ring_Size;
+		allocation.Data = m_StagingData + allocation.Offset;
+		return allocation;
+	}
+
+	void VulkanUploadManager::RetireBatches()
+	{
+		vkGetSemaphoreCounterValue(m_Context->GetDeviceVK(), m_Timeline, &m_CompletedValue);
+
+		while (m_InFlight.size() > 0 && m_InFlight.front().Value <= m_CompletedValue)
+		{
+			UploadBatch& batch = m_InFlight.front();
+
+			VulkanCommandPool* transferPool = ResourceManager::GetResource<VulkanCommandPool>(m_TransferCommandPool);
+			transferPool->ReleaseBuffer(batch.TransferCommands);
+
+			if (batch.GraphicsCommands.IsValid())
+			{
+				VulkanCommandPool* graphicsPool = ResourceManager::GetResource<VulkanCommandPool>(m_Context->GetGraphicsCommandPool());
+				graphicsPool->ReleaseBuffer(batch.GraphicsCommands);
+			}
+
+			for (ResourceID stagingBuffer : batch.StagingBuffers)
+				ResourceManager::Destroy(stagingBuffer);
+
+			m_StagingTail = batch.StagingEnd;
+			m_InFlight.pop_front();
+		}
+	}
+
+	void VulkanUploadManager::WaitForValue(uint64_t value)
+	{
+		if (value > m_SubmittedValue)
+			Flush();
+
+		if (value > m_CompletedValue)
+		{
+			VkSemaphoreWaitInfo waitInfo{};
+			waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+			waitInfo.semaphoreCount = 1;
+			waitInfo.pSemaphores = &m_Timeline;
+			waitInfo.pValues = &value;
+
+			VkResult err = vkWaitSemaphores(m_Context->GetDeviceVK(), &waitInfo, UINT64_MAX);
+			if (!check_vk_result(err))
+				Log::Error("[VulkanUploadManager] Failed to wait for uploads.");
+		}
+
+		RetireBatches();
+	}
+
+	void VulkanUploadManager::Submit(VkQueue queue, VkCommandBuffer commandBuffer, uint64_t waitValue, uint64_t signalValue)
+	{
+		bool wait = waitValue > 0;
+		VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+
+		VkTimelineSemaphoreSubmitInfo timelineInfo{};
+		timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+		timelineInfo.waitSemaphoreValueCount = wait ? 1 : 0;
+		timelineInfo.pWaitSemaphoreValues = wait ? &waitValue : nullptr;
+		timelineInfo.signalSemaphoreValueCount = 1;
+		timelineInfo.pSignalSemaphoreValues = &signalValue;
+
+		VkSubmitInfo submitInfo{};
+		submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+		submitInfo.pNext = &timelineInfo;
+		submitInfo.waitSemaphoreCount = wait ? 1 : 0;
+		submitInfo.pWaitSemaphores = wait ? &m_Timeline : nullptr;
+		submitInfo.pWaitDstStageMask = wait ? &waitStage : nullptr;
+		submitInfo.commandBufferCount = 1;
+		submitInfo.pCommandBuffers = &commandBuffer;
+		submitInfo.signalSemaphoreCount = 1;
+		submitInfo.pSignalSemaphores = &m_Timeline;
+
+		VkResult err = vkQueueSubmit(queue, 1, &submitInfo, VK_NULL_HANDLE);
+		if (!check_vk_result(err))
+			Log::Error("[VulkanUploadManager] Failed to submit uploads.");
+	}
+
+	void VulkanUploadManager::RecordHandoff(VkCommandBuffer commandBuffer, Handoff handoff)
+	{
+		if (m_BufferBarriers.empty() && m_PendingImages.empty())
+			return;
+
+		// Release only makes the copies available, acquire only makes them visible, complete does both on one queue
+		VkAccessFlags srcAccess = handoff == Handoff::Acquire ? 0 : VK_ACCESS_TRANSFER_WRITE_BIT;
+		VkPipelineStageFlags srcStage = handoff == Handoff::Acquire ? VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT : VK_PIPELINE_STAGE_TRANSFER_BIT;
+		VkPipelineStageFlags dstStage = handoff == Handoff::Release ? VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT : Read_Stages;
+
+		for (VkBufferMemoryBarrier& barrier : m_BufferBarriers)
+		{
+			barrier.srcAccessMask = srcAccess;
+			barrier.dstAccessMask = handoff == Handoff::Release ? 0 : Read_Access;
+		}
+
+		std::vector<VkImageMemoryBarrier> imageBarriers;
+		imageBarriers.reserve(m_PendingImages.size());
+
+		for (PendingImage& pendingImage : m_PendingImages)
+		{
+			VulkanImage* image = ResourceManager::GetResource<VulkanImage>(pendingImage.Image);
+
+			// Images that still need mips stay writable until their mips are generated
+			VkAccessFlags readAccess = pendingImage.GenerateMips ? VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT : Read_Access;
+
+			VkImageMemoryBarrier& barrier = imageBarriers.emplace_back();
+			barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+			barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+			barrier.newLayout = pendingImage.GenerateMips ? VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL : VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+			barrier.srcQueueFamilyIndex = m_DedicatedTransfer ? m_TransferFamily : VK_QUEUE_FAMILY_IGNORED;
+			barrier.dstQueueFamilyIndex = m_DedicatedTransfer ? m_GraphicsFamily : VK_QUEUE_FAMILY_IGNORED;
+			barrier.srcAccessMask = srcAccess;
+			barrier.dstAccessMask = handoff == Handoff::Release ? 0 : readAccess;
+			barrier.image = image->GetImage();
+			barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+			barrier.subresourceRange.baseMipLevel = 0;
+			barrier.subresourceRange.levelCount = image->GetMipLevels();
+			barrier.subresourceRange.baseArrayLayer = 0;
+			barrier.subresourceRange.layerCount = image->GetArrayDepth();
+		}
+
+		vkCmdPipelineBarrier(commandBuffer, srcStage, dstStage, 0,
+			0, nullptr,
+			(uint32_t)m_BufferBarriers.size(), m_BufferBarriers.data(),
+			(uint32_t)imageBarriers.size(), imageBarriers.data());
+	}
+
+	void VulkanUploadManager::GenerateMips(ResourceID commandBufferID)
+	{
+		VulkanCommandBuffer* commandBuffer = ResourceManager::GetResource<VulkanCommandBuffer>(commandBufferID);
+
+		for (PendingImage& pendingImage : m_PendingImages)
+		{
+			if (!pendingImage.GenerateMips)
+				continue;
+
+			VulkanImage* image = ResourceManager::GetResource<VulkanImage>(pendingImage.Image);
+			commandBuffer->GenerateMips(pendingImage.Image, image->GetWidth(), image->GetHeight());
+		}
+	}
+}
@@ -56,11 +56,15 @@ namespace Odyssey
 
 	void DirectoryListener::Dispatch()
 	{
-		Lock.Lock(LockState::Read);
-		for (auto& callback : PendingCallbacks)
+		// Take the callbacks out first so they are free to add or remove trackers
+		std::vector<std::function<void()>> callbacks;
+
+		Lock.Lock(LockState::Write);
+		callbacks.swap(PendingCallbacks);
+		Lock.Unlock(LockState::Write);
+
+		for (auto& callback : callbacks)
 			callback();
-		PendingCallbacks.clear();
-		Lock.Unlock(LockState::Read);
 	}
 
 	void DirectoryListener::handleFileAction(efsw::FileAction& fileAction)
@@ -95,7 +99,7 @@ namespace Odyssey
 			FolderTracker::Options& options = folderTracker.TrackingOptions;
 
 			bool extensionMatch = options.Extensions.size() == 0;
-			bool isDirectory = std::filesystem::is_directory(fileAction.Filename);
+			bool isDirectory = std::filesystem::is_directory(fullPath);
 
 			// Skip directory changes
 			if (isDirectory && !options.IncludeDirectoryChanges)
@@ -119,9 +123,12 @@ namespace Odyssey
 			{
 				// We queue up the callbacks since handleFileAction operates on a separate thread
 				// These callbacks are collected and executed on the main thread
-				std::function<void()> pendingCallback = [this, fileAction, folderTracker]()
+				// Folder trackers get full paths since the file may be in any sub-directory
+				Path oldPath = fileAction.OldFilename.empty() ? Path() : fileAction.Directory / fileAction.OldFilename;
+
+				std::function<void()> pendingCallback = [this, fileAction, folderTracker, oldPath, fullPath]()
 					{
-						folderTracker.TrackingOptions.Callback(fileAction.OldFilename, fileAction.Filename, (FileActionType)fileAction.Action);
+						folderTracker.TrackingOptions.Callback(oldPath, fullPath, (FileActionType)fileAction.Action);
 					};
 
 				Lock.Lock(LockState::Write);
@@ -159,6 +166,8 @@ namespace Odyssey
 		if (path.has_filename())
 			directory = path.parent_path();
 
+		m_Lock.Lock(LockState::Write);
+
 		if (!m_DirectoryListeners.contains(directory))
 		{
 			m_DirectoryListeners[directory] = new DirectoryListener(directory, false);
@@ -169,11 +178,17 @@ namespace Odyssey
 		m_DirectoryListeners[directory]->AddFileTracker(id, path, callback);
 		m_TrackedIDs[id] = path;
 
+		m_Lock.Unlock(LockState::Write);
+
 		return id;
 	}
 
 	bool FileManager::UntrackFile(TrackingID id)
 	{
+		bool untracked = false;
+
+		m_Lock.Lock(LockState::Write);
+
 		if (m_TrackedIDs.contains(id))
 		{
 			Path directory = m_TrackedIDs[id].parent_path();
@@ -182,15 +197,19 @@ namespace Odyssey
 			if (m_DirectoryListeners.contains(directory))
 			{
 				m_DirectoryListeners[directory]->RemoveFileTracker(id);
-				return true;
+				untracked = true;
 			}
 		}
 
-		return false;
+		m_Lock.Unlock(LockState::Write);
+
+		return untracked;
 	}
 
 	TrackingID FileManager::TrackFolder(const Path& folderPath, const FolderTracker::Options& options)
 	{
+		m_Lock.Lock(LockState::Write);
+
 		if (!m_DirectoryListeners.contains(folderPath))
 		{
 			m_DirectoryListeners[folderPath] = new DirectoryListener(folderPath, options.Recursive);
@@ -201,11 +220,17 @@ namespace Odyssey
 		m_DirectoryListeners[folderPath]->AddFolderTracker(id, folderPath, options);
 		m_TrackedIDs[id] = folderPath;
 
+		m_Lock.Unlock(LockState::Write);
+
 		return id;
 	}
 
 	bool FileManager::UntrackFolder(TrackingID id)
 	{
+		bool untracked = false;
+
+		m_Lock.Lock(LockState::Write);
+
 		if (m_TrackedIDs.contains(id))
 		{
 			Path directory = m_TrackedIDs[id];
@@ -214,18 +239,26 @@ namespace Odyssey
 			if (m_DirectoryListeners.contains(directory))
 			{
 				m_DirectoryListeners[directory]->RemoveFolderTracker(id);
-				return true;
+				untracked = true;
 			}
 		}
 
-		return false;
+		m_Lock.Unlock(LockState::Write);
+
+		return untracked;
 	}
 
 	void FileManager::Dispatch()
 	{
+		// Copy the listeners so callbacks can track new files while we dispatch
+		std::vector<Ref<DirectoryListener>> listeners;
+
+		m_Lock.Lock(LockState::Read);
 		for (auto& [folder, directoryListener] : m_DirectoryListeners)
-		{
+			listeners.push_back(directoryListener);
+		m_Lock.Unlock(LockState::Read);
+
+		for (auto& directoryListener : listeners)
 			directoryListener->Dispatch();
-		}
 	}
 }
\ No newline at end of file
@@ -0,0 +1,75 @@
+#include "MappedFile.h"
+#include "Log.h"
+
+namespace Odyssey
+{
+	MappedFile::MappedFile(const Path& path)
+	{
+#ifdef _WIN32
+		m_File = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (m_File == INVALID_HANDLE_VALUE)
+		{
+			Log::Error("[MappedFile] Unable to open file: " + path.string());
+			return;
+		}
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(m_File, &fileSize) || fileSize.QuadPart == 0)
+		{
+			Close();
+			return;
+		}
+
+		m_Mapping = CreateFileMappingW(m_File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!m_Mapping)
+		{
+			Log::Error("[MappedFile] Unable to map file: " + path.string());
+			Close();
+			return;
+		}
+
+		m_Data = (const uint8_t*)MapViewOfFile(m_Mapping, FILE_MAP_READ, 0, 0, 0);
+		m_Size = m_Data ? (size_t)fileSize.QuadPart : 0;
+#else
+		std::ifstream file(path, std::ios::binary | std::ios::ate);
+		if (!file.is_open())
+		{
+			Log::Error("[MappedFile] Unable to open file: " + path.string());
+			return;
+		}
+
+		m_Buffer.resize((size_t)file.tellg());
+		file.seekg(0);
+		file.read((char*)m_Buffer.data(), m_Buffer.size());
+
+		m_Data = m_Buffer.empty() ? nullptr : m_Buffer.data();
+		m_Size = m_Buffer.size();
+#endif
+	}
+
+	MappedFile::~MappedFile()
+	{
+		Close();
+	}
+
+	void MappedFile::Close()
+	{
+#ifdef _WIN32
+		if (m_Data)
+			UnmapViewOfFile(m_Data);
+
+		if (m_Mapping)
+			CloseHandle(m_Mapping);
+
+		if (m_File != INVALID_HANDLE_VALUE)
+			CloseHandle(m_File);
+
+		m_Mapping = nullptr;
+		m_File = INVALID_HANDLE_VALUE;
+#else
+		m_Buffer.clear();
+#endif
+		m_Data = nullptr;
+		m_Size = 0;
+	}
+}
@@ -3,6 +3,7 @@
 #include <assert.h>
 #include <bitset>
 #include <cstring>
+#include <deque>
 #include <execution>
 #include <filesystem>
 #include <fstream>
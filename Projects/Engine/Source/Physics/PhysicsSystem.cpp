@@ -7,6 +7,7 @@
 #include "Colliders.h"
 #include "FluidBody.h"
 #include "CharacterController.h"
+#include "Project.h"
 
 namespace Odyssey
 {
@@ -15,9 +16,9 @@ namespace Odyssey
 		s_Instance = new PhysicsSystem();
 	}
 
-	void PhysicsSystem::Update()
+	void PhysicsSystem::Update(float deltaTime)
 	{
-		s_Instance->FixedUpdate();
+		s_Instance->UpdateFrame(deltaTime);
 	}
 
 	void PhysicsSystem::Destroy()
@@ -26,6 +27,16 @@ namespace Odyssey
 		s_Instance = nullptr;
 	}
 
+	float PhysicsSystem::GetFixedDeltaTime()
+	{
+		uint32_t tickRate = Default_Tick_Rate;
+
+		if (std::shared_ptr<Project> project = Project::GetActive())
+			tickRate = project->GetPhysicsTickRate();
+
+		return 1.0f / (float)tickRate;
+	}
+
 	PhysicsSystem::PhysicsSystem()
 	{
 		RegisterDefaultAllocator();
@@ -96,10 +107,7 @@ namespace Odyssey
 		ShapeRefC shapeRef = BoxShapeSettings(ToJoltVec3(extents)).Create().Get();
 
 		// Create and track the body
-		Body* body = CreateBody(shapeRef, position, rotation, properties, layer);
-		s_BodyToGameObject[body->GetID()] = gameObject;
-
-		return body;
+		return CreateBody(gameObject, shapeRef, position, rotation, properties, layer);
 	}
 
 	Body* PhysicsSystem::RegisterSphere(GameObject& gameObject, float3 position, quat rotation, float radius, BodyProperties& properties, PhysicsLayer layer)
@@ -108,10 +116,7 @@ namespace Odyssey
 		ShapeRefC shapeRef = SphereShapeSettings(radius).Create().Get();
 
 		// Create and track the body
-		Body* body = CreateBody(shapeRef, position, rotation, properties, layer);
-		s_BodyToGameObject[body->GetID()] = gameObject;
-
-		return body;
+		return CreateBody(gameObject, shapeRef, position, rotation, properties, layer);
 	}
 
 	Body* PhysicsSystem::RegisterCapsule(GameObject& gameObject, float3 position, quat rotation, float radius, float height, BodyProperties& properties, PhysicsLayer layer)
@@ -120,19 +125,13 @@ namespace Odyssey
 		ShapeRefC shapeRef = CapsuleShapeSettings(height * 0.5f, radius).Create().Get();
 
 		// Create and track the body
-		Body* body = CreateBody(shapeRef, position, rotation, properties, layer);
-		s_BodyToGameObject[body->GetID()] = gameObject;
-
-		return body;
+		return CreateBody(gameObject, shapeRef, position, rotation, properties, layer);
 	}
 
 	void PhysicsSystem::Deregister(Body* body)
 	{
-		if (s_BodyProperties.contains(body->GetID()))
-			s_BodyProperties.erase(body->GetID());
-
-		if (s_BodyToGameObject.contains(body->GetID()))
-			s_BodyToGameObject.erase(body->GetID());
+		if (TrackedBody* trackedBody = GetTrackedBody(body->GetID()))
+			*trackedBody = TrackedBody();
 
 		BodyInterface& bodyInterface = m_PhysicsSystem.GetBodyInterface();
 		bodyInterface.RemoveBody(body->GetID());
@@ -146,21 +145,16 @@ namespace Odyssey
 
 	BodyProperties* PhysicsSystem::GetBodyProperties(BodyID id)
 	{
-		if (s_BodyProperties.contains(id))
-			return s_BodyProperties[id];
+		if (TrackedBody* trackedBody = GetTrackedBody(id))
+			return trackedBody->Properties;
 
 		return nullptr;
 	}
 
-	BodyLockWrite* PhysicsSystem::GetBodyLock(BodyID bodyID)
-	{
-		return new BodyLockWrite(m_PhysicsSystem.GetBodyLockInterface(), bodyID);
-	}
-
 	GameObject PhysicsSystem::GetBodyGameObject(BodyID bodyID)
 	{
-		if (s_BodyToGameObject.contains(bodyID))
-			return s_BodyToGameObject[bodyID];
+		if (TrackedBody* trackedBody = GetTrackedBody(bodyID))
+			return trackedBody->Owner;
 
 		return GameObject();
 	}
@@ -264,7 +258,7 @@ namespace Odyssey
 			s_CharacterToGameObject.erase(character.Get());
 	}
 
-	Body* PhysicsSystem::CreateBody(ShapeRefC shapeRef, float3 position, quat rotation, BodyProperties& properties, PhysicsLayer layer)
+	Body* PhysicsSystem::CreateBody(GameObject& gameObject, ShapeRefC shapeRef, float3 position, quat rotation, BodyProperties& properties, PhysicsLayer layer)
 	{
 		BodyInterface& bodyInterface = m_PhysicsSystem.GetBodyInterface();
 
@@ -300,195 +294,308 @@ namespace Odyssey
 		// Instead insert all new objects in batches instead of 1 at a time to keep the broad phase efficient.
 		m_PhysicsSystem.OptimizeBroadPhase();
 
-		s_BodyProperties[body->GetID()] = &properties;
+		// Track the body by its index so lookups during the simulation are constant time
+		uint32_t index = body->GetID().GetIndex();
+		if (index >= m_Bodies.size())
+			m_Bodies.resize(index + 1);
+
+		TrackedBody& trackedBody = m_Bodies[index];
+		trackedBody = TrackedBody();
+		trackedBody.ID = body->GetID();
+		trackedBody.Owner = gameObject;
+		trackedBody.Properties = &properties;
+
 		return body;
 	}
 
-	void PhysicsSystem::FixedUpdate()
+	PhysicsSystem::TrackedBody* PhysicsSystem::GetTrackedBody(BodyID bodyID)
 	{
-		// We simulate the physics world in discrete time steps. 60 Hz is a good rate to update the physics system.
-		const float cDeltaTime = 1.0f / 60.0f;
+		uint32_t index = bodyID.GetIndex();
+		if (bodyID.IsInvalid() || index >= m_Bodies.size() || m_Bodies[index].ID != bodyID)
+			return nullptr;
 
-		// If you take larger steps than 1 / 60th of a second you need to do multiple collision steps in order to keep the simulation stable. Do 1 collision step per 1 / 60th of a second (round up).
-		const int cCollisionSteps = 1;
+		return &m_Bodies[index];
+	}
+
+	void PhysicsSystem::UpdateFrame(float deltaTime)
+	{
+		uint32_t maxSubsteps = Default_Max_Substeps;
+
+		if (std::shared_ptr<Project> project = Project::GetActive())
+			maxSubsteps = project->GetMaxPhysicsSubsteps();
 
-		// Read from the transform
-		if (Scene* activeScene = SceneManager::GetActiveScene())
+		const float fixedDeltaTime = GetFixedDeltaTime();
+		Time::s_FixedDeltaTime = fixedDeltaTime;
+
+		Scene* activeScene = SceneManager::GetActiveScene();
+		if (activeScene && !activeScene->IsRunning())
+			activeScene = nullptr;
+
+		// Every run of a scene starts on a step boundary, so the same inputs always produce the same steps
+		if (activeScene != m_SimulatedScene)
 		{
-			if (activeScene->IsRunning())
-			{
-				PreProcessCollisionData();
+			m_Accumulator = 0.0f;
+			m_SimulatedScene = activeScene;
+		}
 
-				auto fluidView = activeScene->GetAllEntitiesWith<Transform, FluidBody>();
-				for (auto& entity : fluidView)
-				{
-					GameObject gameObject = GameObject(activeScene, entity);
-					FluidBody& fluidBody = gameObject.GetComponent<FluidBody>();
-					fluidBody.CheckCollision(m_PhysicsSystem.GetBroadPhaseQuery());
-				}
+		// Step the world in fixed increments so the simulation doesn't depend on the frame rate
+		m_Accumulator += deltaTime;
+		uint32_t steps = (uint32_t)(m_Accumulator / fixedDeltaTime);
 
-				auto characterView = activeScene->GetAllEntitiesWith<Transform, CharacterController>();
+		if (steps > maxSubsteps)
+		{
+			// Drop the time we can't catch up on rather than falling further behind every frame
+			steps = maxSubsteps;
+			m_Accumulator = std::fmod(m_Accumulator, fixedDeltaTime);
+		}
+		else
+		{
+			m_Accumulator -= (float)steps * fixedDeltaTime;
+		}
+
+		if (activeScene)
+			SyncToPhysics(activeScene);
+
+		for (uint32_t i = 0; i < steps; i++)
+			FixedUpdate(activeScene, fixedDeltaTime);
+
+		if (activeScene)
+		{
+			// Render the state between the last two steps based on the time left over
+			SyncFromPhysics(activeScene, m_Accumulator / fixedDeltaTime);
 
+			if (steps > 0)
+			{
+				auto characterView = activeScene->GetAllEntitiesWith<Transform, CharacterController>();
 				for (auto& entity : characterView)
 				{
 					GameObject gameObject = GameObject(activeScene, entity);
-					Transform& transform = gameObject.GetComponent<Transform>();
-					CharacterController& controller = gameObject.GetComponent<CharacterController>();
-					Ref<CharacterVirtual> character = controller.GetCharacter();
-					float3 position, scale;
-					quat rotation;
-					transform.DecomposeWorldMatrix(position, rotation, scale);
-
-					character->SetRotation(ToJoltQuat(rotation));
-					character->SetPosition(ToJoltVec3(position));
-					controller.UpdateVelocity(m_PhysicsSystem.GetGravity(), Time::DeltaTime());
-
-					CharacterVirtual::ExtendedUpdateSettings updateSettings;
-					updateSettings.mStickToFloorStepDown = -character->GetUp() * controller.GetStepDown();
-					updateSettings.mWalkStairsStepUp = character->GetUp() * controller.GetStepUp();
-
-					controller.GetCharacter()->ExtendedUpdate(Time::DeltaTime(),
-						m_PhysicsSystem.GetGravity(),
-						updateSettings,
-						m_PhysicsSystem.GetDefaultBroadPhaseLayerFilter(PhysicsLayers::Dynamic),
-						m_PhysicsSystem.GetDefaultLayerFilter(PhysicsLayers::Dynamic),
-						{ },
-						{ },
-						*m_Allocator);
+					gameObject.GetComponent<CharacterController>().ClearInputVelocity();
 				}
+			}
+		}
+	}
 
-				auto view = activeScene->GetAllEntitiesWith<Transform, RigidBody, BoxCollider>();
-				for (auto& entity : view)
-				{
-					GameObject gameObject = GameObject(activeScene, entity);
-					Transform& transform = gameObject.GetComponent<Transform>();
-					RigidBody& rigidBody = gameObject.GetComponent<RigidBody>();
-					BoxCollider& collider = gameObject.GetComponent<BoxCollider>();
-
-					if (rigidBody.GetLayer() == PhysicsLayer::Dynamic)
-					{
-						float3 position, scale;
-						quat rotation;
-						transform.DecomposeWorldMatrix(position, rotation, scale);
-
-						GetBodyInterface().SetPositionAndRotation(rigidBody.GetBodyID(), ToJoltVec3(position) + ToJoltVec3(collider.GetCenter()), ToJoltQuat(rotation), EActivation::Activate);
-					}
-				}
+	void PhysicsSystem::FixedUpdate(Scene* activeScene, float fixedDeltaTime)
+	{
+		if (activeScene)
+		{
+			activeScene->FixedUpdate();
+			PreProcessCollisionData();
 
-				auto sphereView = activeScene->GetAllEntitiesWith<Transform, RigidBody, SphereCollider>();
-				for (auto& entity : sphereView)
-				{
-					GameObject gameObject = GameObject(activeScene, entity);
-					Transform& transform = gameObject.GetComponent<Transform>();
-					RigidBody& rigidBody = gameObject.GetComponent<RigidBody>();
-					SphereCollider& collider = gameObject.GetComponent<SphereCollider>();
-
-					if (rigidBody.GetLayer() == PhysicsLayer::Dynamic)
-					{
-						float3 position, scale;
-						quat rotation;
-						transform.DecomposeWorldMatrix(position, rotation, scale);
-
-						GetBodyInterface().SetPositionAndRotation(rigidBody.GetBodyID(), ToJoltVec3(position) + ToJoltVec3(collider.GetCenter()), ToJoltQuat(rotation), EActivation::Activate);
-					}
-				}
+			auto fluidView = activeScene->GetAllEntitiesWith<Transform, FluidBody>();
+			for (auto& entity : fluidView)
+			{
+				GameObject gameObject = GameObject(activeScene, entity);
+				FluidBody& fluidBody = gameObject.GetComponent<FluidBody>();
+				fluidBody.CheckCollision(m_PhysicsSystem.GetBroadPhaseQuery());
+				fluidBody.ApplyBuoyancy(m_PhysicsSystem.GetBodyLockInterface(), fixedDeltaTime);
+			}
 
-				auto capsuleView = activeScene->GetAllEntitiesWith<Transform, RigidBody, CapsuleCollider>();
-				for (auto& entity : capsuleView)
-				{
-					GameObject gameObject = GameObject(activeScene, entity);
-					Transform& transform = gameObject.GetComponent<Transform>();
-					RigidBody& rigidBody = gameObject.GetComponent<RigidBody>();
-					CapsuleCollider& collider = gameObject.GetComponent<CapsuleCollider>();
-
-					if (rigidBody.GetLayer() == PhysicsLayer::Dynamic)
-					{
-						float3 position, scale;
-						quat rotation;
-						transform.DecomposeWorldMatrix(position, rotation, scale);
-
-						GetBodyInterface().SetPositionAndRotation(rigidBody.GetBodyID(), ToJoltVec3(position) + ToJoltVec3(collider.GetCenter()), ToJoltQuat(rotation), EActivation::Activate);
-					}
-				}
+			auto characterView = activeScene->GetAllEntitiesWith<Transform, CharacterController>();
+			for (auto& entity : characterView)
+			{
+				GameObject gameObject = GameObject(activeScene, entity);
+				CharacterController& controller = gameObject.GetComponent<CharacterController>();
+				Ref<CharacterVirtual> character = controller.GetCharacter();
+				controller.UpdateVelocity(m_PhysicsSystem.GetGravity(), fixedDeltaTime);
+
+				CharacterVirtual::ExtendedUpdateSettings updateSettings;
+				updateSettings.mStickToFloorStepDown = -character->GetUp() * controller.GetStepDown();
+				updateSettings.mWalkStairsStepUp = character->GetUp() * controller.GetStepUp();
+
+				character->ExtendedUpdate(fixedDeltaTime,
+					m_PhysicsSystem.GetGravity(),
+					updateSettings,
+					m_PhysicsSystem.GetDefaultBroadPhaseLayerFilter(PhysicsLayers::Dynamic),
+					m_PhysicsSystem.GetDefaultLayerFilter(PhysicsLayers::Dynamic),
+					{ },
+					{ },
+					*m_Allocator);
 			}
 		}
 
 		// Step the world
-		m_PhysicsSystem.Update(Time::DeltaTime(), 2, m_Allocator, m_JobSystem);
+		m_PhysicsSystem.Update(fixedDeltaTime, 1, m_Allocator, m_JobSystem);
 
-		// Writeback to the transform
-		if (Scene* activeScene = SceneManager::GetActiveScene())
+		if (activeScene)
 		{
-			if (activeScene->IsRunning())
+			auto characterView = activeScene->GetAllEntitiesWith<Transform, CharacterController>();
+			for (auto& entity : characterView)
 			{
-				auto characterView = activeScene->GetAllEntitiesWith<Transform, CharacterController>();
-				for (auto& entity : characterView)
-				{
-					GameObject gameObject = GameObject(activeScene, entity);
-					Transform& transform = gameObject.GetComponent<Transform>();
-					CharacterController& controller = gameObject.GetComponent<CharacterController>();
+				GameObject gameObject = GameObject(activeScene, entity);
+				CharacterController& controller = gameObject.GetComponent<CharacterController>();
+				InterpolatedPose& pose = controller.GetPose();
 
-					float3 position = ToFloat3(controller.GetCharacter()->GetPosition());
-					controller.ResetVelocity();
-					transform.SetPosition(position);
-					transform.SetLocalSpace();
-				}
+				pose.Push(ToFloat3(controller.GetCharacter()->GetPosition()), pose.WrittenRotation);
+				controller.ResetVelocity();
+			}
 
-				auto view = activeScene->GetAllEntitiesWith<Transform, RigidBody, BoxCollider>();
-				for (auto& entity : view)
-				{
-					GameObject gameObject = GameObject(activeScene, entity);
-					Transform& transform = gameObject.GetComponent<Transform>();
-					RigidBody& rigidBody = gameObject.GetComponent<RigidBody>();
-					BoxCollider& collider = gameObject.GetComponent<BoxCollider>();
-
-					// Get the post-physics simulation position and rotation in world space
-					Vec3 simPosition;
-					Quat simRotation;
-					GetBodyInterface().GetPositionAndRotation(rigidBody.GetBodyID(), simPosition, simRotation);
-
-					transform.SetPosition(ToFloat3(simPosition) - collider.GetCenter());
-					transform.SetRotation(ToQuat(simRotation));
-					transform.SetLocalSpace();
-				}
+			PushActiveBodyPoses();
 
-				auto sphereView = activeScene->GetAllEntitiesWith<Transform, RigidBody, SphereCollider>();
-				for (auto& entity : sphereView)
-				{
-					GameObject gameObject = GameObject(activeScene, entity);
-					Transform& transform = gameObject.GetComponent<Transform>();
-					RigidBody& rigidBody = gameObject.GetComponent<RigidBody>();
-					SphereCollider& collider = gameObject.GetComponent<SphereCollider>();
-
-					// Get the post-physics simulation position and rotation in world space
-					Vec3 simPosition;
-					Quat simRotation;
-					GetBodyInterface().GetPositionAndRotation(rigidBody.GetBodyID(), simPosition, simRotation);
-
-					transform.SetPosition(ToFloat3(simPosition) - collider.GetCenter());
-					transform.SetRotation(ToQuat(simRotation));
-					transform.SetLocalSpace();
-				}
+			ProcessCollisionData();
+		}
+	}
 
-				auto capsuleView = activeScene->GetAllEntitiesWith<Transform, RigidBody, CapsuleCollider>();
-				for (auto& entity : capsuleView)
-				{
-					GameObject gameObject = GameObject(activeScene, entity);
-					Transform& transform = gameObject.GetComponent<Transform>();
-					RigidBody& rigidBody = gameObject.GetComponent<RigidBody>();
-					CapsuleCollider& collider = gameObject.GetComponent<CapsuleCollider>();
-
-					// Get the post-physics simulation position and rotation in world space
-					Vec3 simPosition;
-					Quat simRotation;
-					GetBodyInterface().GetPositionAndRotation(rigidBody.GetBodyID(), simPosition, simRotation);
-
-					transform.SetPosition(ToFloat3(simPosition) - collider.GetCenter());
-					transform.SetRotation(ToQuat(simRotation));
-					transform.SetLocalSpace();
-				}
+	void PhysicsSystem::SyncToPhysics(Scene* activeScene)
+	{
+		auto characterView = activeScene->GetAllEntitiesWith<Transform, CharacterController>();
+		for (auto& entity : characterView)
+		{
+			GameObject gameObject = GameObject(activeScene, entity);
+			Transform& transform = gameObject.GetComponent<Transform>();
+			CharacterController& controller = gameObject.GetComponent<CharacterController>();
+			Ref<CharacterVirtual> character = controller.GetCharacter();
+			InterpolatedPose& pose = controller.GetPose();
+
+			float3 position, scale;
+			quat rotation;
+			transform.DecomposeWorldMatrix(position, rotation, scale);
+
+			// Characters are driven by their transform's rotation, only their position is simulated
+			character->SetRotation(ToJoltQuat(rotation));
+			pose.WrittenRotation = rotation;
+
+			if (pose.IsTeleported(position))
+			{
+				character->SetPosition(ToJoltVec3(position));
+				pose.Reset(position, rotation);
+			}
+		}
 
-				ProcessCollisionData();
+		SyncBodiesToPhysics<BoxCollider>(activeScene);
+		SyncBodiesToPhysics<SphereCollider>(activeScene);
+		SyncBodiesToPhysics<CapsuleCollider>(activeScene);
+	}
+
+	void PhysicsSystem::SyncFromPhysics(Scene* activeScene, float alpha)
+	{
+		auto characterView = activeScene->GetAllEntitiesWith<Transform, CharacterController>();
+		for (auto& entity : characterView)
+		{
+			GameObject gameObject = GameObject(activeScene, entity);
+			Transform& transform = gameObject.GetComponent<Transform>();
+			InterpolatedPose& pose = gameObject.GetComponent<CharacterController>().GetPose();
+
+			float3 position = pose.GetPosition(alpha);
+			transform.SetPosition(position);
+			transform.SetLocalSpace();
+			pose.WrittenPosition = position;
+		}
+
+		WriteInterpolatedBodies(alpha);
+	}
+
+	template<typename ColliderType>
+	void PhysicsSystem::SyncBodiesToPhysics(Scene* activeScene)
+	{
+		auto view = activeScene->GetAllEntitiesWith<Transform, RigidBody, ColliderType>();
+		for (auto& entity : view)
+		{
+			GameObject gameObject = GameObject(activeScene, entity);
+			Transform& transform = gameObject.GetComponent<Transform>();
+			RigidBody& rigidBody = gameObject.GetComponent<RigidBody>();
+			ColliderType& collider = gameObject.GetComponent<ColliderType>();
+
+			if (rigidBody.GetLayer() != PhysicsLayer::Dynamic)
+				continue;
+
+			float3 position, scale;
+			quat rotation;
+			transform.DecomposeWorldMatrix(position, rotation, scale);
+
+			// Only push the transform into the simulation when something other than physics moved it,
+			// resetting every body each frame would keep them all awake and undo the interpolation
+			InterpolatedPose& pose = rigidBody.GetPose();
+			if (pose.IsTeleported(position, rotation))
+			{
+				GetBodyInterface().SetPositionAndRotation(rigidBody.GetBodyID(), ToJoltVec3(position) + ToJoltVec3(collider.GetCenter()), ToJoltQuat(rotation), EActivation::Activate);
+				pose.Reset(position, rotation);
+			}
+		}
+	}
+
+	void PhysicsSystem::PushActiveBodyPoses()
+	{
+		m_StepCount++;
+
+		// Sleeping bodies haven't moved, only the active ones need to be read back
+		m_PhysicsSystem.GetActiveBodies(EBodyType::RigidBody, m_ActiveBodies);
+		m_ActiveBodyStates.clear();
+
+		{
+			// Read every active body into one contiguous array under a single multi-body lock
+			BodyLockMultiRead lock(m_PhysicsSystem.GetBodyLockInterface(), m_ActiveBodies.data(), (int)m_ActiveBodies.size());
+
+			for (int i = 0; i < (int)m_ActiveBodies.size(); i++)
+			{
+				if (const Body* body = lock.GetBody(i))
+					m_ActiveBodyStates.push_back({ body->GetID(), ToFloat3(body->GetPosition()), ToQuat(body->GetRotation()) });
+			}
+		}
+
+		for (const BodyState& state : m_ActiveBodyStates)
+		{
+			TrackedBody* trackedBody = GetTrackedBody(state.ID);
+			if (!trackedBody)
+				continue;
+
+			RigidBody* rigidBody = trackedBody->Owner.TryGetComponent<RigidBody>();
+			if (!rigidBody)
+				continue;
+
+			rigidBody->GetPose().Push(state.Position - rigidBody->GetColliderCenter(), state.Rotation);
+			trackedBody->LastActiveStep = m_StepCount;
+
+			if (!trackedBody->Interpolating)
+			{
+				trackedBody->Interpolating = true;
+				m_InterpolatingBodies.push_back(state.ID);
+			}
+		}
+	}
+
+	void PhysicsSystem::WriteInterpolatedBodies(float alpha)
+	{
+		size_t i = 0;
+		while (i < m_InterpolatingBodies.size())
+		{
+			TrackedBody* trackedBody = GetTrackedBody(m_InterpolatingBodies[i]);
+			RigidBody* rigidBody = trackedBody ? trackedBody->Owner.TryGetComponent<RigidBody>() : nullptr;
+			Transform* transform = trackedBody ? trackedBody->Owner.TryGetComponent<Transform>() : nullptr;
+
+			// A body that wasn't active in the last step has gone to sleep, settle it on its final pose
+			bool settled = !rigidBody || !transform || trackedBody->LastActiveStep != m_StepCount;
+
+			if (rigidBody && transform)
+			{
+				InterpolatedPose& pose = rigidBody->GetPose();
+
+				if (settled)
+					pose.Push(pose.CurrentPosition, pose.CurrentRotation);
+
+				float3 position = pose.GetPosition(alpha);
+				quat rotation = pose.GetRotation(alpha);
+
+				transform->SetPosition(position);
+				transform->SetRotation(rotation);
+				transform->SetLocalSpace();
+
+				pose.WrittenPosition = position;
+				pose.WrittenRotation = rotation;
+			}
+
+			if (settled)
+			{
+				if (trackedBody)
+					trackedBody->Interpolating = false;
+
+				m_InterpolatingBodies[i] = m_InterpolatingBodies.back();
+				m_InterpolatingBodies.pop_back();
+			}
+			else
+			{
+				i++;
 			}
 		}
 	}
@@ -38,6 +38,8 @@ namespace Odyssey
 		root.WriteData("CodeDirectory", m_CodeDirectory.string());
 		root.WriteData("ScriptsProjectPath", m_ScriptsProjectPath.string());
 		root.WriteData("AssetRegistryPath", m_AssetRegistryPath.string());
+		root.WriteData("PhysicsTickRate", m_PhysicsTickRate);
+		root.WriteData("MaxPhysicsSubsteps", m_MaxPhysicsSubsteps);
 		serializer.WriteToDisk(m_Path);
 	}
 
@@ -69,6 +71,11 @@ namespace Odyssey
 			root.ReadData("CodeDirectory", codeDirectory);
 			root.ReadData("ScriptsProjectPath", scriptsProjectPath);
 			root.ReadData("AssetRegistryPath", assetRegistryPath);
+			root.ReadData("PhysicsTickRate", m_PhysicsTickRate);
+			root.ReadData("MaxPhysicsSubsteps", m_MaxPhysicsSubsteps);
+
+			m_PhysicsTickRate = std::max(m_PhysicsTickRate, 1u);
+			m_MaxPhysicsSubsteps = std::max(m_MaxPhysicsSubsteps, 1u);
 
 			// Convert them back into paths
 			m_AssetsDirectory = assetsDirectory;
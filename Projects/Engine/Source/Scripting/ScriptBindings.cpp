@@ -97,6 +97,11 @@ namespace Odyssey
 		ADD_INTERNAL_CALL(CharacterController_SetLinearVelocity);
 		ADD_INTERNAL_CALL(CharacterController_IsGrounded);
 
+		ADD_INTERNAL_CALL(SpatialQuery_Raycast);
+		ADD_INTERNAL_CALL(SpatialQuery_OverlapSphere);
+		ADD_INTERNAL_CALL(SpatialQuery_OverlapBox);
+		ADD_INTERNAL_CALL(SpatialQuery_OverlapCamera);
+
 		ADD_INTERNAL_CALL(Prefab_LoadInstance);
 		ADD_INTERNAL_CALL(Prefab_DestroyInstance);
 
@@ -113,6 +118,7 @@ namespace Odyssey
 		ADD_INTERNAL_CALL(Input_GetMousePosition);
 
 		ADD_INTERNAL_CALL(Time_GetDeltaTime);
+		ADD_INTERNAL_CALL(Time_GetFixedDeltaTime);
 
 		frameworkAssembly.UploadInternalCalls();
 	}
@@ -4,7 +4,10 @@ namespace Odyssey
 {
 	BinaryBuffer::BinaryBuffer(std::vector<uint8_t> buffer)
 	{
-		WriteData(buffer);
+		// Take ownership rather than copying the bytes again
+		m_Size = buffer.size();
+		m_Count = buffer.size();
+		m_Data = std::move(buffer);
 	}
 
 	BinaryBuffer::BinaryBuffer(uint8_t* buffer, size_t size)
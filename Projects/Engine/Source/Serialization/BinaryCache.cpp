@@ -21,8 +21,17 @@ namespace Odyssey
 	}
 	BinaryBuffer BinaryCache::LoadBinaryData(GUID guid)
 	{
-		if (m_GUIDToPath.contains(guid))
-			return LoadBinaryData(m_GUIDToPath[guid]);
+		Path assetPath;
+
+		m_Lock.Lock(LockState::Read);
+
+		if (auto iter = m_GUIDToPath.find(guid); iter != m_GUIDToPath.end())
+			assetPath = iter->second;
+
+		m_Lock.Unlock(LockState::Read);
+
+		if (!assetPath.empty())
+			return LoadBinaryData(assetPath);
 		
 		return BinaryBuffer();
 	}
@@ -32,7 +41,7 @@ namespace Odyssey
 		std::ofstream file(assetPath, std::ios::trunc | std::ios::binary);
 		if (!file.is_open())
 		{
-			Log::Error("[VulkanShader] Unable to open shader file: " + assetPath.string());
+			Log::Error("[BinaryCache] Unable to open cache file: " + assetPath.string());
 			return;
 		}
 
@@ -41,7 +50,7 @@ namespace Odyssey
 		file.write((char*)&bufferSize, sizeof(size_t));
 
 		// Create the buffer and read into it
-		std::vector<unsigned char> bufferData = buffer.GetData();
+		const std::vector<unsigned char>& bufferData = buffer.GetData();
 		file.write((char*)bufferData.data(), bufferSize);
 
 		// Done reading
@@ -50,7 +59,14 @@ namespace Odyssey
 
 	void BinaryCache::SaveBinaryData(GUID& guid, BinaryBuffer& buffer)
 	{
-		SaveBinaryData(GenerateAssetPath(guid), buffer);
+		Path assetPath = GenerateAssetPath(guid);
+		SaveBinaryData(assetPath, buffer);
+
+		// Track the new entry so it can be loaded without re-cataloging
+		m_Lock.Lock(LockState::Write);
+		m_GUIDToPath[guid] = assetPath;
+		m_PathToGUID[assetPath] = guid;
+		m_Lock.Unlock(LockState::Write);
 	}
 
 	void BinaryCache::CatalogAssets()
@@ -67,8 +83,8 @@ namespace Odyssey
 
 			if (dirEntry.is_regular_file() && extension == ".asset")
 			{
-				// Read contents of a file
-				if (LoadBinaryData(assetPath))
+				// Only check for the size header, the contents are read on demand
+				if (dirEntry.file_size() > sizeof(size_t))
 				{
 					// We use the filename as the guid
 					GUID guid = assetPath.filename().replace_extension("").string();
@@ -87,7 +103,7 @@ namespace Odyssey
 		std::ifstream file(path, std::ios::binary);
 		if (!file.is_open())
 		{
-			Log::Error("[VulkanShader] Unable to open shader file: " + path.string());
+			Log::Error("[BinaryCache] Unable to open cache file: " + path.string());
 			return BinaryBuffer();
 		}
 
@@ -102,7 +118,7 @@ namespace Odyssey
 		// Done reading
 		file.close();
 
-		return BinaryBuffer(buffer);
+		return BinaryBuffer(std::move(buffer));
 	}
 
 	Path BinaryCache::GenerateAssetPath(GUID guid)
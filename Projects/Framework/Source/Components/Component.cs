@@ -17,6 +17,7 @@ namespace Odyssey
 
         protected virtual void Awake() { }
         protected virtual void Update() { }
+        protected virtual void FixedUpdate() { }
         protected virtual void OnDestroy() { }
         protected virtual void OnCollisionEnter(Entity entity, Vector3 contactNormal) { }
         protected virtual void OnCollisionStay(Entity entity, Vector3 contactNormal) { }
@@ -141,6 +141,15 @@ namespace Odyssey
         internal static delegate* unmanaged<GUID, bool*, void> CharacterController_IsGrounded;
         
 
+        #endregion
+
+        #region Spatial Query
+
+        internal static delegate* unmanaged<Vector3, Vector3, float, GUID*, float*, bool> SpatialQuery_Raycast;
+        internal static delegate* unmanaged<Vector3, float, GUID*, int, int> SpatialQuery_OverlapSphere;
+        internal static delegate* unmanaged<Vector3, Vector3, GUID*, int, int> SpatialQuery_OverlapBox;
+        internal static delegate* unmanaged<GUID, GUID*, int, int> SpatialQuery_OverlapCamera;
+
         #endregion
         #region Input
 
@@ -157,6 +166,7 @@ namespace Odyssey
         #region Time
 
         internal static delegate* unmanaged<float> Time_GetDeltaTime;
+        internal static delegate* unmanaged<float> Time_GetFixedDeltaTime;
 
         #endregion
 
@@ -0,0 +1,73 @@
+﻿namespace Odyssey
+{
+    public struct RaycastHit
+    {
+        public Entity Entity;
+        public float Distance;
+    }
+
+    public static class SpatialQuery
+    {
+        // Initial result buffer size, queries that find more are retried with the full count
+        private const int DefaultCapacity = 64;
+
+        public static bool Raycast(Vector3 origin, Vector3 direction, float maxDistance, out RaycastHit hit)
+        {
+            hit = new RaycastHit();
+
+            unsafe
+            {
+                GUID guid = new GUID();
+                float distance = 0.0f;
+
+                if (!InternalCalls.SpatialQuery_Raycast(origin, direction, maxDistance, &guid, &distance))
+                    return false;
+
+                hit.Entity = new Entity(guid);
+                hit.Distance = distance;
+                return true;
+            }
+        }
+
+        public static Entity[] OverlapSphere(Vector3 center, float radius)
+        {
+            unsafe { return Query((results, capacity) => InternalCalls.SpatialQuery_OverlapSphere(center, radius, results, capacity)); }
+        }
+
+        public static Entity[] OverlapBox(Vector3 min, Vector3 max)
+        {
+            unsafe { return Query((results, capacity) => InternalCalls.SpatialQuery_OverlapBox(min, max, results, capacity)); }
+        }
+
+        public static Entity[] OverlapCamera(Camera camera)
+        {
+            GUID cameraGUID = camera.Entity.GUID;
+            unsafe { return Query((results, capacity) => InternalCalls.SpatialQuery_OverlapCamera(cameraGUID, results, capacity)); }
+        }
+
+        private unsafe delegate int QueryFunc(GUID* results, int capacity);
+
+        private static unsafe Entity[] Query(QueryFunc query)
+        {
+            GUID[] guids = new GUID[DefaultCapacity];
+            int count;
+
+            fixed (GUID* results = guids)
+                count = query(results, guids.Length);
+
+            if (count > guids.Length)
+            {
+                guids = new GUID[count];
+
+                fixed (GUID* results = guids)
+                    count = System.Math.Min(query(results, guids.Length), guids.Length);
+            }
+
+            Entity[] entities = new Entity[count];
+            for (int i = 0; i < count; i++)
+                entities[i] = new Entity(guids[i]);
+
+            return entities;
+        }
+    }
+}
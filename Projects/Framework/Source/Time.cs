@@ -6,5 +6,10 @@
         {
             get { unsafe { return InternalCalls.Time_GetDeltaTime(); } }
         }
+
+        public static float FixedDeltaTime
+        {
+            get { unsafe { return InternalCalls.Time_GetFixedDeltaTime(); } }
+        }
     }
 }
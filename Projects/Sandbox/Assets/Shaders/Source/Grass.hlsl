@@ -39,11 +39,14 @@ cbuffer SceneData : register(b0)
     float4x4 LightViewProj;
 }
 
-cbuffer ModelData : register(b1)
+struct ObjectData
 {
     float4x4 Model;
-    float3x3 InverseModel;
-}
+    uint BoneOffset;
+};
+
+StructuredBuffer<ObjectData> ObjectBuffer : register(t1);
+StructuredBuffer<uint> InstanceBuffer : register(t14);
 
 cbuffer GlobalData : register(b2)
 {
@@ -103,7 +106,7 @@ cbuffer MaterialData : register(b6)
 struct VertexInput
 {
     float3 Position : POSITION;
-    float3 Normal : NORMAL;
+    float2 Normal : NORMAL;
     float4 Tangent : TANGENT;
     float2 TexCoord0 : TEXCOORD0;
 };
@@ -114,13 +117,24 @@ struct VertexOutput
     float3 Normal : NORMAL;
     float4 Tangent : TANGENT;
     float2 TexCoord0 : TEXCOORD0;
+    uint ObjectIndex : OBJECTINDEX;
 };
 
-VertexOutput main(VertexInput input)
+// Vertex normals are octahedral encoded
+float3 OctahedralDecode(float2 encoded)
+{
+    float3 normal = float3(encoded.xy, 1.0f - abs(encoded.x) - abs(encoded.y));
+    if (normal.z < 0.0f)
+        normal.xy = (1.0f - abs(normal.yx)) * float2(normal.x >= 0.0f ? 1.0f : -1.0f, normal.y >= 0.0f ? 1.0f : -1.0f);
+    return normalize(normal);
+}
+
+VertexOutput main(VertexInput input, uint instanceID : SV_InstanceID)
 {
     VertexOutput output;
+    output.ObjectIndex = InstanceBuffer[instanceID];
     output.Position = float4(input.Position, 1.0f);
-    output.Normal = normalize(input.Normal);
+    output.Normal = OctahedralDecode(input.Normal);
     output.Tangent.xyz = normalize(input.Tangent.xyz);
     output.TexCoord0 = input.TexCoord0;
     return output;
@@ -133,6 +147,7 @@ struct HullInput
     float3 Normal : NORMAL;
     float4 Tangent : TANGENT;
     float2 TexCoord0 : TEXCOORD0;
+    uint ObjectIndex : OBJECTINDEX;
 };
 
 struct HullOutput
@@ -141,6 +156,7 @@ struct HullOutput
     float3 Normal : NORMAL;
     float4 Tangent : TANGENT;
     float2 TexCoord0 : TEXCOORD0;
+    uint ObjectIndex : OBJECTINDEX;
     float pnPatch[10] : TEXCOORD6;
 };
 
@@ -196,6 +212,7 @@ HullOutput main(InputPatch<HullInput, 3> patch, uint InvocationID : SV_OutputCon
     output.Normal = patch[InvocationID].Normal;
     output.Tangent = patch[InvocationID].Tangent;
     output.TexCoord0 = patch[InvocationID].TexCoord0;
+    output.ObjectIndex = patch[InvocationID].ObjectIndex;
 
 	// set base
     float P0 = patch[0].Position[InvocationID];
@@ -236,6 +253,7 @@ struct DomainInput
     float3 Normal : NORMAL;
     float4 Tangent : TANGENT;
     float2 TexCoord0 : TEXCOORD0;
+    uint ObjectIndex : OBJECTINDEX;
     float pnPatch[10] : TEXCOORD6;
 };
 
@@ -245,6 +263,7 @@ struct DSOutput
     float3 Normal : NORMAL;
     float4 Tangent : TANGENT;
     float2 TexCoord0 : TEXCOORD0;
+    uint ObjectIndex : OBJECTINDEX;
 };
 
 #define uvw TessCoord
@@ -274,6 +293,7 @@ DSOutput main(ConstantsHSOutput input, float3 TessCoord : SV_DomainLocation, con
     pnPatch[2] = GetPnPatch(patch[2].pnPatch);
 
     DSOutput output = (DSOutput) 0;
+    output.ObjectIndex = patch[0].ObjectIndex;
     float3 uvwSquared = uvw * uvw;
     float3 uvwCubed = uvwSquared * uvw;
 
@@ -339,12 +359,16 @@ DSOutput main(ConstantsHSOutput input, float3 TessCoord : SV_DomainLocation, con
 // Constants
 static const float PI = 3.14159265f;
 
+// Set once per primitive from the object buffer
+static float4x4 Model;
+
 struct GeometryInput
 {
     float4 Position : POSITION;
     float3 Normal : NORMAL;
     float4 Tangent : TANGENT;
     float2 TexCoord0 : TEXCOORD0;
+    uint ObjectIndex : OBJECTINDEX;
 };
 
 struct GeometryOutput
@@ -401,6 +425,8 @@ GeometryOutput GenerateGrassVertex(float3 position, float width, float height, f
 [maxvertexcount((BLADE_SEGMENTS * 2 + 1) + 3)]
 void main(uint primitiveID : SV_PrimitiveID, triangle GeometryInput input[3], inout TriangleStream<GeometryOutput> triStream)
 {
+    Model = ObjectBuffer[input[0].ObjectIndex].Model;
+    
     for (int index = 0; index < 3; index++)
     {
         float3 vPosition = input[index].Position.xyz;
@@ -18,16 +18,15 @@ cbuffer SceneData : register(b0)
     float4x4 LightViewProj;
 }
 
-cbuffer ModelData : register(b1)
+struct ObjectData
 {
     float4x4 Model;
-    float3x3 InverseModel;
-}
+    uint BoneOffset;
+};
 
-cbuffer SkinningData : register(b2)
-{
-    float4x4 Bones[128];
-}
+StructuredBuffer<ObjectData> ObjectBuffer : register(t1);
+StructuredBuffer<float4x4> BoneBuffer : register(t2);
+StructuredBuffer<uint> InstanceBuffer : register(t14);
 
 cbuffer GlobalData : register(b3)
 {
@@ -80,10 +79,10 @@ SamplerState depthSampler : register(s10);
 struct VertexInput
 {
     float3 Position : POSITION;
-    float3 Normal : NORMAL;
+    float2 Normal : NORMAL;
     float4 Tangent : TANGENT;
     float2 TexCoord0 : TEXCOORD0;
-    float4 BoneIndices : BLENDINDICES0;
+    uint4 BoneIndices : BLENDINDICES0;
     float4 BoneWeights : BLENDWEIGHT0;
 };
 
@@ -104,13 +103,24 @@ struct SkinningOutput
 };
 
 // Forward declarations
-SkinningOutput SkinVertex(VertexInput input);
+SkinningOutput SkinVertex(VertexInput input, uint boneOffset);
 
-VertexOutput main(VertexInput input)
+// Vertex normals are octahedral encoded
+float3 OctahedralDecode(float2 encoded)
+{
+    float3 normal = float3(encoded.xy, 1.0f - abs(encoded.x) - abs(encoded.y));
+    if (normal.z < 0.0f)
+        normal.xy = (1.0f - abs(normal.yx)) * float2(normal.x >= 0.0f ? 1.0f : -1.0f, normal.y >= 0.0f ? 1.0f : -1.0f);
+    return normalize(normal);
+}
+
+VertexOutput main(VertexInput input, uint instanceID : SV_InstanceID)
 {
     VertexOutput output;
+    ObjectData objectData = ObjectBuffer[InstanceBuffer[instanceID]];
+    float4x4 Model = objectData.Model;
     
-    SkinningOutput skinning = SkinVertex(input);
+    SkinningOutput skinning = SkinVertex(input, objectData.BoneOffset);
     float4 worldPosition = mul(Model, skinning.Position);
     float4 normal = float4(normalize(skinning.Normal.xyz), 0.0f);
     float4 tangent = float4(input.Tangent.xyz, 0.0f);
@@ -131,18 +141,18 @@ VertexOutput main(VertexInput input)
     return output;
 }
 
-SkinningOutput SkinVertex(VertexInput input)
+SkinningOutput SkinVertex(VertexInput input, uint boneOffset)
 {
     SkinningOutput output;
     output.Position = float4(0, 0, 0, 0);
     output.Normal = float4(0, 0, 0, 0);
     float4 vertexPosition = float4(input.Position, 1.0f);
-    float4 vertexNormal = float4(input.Normal, 0.0f);
+    float4 vertexNormal = float4(OctahedralDecode(input.Normal), 0.0f);
     
     for (int i = 0; i < 4; i++)
     {
-        output.Position += mul(Bones[input.BoneIndices[i]], vertexPosition) * input.BoneWeights[i];
-        output.Normal += mul(Bones[input.BoneIndices[i]], vertexNormal) * input.BoneWeights[i];
+        output.Position += mul(BoneBuffer[boneOffset + input.BoneIndices[i]], vertexPosition) * input.BoneWeights[i];
+        output.Normal += mul(BoneBuffer[boneOffset + input.BoneIndices[i]], vertexNormal) * input.BoneWeights[i];
     }
     
     return output;
@@ -195,6 +205,9 @@ float4 main(PixelInput input) : SV_Target
         // Move the texture normal from 0.0 - 1.0 space to -1.0 to 1.0
         texNormal = (2.0f * texNormal) - 1.0f;
         
+        // BC5 normal maps only store xy
+        texNormal.z = sqrt(saturate(1.0f - dot(texNormal.xy, texNormal.xy)));
+        
         // "Orthogonalize" the tangent
         float3 tangent = normalize(input.Tangent.xyz - dot(input.Tangent.xyz, worldNormal) * worldNormal);
         
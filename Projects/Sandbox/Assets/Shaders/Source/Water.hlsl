@@ -38,11 +38,14 @@ cbuffer SceneData : register(b0)
     float4x4 LightViewProj;
 }
 
-cbuffer ModelData : register(b1)
+struct ObjectData
 {
     float4x4 Model;
-    float3x3 InverseModel;
-}
+    uint BoneOffset;
+};
+
+StructuredBuffer<ObjectData> ObjectBuffer : register(t1);
+StructuredBuffer<uint> InstanceBuffer : register(t14);
 
 cbuffer GlobalData : register(b3)
 {
@@ -111,7 +114,7 @@ SamplerState cameraColorSampler : register(s9);
 struct VertexInput
 {
     float3 Position : POSITION;
-    float3 Normal : NORMAL;
+    float2 Normal : NORMAL;
     float4 Tangent : TANGENT;
     float2 TexCoord0 : TEXCOORD0;
 };
@@ -122,13 +125,24 @@ struct VertexOutput
     float3 Normal : NORMAL;
     float4 Tangent : TANGENT;
     float2 TexCoord0 : TEXCOORD0;
+    uint ObjectIndex : OBJECTINDEX;
 };
 
-VertexOutput main(VertexInput input)
+// Vertex normals are octahedral encoded
+float3 OctahedralDecode(float2 encoded)
+{
+    float3 normal = float3(encoded.xy, 1.0f - abs(encoded.x) - abs(encoded.y));
+    if (normal.z < 0.0f)
+        normal.xy = (1.0f - abs(normal.yx)) * float2(normal.x >= 0.0f ? 1.0f : -1.0f, normal.y >= 0.0f ? 1.0f : -1.0f);
+    return normalize(normal);
+}
+
+VertexOutput main(VertexInput input, uint instanceID : SV_InstanceID)
 {
     VertexOutput output;
+    output.ObjectIndex = InstanceBuffer[instanceID];
     output.Position = float4(input.Position, 1.0f);
-    output.Normal = normalize(input.Normal);
+    output.Normal = OctahedralDecode(input.Normal);
     output.Tangent.xyz = normalize(input.Tangent.xyz);
     output.TexCoord0 = input.TexCoord0;
     return output;
@@ -141,6 +155,7 @@ struct HullInput
     float3 Normal : NORMAL;
     float4 Tangent : TANGENT;
     float2 TexCoord0 : TEXCOORD0;
+    uint ObjectIndex : OBJECTINDEX;
 };
 
 struct HullOutput
@@ -149,6 +164,7 @@ struct HullOutput
     float3 Normal : NORMAL;
     float4 Tangent : TANGENT;
     float2 TexCoord0 : TEXCOORD0;
+    uint ObjectIndex : OBJECTINDEX;
     float pnPatch[10] : TEXCOORD6;
 };
 
@@ -204,6 +220,7 @@ HullOutput main(InputPatch<HullInput, 3> patch, uint InvocationID : SV_OutputCon
     output.Normal = patch[InvocationID].Normal;
     output.Tangent = patch[InvocationID].Tangent;
     output.TexCoord0 = patch[InvocationID].TexCoord0;
+    output.ObjectIndex = patch[InvocationID].ObjectIndex;
 
 	// set base
     float P0 = patch[0].Position[InvocationID];
@@ -244,6 +261,7 @@ struct DomainInput
     float3 Normal : NORMAL;
     float4 Tangent : TANGENT;
     float2 TexCoord0 : TEXCOORD0;
+    uint ObjectIndex : OBJECTINDEX;
     float pnPatch[10] : TEXCOORD6;
 };
 
@@ -304,6 +322,7 @@ DSOutput main(ConstantsHSOutput input, float3 TessCoord : SV_DomainLocation, con
     pnPatch[2] = GetPnPatch(patch[2].pnPatch);
 
     DSOutput output = (DSOutput) 0;
+    float4x4 Model = ObjectBuffer[patch[0].ObjectIndex].Model;
     float3 uvwSquared = uvw * uvw;
     float3 uvwCubed = uvwSquared * uvw;
 
@@ -411,6 +430,13 @@ float2 TextureMovement(float2 uv, float2 scale, float speed)
     return uv;
 }
 
+float3 UnpackNormalColor(float3 color)
+{
+    // BC5 normal maps only store xy, rebuild z and keep it in 0 - 1 space
+    float2 xy = (2.0f * color.xy) - 1.0f;
+    return float3(color.xy, sqrt(saturate(1.0f - dot(xy, xy))) * 0.5f + 0.5f);
+}
+
 float3 BlendNormal(float3 A, float3 B)
 {
     return normalize(float3(A.rg + B.rg, A.b * B.b));
@@ -483,8 +509,8 @@ float4 main(PixelInput input) : SV_Target
     float2 inverseRefactionUV = TextureMovement(input.TexCoord0, RefractionScale, -RefractionSpeed);
     
     // Sample the normal map twice, once with forward movement and once with reverse movement
-    float3 refractionNormal = refractionNormalTex2D.Sample(refractionNormalSampler, refactionUV);
-    float3 inverseRefractionNormal = refractionNormalTex2D.Sample(refractionNormalSampler, inverseRefactionUV);
+    float3 refractionNormal = UnpackNormalColor(refractionNormalTex2D.Sample(refractionNormalSampler, refactionUV));
+    float3 inverseRefractionNormal = UnpackNormalColor(refractionNormalTex2D.Sample(refractionNormalSampler, inverseRefactionUV));
     
     // Blend the normals together and apply the refraction strength
     float3 blendRefractionNormal = BlendNormal(refractionNormal, inverseRefractionNormal) * RefractionStrength * 0.1f;
@@ -26,6 +26,7 @@ include "Vendor/Coral/Coral.Native/premake5.lua"
 group ""
 
 group "Odyssey"
+include "Projects/Bench"
 include "Projects/Editor"
 include "Projects/Engine"
 include "Projects/Framework"